@@ -0,0 +1,226 @@
+# Copyright (c) 2026, James W. Swent
+#
+# Distributed under the terms of the GPL license version 3.
+
+# Benchmark suite for Semigroups.jl, in the layout expected by PkgBenchmark:
+# this file defines `SUITE`, a `BenchmarkGroup` with one group per area of
+# the bindings. See `benchmark/run.jl` (or `make bench`) to run it.
+#
+# Every group has two subgroups, each tagged with its own name:
+#
+# - "native": one call into libsemigroups does the whole workload, so the
+#   timing is of libsemigroups itself;
+# - "ffi": the same kind of workload made of one binding call per element,
+#   word or path, so the timing is dominated by the cost of crossing the
+#   Julia/C++ boundary.
+#
+# The Congruence races make no per-element calls, so have no "ffi"
+# subgroup. `SUITE[@tagged "ffi"]` selects every boundary-bound benchmark;
+# a regression in "ffi" only usually comes from CxxWrap, and one in
+# "native" only from libsemigroups_jll.
+#
+# The presentations are those of libsemigroups' presentation examples
+# (`deps/src/presentation-examples.cpp`). Workloads are sized to take
+# milliseconds, not seconds, and every random input is seeded.
+#
+# `benchmark/run.jl` runs this file against a baseline ref too, which may
+# predate some of the functions benchmarked here, so every benchmark of a
+# function newer than the suite itself is guarded by `_has`, and is left out
+# of a run of a tree that does not define it.
+
+using BenchmarkTools
+using Random
+using Semigroups
+
+const SUITE = BenchmarkGroup()
+
+# Whether the version of Semigroups being benchmarked defines every name in
+# `names`.
+_has(names::Symbol...) = all(name -> isdefined(Semigroups, name), names)
+
+# Generators of the full transformation monoid of degree n: an n-cycle, a
+# transposition and a map of rank n - 1.
+function _full_transformation_generators(n::Integer)
+    return [
+        Transf(vcat(2:n, 1)),
+        Transf(vcat([2, 1], 3:n)),
+        Transf(vcat([1, 1], 3:n)),
+    ]
+end
+
+# `count` random words over the alphabet of `p` of length at most `len`.
+function _random_words(p::Presentation, count::Integer, len::Integer)
+    rng = Random.MersenneTwister(2026)
+    letters = alphabet(p)
+    return [rand(rng, letters, rand(rng, 0:len)) for _ = 1:count]
+end
+
+# One binding call per element.
+function _each_element(S::FroidurePin)
+    for i = 1:length(S)
+        S[i]
+    end
+    return S
+end
+
+function _each_product!(out::Vector, xs::Vector, ys::Vector)
+    for k in eachindex(out, xs, ys)
+        out[k] = xs[k] * ys[k]
+    end
+    return out
+end
+
+function _each_path(p::Paths)
+    n = 0
+    for _ in p
+        n += 1
+    end
+    return n
+end
+
+# `Semigroups.reduce` is not exported, since it would shadow `Base.reduce`.
+function _each_reduce(cong, words)
+    return [Semigroups.reduce(cong, w) for w in words]
+end
+
+# Add the group SUITE[name], with its "native" and (optionally) "ffi"
+# subgroups.
+function _group!(name::String; ffi::Bool = true)
+    group = SUITE[name] = BenchmarkGroup([name])
+    group["native"] = BenchmarkGroup(["native"])
+    if ffi
+        group["ffi"] = BenchmarkGroup(["ffi"])
+    end
+    return group
+end
+
+# ----------------------------------------------------------------------------
+# FroidurePin: enumeration of full transformation monoids
+# ----------------------------------------------------------------------------
+
+let g = _group!("froidure_pin")
+    for n in (5, 6)
+        gens = _full_transformation_generators(n)
+        g["native"]["run! T_$n"] =
+            @benchmarkable run!(S) setup = (S = FroidurePin($gens)) evals = 1
+    end
+    S = run!(FroidurePin(_full_transformation_generators(5)))
+    g["ffi"]["getindex T_5"] = @benchmarkable _each_element($S)
+end
+
+# ----------------------------------------------------------------------------
+# Element products: 4096 products of transformations of degree 8 and 32
+# ----------------------------------------------------------------------------
+
+_has(:PackedElementVector, :batch_multiply!) && let g = _group!("products")
+    rng = Random.MersenneTwister(2026)
+    for n in (8, 32)
+        xs = [Transf(rand(rng, 1:n, n)) for _ = 1:4096]
+        ys = [Transf(rand(rng, 1:n, n)) for _ = 1:4096]
+        pxs, pys = PackedElementVector(xs), PackedElementVector(ys)
+        g["native"]["batch_multiply! degree $n"] =
+            @benchmarkable batch_multiply!(out, $pxs, $pys) setup = (out = similar($pxs))
+        g["ffi"]["* degree $n"] =
+            @benchmarkable _each_product!(out, $xs, $ys) setup = (out = similar($xs))
+    end
+end
+
+# ----------------------------------------------------------------------------
+# ToddCoxeter: stylic (the plactic monoid with idempotent generators),
+# Brauer and full transformation monoids
+# ----------------------------------------------------------------------------
+
+const _TODD_COXETER_PRESENTATIONS = [
+    "stylic_monoid(5)" => () -> stylic_monoid(5),
+    "brauer_monoid(5)" => () -> brauer_monoid(5),
+    "full_transformation_monoid(5)" => () -> full_transformation_monoid(5),
+]
+
+let g = _group!("todd_coxeter")
+    for (name, make) in _TODD_COXETER_PRESENTATIONS
+        p = make()
+        g["native"]["number_of_classes $name"] = @benchmarkable(
+            number_of_classes(tc),
+            setup = (tc = ToddCoxeter(twosided, $p)),
+            evals = 1
+        )
+    end
+    p = brauer_monoid(5)
+    tc = ToddCoxeter(twosided, p)
+    number_of_classes(tc)
+    words = _random_words(p, 1000, 20)
+    if _has(:batch_reduce)
+        g["native"]["batch_reduce brauer_monoid(5)"] =
+            @benchmarkable batch_reduce($tc, $words)
+    end
+    g["ffi"]["reduce brauer_monoid(5)"] = @benchmarkable _each_reduce($tc, $words)
+end
+
+# ----------------------------------------------------------------------------
+# KnuthBendix: plactic, stylic and Brauer monoids. The plactic monoid of rank
+# 3 is infinite, but has a finite complete rewriting system for shortlex.
+# ----------------------------------------------------------------------------
+
+const _KNUTH_BENDIX_PRESENTATIONS = [
+    "plactic_monoid(3)" => () -> plactic_monoid(3),
+    "stylic_monoid(4)" => () -> stylic_monoid(4),
+    "brauer_monoid(4)" => () -> brauer_monoid(4),
+]
+
+let g = _group!("knuth_bendix")
+    for (name, make) in _KNUTH_BENDIX_PRESENTATIONS
+        p = make()
+        g["native"]["run! $name"] =
+            @benchmarkable run!(kb) setup = (kb = KnuthBendix(twosided, $p)) evals = 1
+    end
+    p = plactic_monoid(3)
+    kb = run!(KnuthBendix(twosided, p))
+    words = _random_words(p, 1000, 20)
+    if _has(:batch_reduce)
+        g["native"]["batch_reduce plactic_monoid(3)"] =
+            @benchmarkable batch_reduce($kb, $words)
+    end
+    g["ffi"]["reduce plactic_monoid(3)"] = @benchmarkable _each_reduce($kb, $words)
+end
+
+# ----------------------------------------------------------------------------
+# Congruence: races between the default runners
+# ----------------------------------------------------------------------------
+
+const _CONGRUENCE_PRESENTATIONS = [
+    "stylic_monoid(4)" => () -> stylic_monoid(4),
+    "brauer_monoid(4)" => () -> brauer_monoid(4),
+    "full_transformation_monoid(4)" => () -> full_transformation_monoid(4),
+]
+
+_has(:Congruence) && let g = _group!("congruence"; ffi = false)
+    for (name, make) in _CONGRUENCE_PRESENTATIONS
+        p = make()
+        g["native"]["number_of_classes $name"] = @benchmarkable(
+            number_of_classes(c),
+            setup = (c = Congruence(twosided, $p)),
+            evals = 1
+        )
+    end
+end
+
+# ----------------------------------------------------------------------------
+# Paths: counting the paths of length at most 8 in the right Cayley graph of
+# the full transformation monoid of degree 4
+# ----------------------------------------------------------------------------
+
+# right_cayley_graph borrows the graph from its FroidurePin, which must
+# outlive every Paths over it.
+const _PATHS_MONOID = FroidurePin(_full_transformation_generators(4))
+
+let g = _group!("paths")
+    graph = right_cayley_graph(_PATHS_MONOID)
+    fresh() = paths(graph; source = 1, max = 8)
+    g["native"]["count"] = @benchmarkable count(p) setup = (p = $fresh()) evals = 1
+    for nthreads in (1, 4)
+        _has(:number_of_paths) || break
+        g["native"]["number_of_paths nthreads = $nthreads"] =
+            @benchmarkable number_of_paths(p; nthreads = $nthreads) setup = (p = $fresh())
+    end
+    g["ffi"]["iterate"] = @benchmarkable _each_path(p) setup = (p = $fresh()) evals = 1
+end
@@ -0,0 +1,98 @@
+# Copyright (c) 2026, James W. Swent
+#
+# Distributed under the terms of the GPL license version 3.
+
+# Run the benchmark suite in `benchmark/benchmarks.jl` with PkgBenchmark.
+#
+#     julia --project=benchmark benchmark/run.jl [BASELINE]
+#
+# after `Pkg.develop(path=".")` in the benchmark environment, as `make bench`
+# does; the `[sources]` entry of `benchmark/Project.toml` only does this on
+# Julia 1.11 and later.
+#
+# Benchmarks the working tree and writes the results to
+# `benchmark/results/<commit>.json`, where <commit> is the short hash of
+# HEAD, with `-dirty` appended if the tree has uncommitted changes. If a
+# git ref BASELINE is given, it is benchmarked too (from a clean checkout,
+# so the tree must have no uncommitted changes), its results are written
+# in the same way, and a comparison of the two is written to
+# `benchmark/results/<commit>-vs-<baseline>.md` and printed.
+#
+# The baseline is benchmarked with the suite of the working tree, not its
+# own, so BASELINE need not contain `benchmark/benchmarks.jl`. Benchmarks of
+# functions that BASELINE does not define are skipped there (see `_has` in
+# the suite), and only the benchmarks run on both sides are compared.
+#
+# Result files are PkgBenchmark's JSON, so any two of them can be compared
+# later with `judge(readresults(a), readresults(b))`.
+
+using BenchmarkTools: BenchmarkGroup
+using PkgBenchmark
+using Semigroups
+
+const ROOT = dirname(@__DIR__)
+const RESULTS = joinpath(@__DIR__, "results")
+
+_git(args...) = readchomp(Cmd(`git $args`; dir = ROOT))
+
+function _commit(ref::AbstractString = "HEAD")
+    id = _git("rev-parse", "--short", ref)
+    if ref == "HEAD" && !isempty(_git("status", "--porcelain", "--untracked-files=no"))
+        id *= "-dirty"
+    end
+    return id
+end
+
+# The suite is copied out of the tree first, since benchmarkpkg checks out
+# the ref it benchmarks.
+function _run(target, id::AbstractString, script::AbstractString)
+    file = joinpath(RESULTS, "$id.json")
+    @info "Benchmarking $id"
+    results = benchmarkpkg(Semigroups, target; script = script, resultfile = file)
+    @info "Results written to $file"
+    return results
+end
+
+# The benchmarks of `group` that are also in `other`.
+function _common(group::BenchmarkGroup, other::BenchmarkGroup)
+    result = similar(group)
+    for (k, v) in group
+        haskey(other, k) || continue
+        if v isa BenchmarkGroup
+            result[k] = _common(v, other[k])
+        else
+            result[k] = v
+        end
+    end
+    return result
+end
+
+# `results` with only the benchmarks that are also in `other`.
+function _common(results::BenchmarkResults, other::BenchmarkResults)
+    group = _common(
+        PkgBenchmark.benchmarkgroup(results),
+        PkgBenchmark.benchmarkgroup(other),
+    )
+    fields = fieldnames(BenchmarkResults)
+    return BenchmarkResults(
+        (f == :benchmarkgroup ? group : getfield(results, f) for f in fields)...,
+    )
+end
+
+function main(args)
+    mkpath(RESULTS)
+    script = joinpath(mktempdir(), "benchmarks.jl")
+    cp(joinpath(@__DIR__, "benchmarks.jl"), script)
+    id = _commit()
+    target = _run(BenchmarkConfig(), id, script)
+    isempty(args) && return
+    base_id = _commit(args[1])
+    baseline = _run(BenchmarkConfig(id = args[1]), base_id, script)
+    judgement = judge(_common(target, baseline), _common(baseline, target))
+    file = joinpath(RESULTS, "$id-vs-$base_id.md")
+    export_markdown(file, judgement)
+    print(read(file, String))
+    @info "Comparison written to $file"
+end
+
+main(ARGS)
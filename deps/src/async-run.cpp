@@ -0,0 +1,310 @@
+//
+// Semigroups.jl
+// Copyright (C) 2026, James W. Swent
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+// Non-blocking runs: a Runner is run on a native thread while Julia keeps
+// running its event loop. Progress is sampled from inside the run itself
+// (via run_until, so the counters are read by the thread that owns them)
+// and handed to Julia through an SpscRing (see async.hpp);
+// src/async-run.jl forwards it to a Channel and to report sinks.
+
+// CRITICAL: libsemigroups_julia.hpp MUST be included first (fmt consteval fix)
+#include "libsemigroups_julia.hpp"
+
+#include "async.hpp"
+
+#include <libsemigroups/froidure-pin-base.hpp>
+#include <libsemigroups/knuth-bendix-class.hpp>
+#include <libsemigroups/runner.hpp>
+#include <libsemigroups/todd-coxeter-class.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+namespace libsemigroups_julia {
+
+  namespace {
+
+    using Counters = std::array<uint64_t, 4>;
+
+    // The counters reported in each progress event; the Julia layer names
+    // them per type (see _progress_names in src/async-run.jl), and unused
+    // slots are 0.
+    Counters progress_counters(libsemigroups::FroidurePinBase const& fpb) {
+      return {fpb.current_size(),
+              fpb.current_number_of_rules(),
+              fpb.current_max_word_length(),
+              0};
+    }
+
+    template <typename Word, typename Rewriter, typename Order>
+    Counters progress_counters(
+        libsemigroups::KnuthBendix<Word, Rewriter, Order> const& kb) {
+      return {kb.number_of_active_rules(),
+              kb.number_of_inactive_rules(),
+              kb.number_of_pending_rules(),
+              kb.total_rules()};
+    }
+
+    template <typename Word>
+    Counters progress_counters(libsemigroups::ToddCoxeter<Word> const& tc) {
+      auto const& wg = tc.current_word_graph();
+      return {wg.number_of_nodes(), wg.number_of_edges(), 0, 0};
+    }
+
+    Counters progress_counters(libsemigroups::Runner const&) {
+      return {0, 0, 0, 0};
+    }
+
+  }  // namespace
+
+  class AsyncRun {
+   public:
+    // How the run stood when an event was recorded. Every event but the
+    // last is `running`.
+    enum class phase : int64_t {
+      running   = 0,
+      finished  = 1,
+      killed    = 2,
+      timed_out = 3,
+      stopped   = 4,
+      failed    = 5
+    };
+
+    struct Event {
+      int64_t  elapsed;
+      int64_t  cpu_time;
+      phase    state;
+      Counters counters;
+    };
+
+    static constexpr size_t event_width = 3 + std::tuple_size_v<Counters>;
+
+    // A negative timeout means run to completion. The runner must outlive
+    // the AsyncRun and must not be used by anything else until done().
+    template <typename Thing>
+    AsyncRun(Thing&  runner,
+             int64_t interval,
+             int64_t timeout,
+             size_t  capacity,
+             void*   handle,
+             void*   send)
+        : _done(false),
+          _error(),
+          _events(capacity),
+          _final(),
+          _final_drained(false),
+          _interval(interval),
+          _runner(runner),
+          _sampler([&runner]() { return progress_counters(runner); }),
+          _timeout(timeout),
+          _wakeup(handle, send),
+          _thread([this]() { work(); }) {}
+
+    AsyncRun(AsyncRun const&)            = delete;
+    AsyncRun& operator=(AsyncRun const&) = delete;
+
+    // The handle is usually finalised long after the run stopped, and
+    // killing a finished runner would make it report !finished().
+    ~AsyncRun() {
+      if (!done()) {
+        kill();
+      }
+      join();
+    }
+
+    bool done() const noexcept {
+      return _done.load(std::memory_order_acquire);
+    }
+
+    void kill() {
+      _runner.kill();
+    }
+
+    void join() {
+      if (_thread.joinable()) {
+        _thread.join();
+      }
+    }
+
+    // Pending events flattened as (elapsed, cpu_time, phase, counters...),
+    // event_width values per event. The final event is held outside the
+    // ring, so that it is never dropped, and is returned by the first call
+    // made once done(), after every event still in the ring.
+    std::vector<int64_t> drain() {
+      bool const           stopped = done();
+      std::vector<int64_t> out;
+      Event                e;
+      while (_events.pop(e)) {
+        append(out, e);
+      }
+      if (stopped && !_final_drained) {
+        append(out, _final);
+        _final_drained = true;
+      }
+      return out;
+    }
+
+    size_t dropped() const noexcept {
+      return _events.dropped();
+    }
+
+    // Only valid once done().
+    std::string const& error() const noexcept {
+      return _error;
+    }
+
+   private:
+    static void append(std::vector<int64_t>& out, Event const& e) {
+      out.push_back(e.elapsed);
+      out.push_back(e.cpu_time);
+      out.push_back(static_cast<int64_t>(e.state));
+      for (auto c : e.counters) {
+        out.push_back(static_cast<int64_t>(c));
+      }
+    }
+
+    void work() {
+      using clock = std::chrono::steady_clock;
+      auto const start     = clock::now();
+      auto const cpu_start = thread_cpu_time();
+      auto       last      = start;
+      bool       failed    = false;
+
+      auto event = [&](clock::time_point now, phase state) {
+        auto elapsed
+            = std::chrono::duration_cast<std::chrono::nanoseconds>(now - start);
+        return Event{elapsed.count(),
+                     (thread_cpu_time() - cpu_start).count(),
+                     state,
+                     _sampler()};
+      };
+
+      try {
+        _runner.run_until([&]() -> bool {
+          auto now = clock::now();
+          if (now - last >= _interval) {
+            last = now;
+            _events.push(event(now, phase::running));
+            _wakeup();
+          }
+          return _timeout.count() >= 0 && now - start >= _timeout;
+        });
+      } catch (std::exception const& e) {
+        _error = e.what();
+        failed = true;
+      }
+      phase state = phase::stopped;
+      if (failed) {
+        state = phase::failed;
+      } else if (_runner.finished()) {
+        state = phase::finished;
+      } else if (_runner.dead()) {
+        state = phase::killed;
+      } else if (_runner.stopped_by_predicate()) {
+        state = phase::timed_out;
+      }
+      _final = event(clock::now(), state);
+      _done.store(true, std::memory_order_release);
+      _wakeup();
+    }
+
+    std::atomic<bool>         _done;
+    std::string               _error;
+    SpscRing<Event>           _events;
+    // Written by the thread before _done is set, read by drain() after.
+    Event                     _final;
+    bool                      _final_drained;
+    std::chrono::nanoseconds  _interval;
+    libsemigroups::Runner&    _runner;
+    std::function<Counters()> _sampler;
+    std::chrono::nanoseconds  _timeout;
+    JuliaWakeup               _wakeup;
+    // Last, so that everything the thread uses is initialised first.
+    std::thread _thread;
+  };
+
+}  // namespace libsemigroups_julia
+
+namespace jlcxx {
+  template <>
+  struct IsMirroredType<libsemigroups_julia::AsyncRun> : std::false_type {};
+}  // namespace jlcxx
+
+namespace libsemigroups_julia {
+
+  void define_async_run(jl::Module& m) {
+    using libsemigroups::FroidurePinBase;
+    using libsemigroups::Runner;
+    using libsemigroups::ToddCoxeter;
+    using libsemigroups::word_type;
+
+    using KB = libsemigroups::KnuthBendix<word_type,
+                                          libsemigroups::detail::RewriteTrie,
+                                          libsemigroups::ShortLexCompare>;
+    using KBFromLeft
+        = libsemigroups::KnuthBendix<word_type,
+                                     libsemigroups::detail::RewriteFromLeft,
+                                     libsemigroups::ShortLexCompare>;
+
+    // Constructed as AsyncRun(runner, interval_ns, timeout_ns, capacity,
+    // handle, send), where handle / send are a Base.AsyncCondition's handle
+    // and the address of uv_async_send. The most specific overload picks
+    // which counters are sampled.
+    auto type = m.add_type<AsyncRun>("AsyncRun");
+    type.constructor<FroidurePinBase&,
+                     int64_t,
+                     int64_t,
+                     size_t,
+                     void*,
+                     void*>();
+    type.constructor<KB&, int64_t, int64_t, size_t, void*, void*>();
+    type.constructor<KBFromLeft&, int64_t, int64_t, size_t, void*, void*>();
+    type.constructor<ToddCoxeter<word_type>&,
+                     int64_t,
+                     int64_t,
+                     size_t,
+                     void*,
+                     void*>();
+    type.constructor<Runner&, int64_t, int64_t, size_t, void*, void*>();
+
+    type.method("done",
+                [](AsyncRun const& self) -> bool { return self.done(); });
+    type.method("kill!", [](AsyncRun& self) { self.kill(); });
+    type.method("join!", [](AsyncRun& self) { self.join(); });
+    type.method("drain!", [](AsyncRun& self) -> std::vector<int64_t> {
+      return self.drain();
+    });
+    m.set_const("async_run_event_width", AsyncRun::event_width);
+    type.method("dropped", [](AsyncRun const& self) -> size_t {
+      return self.dropped();
+    });
+    type.method("error", [](AsyncRun const& self) -> std::string {
+      return self.error();
+    });
+  }
+
+}  // namespace libsemigroups_julia
@@ -0,0 +1,119 @@
+//
+// Semigroups.jl
+// Copyright (C) 2026, James W. Swent
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+// Waking Julia tasks from native threads. Julia cannot be called from a
+// thread it did not start, so work finished on a std::thread is handed
+// back by signalling a Base.AsyncCondition: Julia passes the condition's
+// libuv handle together with the address of uv_async_send (which libuv
+// documents as safe to call from any thread), and the waiting task drains
+// whatever was finished. libuv coalesces signals, so one wake-up may cover
+// several finished items.
+
+#ifndef LIBSEMIGROUPS_JULIA_ASYNC_HPP_
+#define LIBSEMIGROUPS_JULIA_ASYNC_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <vector>
+
+namespace libsemigroups_julia {
+
+  // CPU time used by the calling thread, where the platform can measure it,
+  // and by the whole process otherwise.
+  inline std::chrono::nanoseconds thread_cpu_time() noexcept {
+#if defined(CLOCK_THREAD_CPUTIME_ID)
+    timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return std::chrono::seconds(ts.tv_sec)
+           + std::chrono::nanoseconds(ts.tv_nsec);
+#else
+    return std::chrono::nanoseconds(static_cast<int64_t>(
+        static_cast<double>(std::clock()) * 1e9 / CLOCKS_PER_SEC));
+#endif
+  }
+
+  class JuliaWakeup {
+   public:
+    JuliaWakeup() noexcept : _handle(nullptr), _send(nullptr) {}
+
+    JuliaWakeup(void* handle, void* send) noexcept
+        : _handle(handle), _send(reinterpret_cast<int (*)(void*)>(send)) {}
+
+    void operator()() const noexcept {
+      if (_send != nullptr) {
+        _send(_handle);
+      }
+    }
+
+   private:
+    void* _handle;
+    int (*_send)(void*);
+  };
+
+  // A fixed-capacity lock-free queue with exactly one producer thread and
+  // one consumer thread. When full, push drops the new item and counts it
+  // rather than blocking the producer (typically an algorithm's hot loop).
+  template <typename T>
+  class SpscRing {
+   public:
+    explicit SpscRing(size_t capacity)
+        : _buffer(capacity + 1), _dropped(0), _head(0), _tail(0) {}
+
+    bool push(T const& item) noexcept {
+      size_t tail = _tail.load(std::memory_order_relaxed);
+      size_t next = advance(tail);
+      if (next == _head.load(std::memory_order_acquire)) {
+        _dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+      }
+      _buffer[tail] = item;
+      _tail.store(next, std::memory_order_release);
+      return true;
+    }
+
+    bool pop(T& item) noexcept {
+      size_t head = _head.load(std::memory_order_relaxed);
+      if (head == _tail.load(std::memory_order_acquire)) {
+        return false;
+      }
+      item = _buffer[head];
+      _head.store(advance(head), std::memory_order_release);
+      return true;
+    }
+
+    size_t dropped() const noexcept {
+      return _dropped.load(std::memory_order_relaxed);
+    }
+
+   private:
+    size_t advance(size_t i) const noexcept {
+      return i + 1 == _buffer.size() ? 0 : i + 1;
+    }
+
+    std::vector<T>      _buffer;
+    std::atomic<size_t> _dropped;
+    std::atomic<size_t> _head;
+    std::atomic<size_t> _tail;
+  };
+
+}  // namespace libsemigroups_julia
+
+#endif  // LIBSEMIGROUPS_JULIA_ASYNC_HPP_
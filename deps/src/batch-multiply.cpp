@@ -0,0 +1,277 @@
+//
+// Semigroups.jl
+// Copyright (C) 2026, James W. Swent
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+// Batched products of elements stored contiguously, see
+// `src/packed-elements.jl`. The elements never become C++ objects: every
+// kernel reads and writes the flat Julia buffers in place, so a batch costs
+// one call across the boundary and no allocations.
+//
+// Transformations, partial permutations and permutations share a kernel,
+// since all three are stored as their raw (0-based) images of degree d,
+// one element after another, with UNDEFINED (typemax) for undefined points.
+// The product xy maps i to y[x[i]], and to UNDEFINED if x[i] is undefined.
+//
+// For uint8_t images of degree at most 16, an element fits in one 128-bit
+// register and xy is a single byte shuffle of y by x (pshufb on x86, tbl on
+// AArch64). The x86 version is compiled for SSSE3 and selected at run
+// time, so the library itself still targets the baseline instruction set.
+//
+// BMat8 products use libsemigroups' BMat8::operator*, which is already
+// bit-parallel; the batch removes the per-product call overhead.
+
+// CRITICAL: libsemigroups_julia.hpp MUST be included first (fmt consteval fix)
+#include "libsemigroups_julia.hpp"
+
+#include <libsemigroups/bmat8.hpp>
+#include <libsemigroups/constants.hpp>
+#include <libsemigroups/exception.hpp>
+
+#include <jlcxx/array.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <vector>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define LIBSEMIGROUPS_JULIA_SHUFFLE_SSSE3
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#define LIBSEMIGROUPS_JULIA_SHUFFLE_NEON
+#endif
+
+namespace libsemigroups_julia {
+
+  namespace {
+
+    // The shape of a batched product: n results, each combining element k of
+    // x and element k of y, where an operand with a single element is used
+    // for every k.
+    struct BatchShape {
+      size_t n;
+      size_t x_stride;
+      size_t y_stride;
+    };
+
+    BatchShape batch_shape(size_t out, size_t nx, size_t ny) {
+      if (nx != ny && nx != 1 && ny != 1) {
+        throw libsemigroups::LibsemigroupsException(
+            __FILE__,
+            __LINE__,
+            __func__,
+            "expected operands of equal length, or of length 1, found "
+                + std::to_string(nx) + " and " + std::to_string(ny));
+      }
+      size_t const n = (nx == 1 ? ny : nx);
+      if (out != n) {
+        throw libsemigroups::LibsemigroupsException(
+            __FILE__,
+            __LINE__,
+            __func__,
+            "expected an output of length " + std::to_string(n) + ", found "
+                + std::to_string(out));
+      }
+      return {n, static_cast<size_t>(nx != 1), static_cast<size_t>(ny != 1)};
+    }
+
+    size_t number_of_elements(size_t size, size_t degree) {
+      if (degree == 0 || size % degree != 0) {
+        throw libsemigroups::LibsemigroupsException(
+            __FILE__,
+            __LINE__,
+            __func__,
+            "expected a buffer whose length is a multiple of the degree "
+                + std::to_string(degree) + ", found "
+                + std::to_string(size));
+      }
+      return size / degree;
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+    // Partial transformations — portable kernel
+    ////////////////////////////////////////////////////////////////////////
+
+    // Images that are not points of the degree (UNDEFINED, and anything
+    // else out of range) are mapped to UNDEFINED rather than read past y.
+    template <typename Scalar>
+    void compose(Scalar*              out,
+                 Scalar const*        xs,
+                 Scalar const*        ys,
+                 BatchShape           shape,
+                 size_t               deg,
+                 std::vector<Scalar>& tmp) {
+      Scalar const undef = std::numeric_limits<Scalar>::max();
+      for (size_t k = 0; k < shape.n; ++k) {
+        Scalar*       xy = out + k * deg;
+        Scalar const* x  = xs + k * shape.x_stride * deg;
+        Scalar const* y  = ys + k * shape.y_stride * deg;
+        if (y >= xy && y < xy + deg) {
+          // Multiplying in place into y, which is still being read
+          tmp.assign(y, y + deg);
+          y = tmp.data();
+        }
+        for (size_t i = 0; i < deg; ++i) {
+          Scalar const xi = x[i];
+          xy[i]           = xi < deg ? y[xi] : undef;
+        }
+      }
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+    // Partial transformations — uint8_t images of degree at most 16
+    ////////////////////////////////////////////////////////////////////////
+
+    // Both operands are loaded before the result is stored, so a result
+    // may overwrite either of them.
+
+#if defined(LIBSEMIGROUPS_JULIA_SHUFFLE_SSSE3)
+
+    __attribute__((target("ssse3"))) void compose16(uint8_t*       out,
+                                                    uint8_t const* xs,
+                                                    uint8_t const* ys,
+                                                    BatchShape     shape,
+                                                    size_t         deg) {
+      __m128i const last = _mm_set1_epi8(static_cast<char>(deg - 1));
+      __m128i const ones = _mm_set1_epi8(-1);
+      alignas(16) uint8_t bx[16] = {};
+      alignas(16) uint8_t by[16] = {};
+      for (size_t k = 0; k < shape.n; ++k) {
+        std::memcpy(bx, xs + k * shape.x_stride * deg, deg);
+        std::memcpy(by, ys + k * shape.y_stride * deg, deg);
+        __m128i const x = _mm_load_si128(reinterpret_cast<__m128i const*>(bx));
+        __m128i const y = _mm_load_si128(reinterpret_cast<__m128i const*>(by));
+        // 0xFF where x[i] <= deg - 1
+        __m128i const valid = _mm_cmpeq_epi8(_mm_min_epu8(x, last), x);
+        __m128i const xy    = _mm_or_si128(_mm_shuffle_epi8(y, x),
+                                        _mm_andnot_si128(valid, ones));
+        _mm_store_si128(reinterpret_cast<__m128i*>(bx), xy);
+        std::memcpy(out + k * deg, bx, deg);
+      }
+    }
+
+    bool have_shuffle() {
+      static bool const result = __builtin_cpu_supports("ssse3");
+      return result;
+    }
+
+#elif defined(LIBSEMIGROUPS_JULIA_SHUFFLE_NEON)
+
+    void compose16(uint8_t*       out,
+                   uint8_t const* xs,
+                   uint8_t const* ys,
+                   BatchShape     shape,
+                   size_t         deg) {
+      uint8x16_t const last = vdupq_n_u8(static_cast<uint8_t>(deg - 1));
+      uint8_t          bx[16] = {};
+      uint8_t          by[16] = {};
+      for (size_t k = 0; k < shape.n; ++k) {
+        std::memcpy(bx, xs + k * shape.x_stride * deg, deg);
+        std::memcpy(by, ys + k * shape.y_stride * deg, deg);
+        uint8x16_t const x     = vld1q_u8(bx);
+        uint8x16_t const y     = vld1q_u8(by);
+        uint8x16_t const valid = vcleq_u8(x, last);
+        uint8x16_t const xy    = vorrq_u8(vqtbl1q_u8(y, x), vmvnq_u8(valid));
+        vst1q_u8(bx, xy);
+        std::memcpy(out + k * deg, bx, deg);
+      }
+    }
+
+    bool have_shuffle() {
+      return true;
+    }
+
+#else
+
+    void
+    compose16(uint8_t*, uint8_t const*, uint8_t const*, BatchShape, size_t) {}
+
+    bool have_shuffle() {
+      return false;
+    }
+
+#endif
+
+    template <typename Scalar>
+    void batch_multiply(jlcxx::ArrayRef<Scalar>       out,
+                        jlcxx::ArrayRef<Scalar> const xs,
+                        jlcxx::ArrayRef<Scalar> const ys,
+                        size_t                        deg) {
+      BatchShape const shape = batch_shape(number_of_elements(out.size(), deg),
+                                           number_of_elements(xs.size(), deg),
+                                           number_of_elements(ys.size(), deg));
+      // An operand used for every product is copied first, in case it is
+      // one of the results, which would otherwise be overwritten.
+      Scalar const*       x = xs.data();
+      Scalar const*       y = ys.data();
+      std::vector<Scalar> x1, y1, tmp;
+      if (shape.x_stride == 0) {
+        x1.assign(x, x + deg);
+        x = x1.data();
+      }
+      if (shape.y_stride == 0) {
+        y1.assign(y, y + deg);
+        y = y1.data();
+      }
+      if constexpr (sizeof(Scalar) == 1) {
+        if (deg <= 16 && have_shuffle()) {
+          compose16(out.data(), x, y, shape, deg);
+          return;
+        }
+      }
+      compose(out.data(), x, y, shape, deg, tmp);
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+    // BMat8
+    ////////////////////////////////////////////////////////////////////////
+
+    void batch_multiply_bmat8(jlcxx::ArrayRef<uint64_t>       out,
+                              jlcxx::ArrayRef<uint64_t> const xs,
+                              jlcxx::ArrayRef<uint64_t> const ys) {
+      using libsemigroups::BMat8;
+      BatchShape const shape = batch_shape(out.size(), xs.size(), ys.size());
+      uint64_t const*  x     = xs.data();
+      uint64_t const*  y     = ys.data();
+      uint64_t*        xy    = out.data();
+      for (size_t k = 0; k < shape.n; ++k) {
+        xy[k] = (BMat8(x[k * shape.x_stride]) * BMat8(y[k * shape.y_stride]))
+                    .to_int();
+      }
+    }
+
+  }  // namespace
+
+  void define_batch_multiply(jl::Module& m) {
+    // Raw images of partial transformations, degree `deg` each
+    m.method("batch_multiply!", &batch_multiply<uint8_t>);
+    m.method("batch_multiply!", &batch_multiply<uint16_t>);
+    m.method("batch_multiply!", &batch_multiply<uint32_t>);
+
+    // BMat8 as to_int() values
+    m.method("batch_multiply!", &batch_multiply_bmat8);
+
+    // Whether the uint8_t kernel for degree <= 16 uses byte shuffles
+    m.method("batch_multiply_uses_shuffle", []() -> bool {
+      return have_shuffle();
+    });
+  }
+
+}  // namespace libsemigroups_julia
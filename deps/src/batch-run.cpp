@@ -0,0 +1,298 @@
+//
+// Semigroups.jl
+// Copyright (C) 2026, James W. Swent
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+// Batch runs: many independent KnuthBendix / ToddCoxeter / Congruence jobs
+// run on a pool of native threads while the calling Julia thread stays
+// free. Results are handed back through a queue that src/batch-run.jl
+// drains into a Julia Channel whenever it is woken (see async.hpp).
+
+// CRITICAL: libsemigroups_julia.hpp MUST be included first (fmt consteval fix)
+#include "libsemigroups_julia.hpp"
+
+#include "async.hpp"
+
+#include <libsemigroups/cong-class.hpp>
+#include <libsemigroups/exception.hpp>
+#include <libsemigroups/knuth-bendix-class.hpp>
+#include <libsemigroups/runner.hpp>
+#include <libsemigroups/todd-coxeter-class.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace libsemigroups_julia {
+
+  namespace {
+
+    int64_t nanoseconds_since(std::chrono::steady_clock::time_point start) {
+      return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                 std::chrono::steady_clock::now() - start)
+          .count();
+    }
+
+  }  // namespace
+
+  // Jobs are copies of the objects added, so any settings made on those
+  // objects before they were added apply. Idle workers take the next
+  // unstarted job, so long and short jobs balance across the pool.
+  class BatchRun {
+   public:
+    struct Result {
+      bool        finished          = false;
+      uint64_t    number_of_classes = 0;
+      int64_t     elapsed           = 0;
+      std::string why_stopped;
+      std::string error;
+    };
+
+    BatchRun()
+        : _cancelled(false),
+          _finished(),
+          _jobs(),
+          _mtx(),
+          _next(0),
+          _results(),
+          _threads(),
+          _wakeup() {}
+
+    BatchRun(BatchRun const&)            = delete;
+    BatchRun& operator=(BatchRun const&) = delete;
+
+    ~BatchRun() {
+      cancel();
+      join();
+    }
+
+    // A negative timeout means run to completion.
+    template <typename Thing>
+    void add(Thing const& thing, int64_t timeout) {
+      if (!_threads.empty()) {
+        throw libsemigroups::LibsemigroupsException(
+            __FILE__,
+            __LINE__,
+            __func__,
+            "cannot add a job to a batch that has already been started");
+      }
+      auto ptr = std::make_shared<Thing>(thing);
+      _jobs.push_back(
+          Job{ptr, [ptr]() { return ptr->number_of_classes(); }, timeout});
+    }
+
+    void start(size_t nthreads, void* handle, void* send) {
+      if (!_threads.empty()) {
+        throw libsemigroups::LibsemigroupsException(
+            __FILE__, __LINE__, __func__, "the batch has already been started");
+      }
+      if (nthreads == 0) {
+        throw libsemigroups::LibsemigroupsException(
+            __FILE__,
+            __LINE__,
+            __func__,
+            "the number of threads must be positive, found 0");
+      }
+      _results.assign(_jobs.size(), Result());
+      _wakeup = JuliaWakeup(handle, send);
+      nthreads = std::min(nthreads, std::max(_jobs.size(), size_t(1)));
+      for (size_t i = 0; i < nthreads; ++i) {
+        _threads.emplace_back([this]() { work(); });
+      }
+    }
+
+    // Stops every job that has not finished; jobs not yet started are
+    // reported as cancelled without being run.
+    void cancel() {
+      _cancelled = true;
+      for (auto& job : _jobs) {
+        job.runner->kill();
+      }
+    }
+
+    void join() {
+      for (auto& t : _threads) {
+        if (t.joinable()) {
+          t.join();
+        }
+      }
+    }
+
+    size_t number_of_jobs() const noexcept {
+      return _jobs.size();
+    }
+
+    // The index of a job finished since the last call, or UNDEFINED.
+    size_t pop_finished() {
+      std::lock_guard<std::mutex> lock(_mtx);
+      if (_finished.empty()) {
+        return libsemigroups::UNDEFINED;
+      }
+      size_t i = _finished.front();
+      _finished.pop_front();
+      return i;
+    }
+
+    // Only valid for indices returned by pop_finished.
+    Result const& result(size_t i) const {
+      if (i >= _results.size()) {
+        throw libsemigroups::LibsemigroupsException(
+            __FILE__,
+            __LINE__,
+            __func__,
+            "job index out of bounds, expected value in [0, "
+                + std::to_string(_results.size()) + "), found "
+                + std::to_string(i));
+      }
+      return _results[i];
+    }
+
+   private:
+    struct Job {
+      std::shared_ptr<libsemigroups::Runner> runner;
+      std::function<uint64_t()>              number_of_classes;
+      int64_t                                timeout;
+    };
+
+    void work() {
+      for (size_t i = _next++; i < _jobs.size(); i = _next++) {
+        auto&   job = _jobs[i];
+        Result& res = _results[i];
+        if (_cancelled) {
+          res.why_stopped = "cancelled before starting";
+        } else {
+          auto start = std::chrono::steady_clock::now();
+          try {
+            if (job.timeout < 0) {
+              job.runner->run();
+            } else {
+              job.runner->run_for(std::chrono::nanoseconds(job.timeout));
+            }
+            res.finished = job.runner->finished();
+            if (res.finished) {
+              res.number_of_classes = job.number_of_classes();
+            }
+          } catch (std::exception const& e) {
+            res.error = e.what();
+          }
+          res.elapsed     = nanoseconds_since(start);
+          res.why_stopped = job.runner->string_why_we_stopped();
+        }
+        {
+          std::lock_guard<std::mutex> lock(_mtx);
+          _finished.push_back(i);
+        }
+        _wakeup();
+      }
+    }
+
+    std::atomic<bool>        _cancelled;
+    std::deque<size_t>       _finished;
+    std::vector<Job>         _jobs;
+    std::mutex               _mtx;
+    std::atomic<size_t>      _next;
+    std::vector<Result>      _results;
+    std::vector<std::thread> _threads;
+    JuliaWakeup              _wakeup;
+  };
+
+}  // namespace libsemigroups_julia
+
+namespace jlcxx {
+  template <>
+  struct IsMirroredType<libsemigroups_julia::BatchRun> : std::false_type {};
+}  // namespace jlcxx
+
+namespace libsemigroups_julia {
+
+  void define_batch_run(jl::Module& m) {
+    using libsemigroups::Congruence;
+    using libsemigroups::ToddCoxeter;
+    using libsemigroups::word_type;
+
+    using KB = libsemigroups::KnuthBendix<word_type,
+                                          libsemigroups::detail::RewriteTrie,
+                                          libsemigroups::ShortLexCompare>;
+    using KBFromLeft
+        = libsemigroups::KnuthBendix<word_type,
+                                     libsemigroups::detail::RewriteFromLeft,
+                                     libsemigroups::ShortLexCompare>;
+
+    auto type = m.add_type<BatchRun>("BatchRun");
+    type.constructor<>();
+
+    type.method("add_job!",
+                [](BatchRun& self, ToddCoxeter<word_type> const& x, int64_t t) {
+                  self.add(x, t);
+                });
+    type.method("add_job!", [](BatchRun& self, KB const& x, int64_t t) {
+      self.add(x, t);
+    });
+    type.method("add_job!",
+                [](BatchRun& self, KBFromLeft const& x, int64_t t) {
+                  self.add(x, t);
+                });
+    type.method("add_job!",
+                [](BatchRun& self, Congruence<word_type> const& x, int64_t t) {
+                  self.add(x, t);
+                });
+
+    // handle / send are a Base.AsyncCondition's handle and the address of
+    // uv_async_send.
+    type.method("start!",
+                [](BatchRun& self, size_t nthreads, void* handle, void* send) {
+                  self.start(nthreads, handle, send);
+                });
+    type.method("cancel!", [](BatchRun& self) { self.cancel(); });
+    type.method("join!", [](BatchRun& self) { self.join(); });
+    type.method("number_of_jobs", [](BatchRun const& self) -> size_t {
+      return self.number_of_jobs();
+    });
+    type.method("pop_finished!",
+                [](BatchRun& self) -> size_t { return self.pop_finished(); });
+
+    type.method("result_finished", [](BatchRun const& self, size_t i) -> bool {
+      return self.result(i).finished;
+    });
+    type.method("result_number_of_classes",
+                [](BatchRun const& self, size_t i) -> uint64_t {
+                  return self.result(i).number_of_classes;
+                });
+    type.method("result_elapsed",
+                [](BatchRun const& self, size_t i) -> int64_t {
+                  return self.result(i).elapsed;
+                });
+    type.method("result_why_stopped",
+                [](BatchRun const& self, size_t i) -> std::string {
+                  return self.result(i).why_stopped;
+                });
+    type.method("result_error",
+                [](BatchRun const& self, size_t i) -> std::string {
+                  return self.result(i).error;
+                });
+  }
+
+}  // namespace libsemigroups_julia
@@ -0,0 +1,137 @@
+//
+// Semigroups.jl
+// Copyright (C) 2026, James W. Swent
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+// The counters of binding-profile.hpp, and the bindings that read them.
+// Counters are made while the modules are registered, including the
+// FroidurePin module on first use, and never removed, so entry i is always
+// the same method once it exists.
+
+// CRITICAL: libsemigroups_julia.hpp MUST be included first (fmt consteval fix)
+#include "libsemigroups_julia.hpp"
+
+#include "binding-profile.hpp"
+
+#include <libsemigroups/exception.hpp>
+
+#include <jlcxx/array.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+
+namespace libsemigroups_julia {
+
+  namespace {
+
+    struct BindingRegistry {
+      std::mutex mutex;
+      // A deque, so that counters never move once made
+      std::deque<std::pair<std::string const, BindingCounters>> entries;
+      std::unordered_map<std::string, std::size_t>               index;
+    };
+
+    BindingRegistry& binding_registry() {
+      static BindingRegistry registry;
+      return registry;
+    }
+
+    std::pair<std::string const, BindingCounters>&
+    binding_entry(BindingRegistry& registry, std::size_t i) {
+      if (i >= registry.entries.size()) {
+        throw libsemigroups::LibsemigroupsException(
+            __FILE__,
+            __LINE__,
+            __func__,
+            "expected a value in the range [0, "
+                + std::to_string(registry.entries.size()) + "), found "
+                + std::to_string(i));
+      }
+      return registry.entries[i];
+    }
+
+  }  // namespace
+
+  BindingCounters& binding_counters(std::string const& key) {
+    BindingRegistry&            registry = binding_registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    auto [it, inserted] = registry.index.emplace(key, registry.entries.size());
+    if (inserted) {
+      registry.entries.emplace_back(std::piecewise_construct,
+                                    std::forward_as_tuple(key),
+                                    std::forward_as_tuple());
+    }
+    return registry.entries[it->second].second;
+  }
+
+  void define_binding_profile(jl::Module& m) {
+    m.method("binding_profile_enabled", []() -> bool {
+#ifdef LIBSEMIGROUPS_JULIA_PROFILE
+      return true;
+#else
+      return false;
+#endif
+    });
+
+    m.method("binding_profile_size", []() -> std::size_t {
+      BindingRegistry&            registry = binding_registry();
+      std::lock_guard<std::mutex> lock(registry.mutex);
+      return registry.entries.size();
+    });
+
+    m.method("binding_profile_name", [](std::size_t i) -> std::string {
+      BindingRegistry&            registry = binding_registry();
+      std::lock_guard<std::mutex> lock(registry.mutex);
+      return binding_entry(registry, i).first;
+    });
+
+    // Write the calls, bytes copied and nanoseconds of entry i to out
+    m.method("binding_profile_counters!",
+             [](std::size_t i, jlcxx::ArrayRef<uint64_t> out) {
+               if (out.size() != 3) {
+                 throw libsemigroups::LibsemigroupsException(
+                     __FILE__,
+                     __LINE__,
+                     __func__,
+                     "expected an output buffer of length 3, found "
+                         + std::to_string(out.size()));
+               }
+               BindingRegistry&            registry = binding_registry();
+               std::lock_guard<std::mutex> lock(registry.mutex);
+               BindingCounters& counters = binding_entry(registry, i).second;
+               out[0] = counters.calls.load(std::memory_order_relaxed);
+               out[1] = counters.bytes_copied.load(std::memory_order_relaxed);
+               out[2] = counters.nanoseconds.load(std::memory_order_relaxed);
+             });
+
+    m.method("binding_profile_reset!", []() {
+      BindingRegistry&            registry = binding_registry();
+      std::lock_guard<std::mutex> lock(registry.mutex);
+      for (auto& entry : registry.entries) {
+        entry.second.calls.store(0, std::memory_order_relaxed);
+        entry.second.bytes_copied.store(0, std::memory_order_relaxed);
+        entry.second.nanoseconds.store(0, std::memory_order_relaxed);
+      }
+    });
+  }
+
+}  // namespace libsemigroups_julia
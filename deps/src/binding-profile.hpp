@@ -0,0 +1,233 @@
+//
+// Semigroups.jl
+// Copyright (C) 2026, James W. Swent
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+// Opt-in instrumentation of the bindings, to tell the cost of crossing the
+// C++/Julia boundary from the cost of libsemigroups itself.
+//
+// When libsemigroups_julia is built with LIBSEMIGROUPS_JULIA_PROFILE (the
+// CMake option of the same name), every method bound through a
+// ProfiledMethods counts its calls, the time spent in it, and the bytes it
+// copies between Julia and libsemigroups' own types:
+//
+//   * words and elements copied in from Julia buffers, counted where they
+//     are copied by count_bytes_copied;
+//   * the value returned by copy, counted by returned_bytes.
+//
+// The counters are keyed by "method(type)" and read by `binding_profile()`
+// in `src/binding-profile.jl`. In the default build, ProfiledMethods binds
+// every method unchanged and count_bytes_copied does nothing.
+
+#ifndef LIBSEMIGROUPS_JULIA_BINDING_PROFILE_HPP_
+#define LIBSEMIGROUPS_JULIA_BINDING_PROFILE_HPP_
+
+// CRITICAL: libsemigroups_julia.hpp MUST be included first (fmt consteval fix)
+#include "libsemigroups_julia.hpp"
+
+#include "packed-words.hpp"
+
+#include <libsemigroups/bmat8.hpp>
+
+#include <jlcxx/array.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace libsemigroups_julia {
+
+  struct BindingCounters {
+    std::atomic<uint64_t> calls{0};
+    std::atomic<uint64_t> bytes_copied{0};
+    std::atomic<uint64_t> nanoseconds{0};
+  };
+
+  // The counters of the bound method `key`, made on first use, which live
+  // as long as the library; see binding-profile.cpp.
+  BindingCounters& binding_counters(std::string const& key);
+
+  // The name of the Julia type bound for T, which must be registered.
+  template <typename T>
+  std::string julia_type_label() {
+    return jl_symbol_name(jlcxx::julia_type<T>()->name->name);
+  }
+
+  namespace detail {
+
+    template <typename T>
+    struct is_std_vector : std::false_type {};
+
+    template <typename T, typename A>
+    struct is_std_vector<std::vector<T, A>> : std::true_type {};
+
+    template <typename T, typename = void>
+    struct has_point_type : std::false_type {};
+
+    template <typename T>
+    struct has_point_type<T, std::void_t<typename T::point_type>>
+        : std::true_type {};
+
+#ifdef LIBSEMIGROUPS_JULIA_PROFILE
+    // The counters of the innermost profiled call on this thread
+    inline thread_local BindingCounters* current_binding = nullptr;
+#endif
+
+  }  // namespace detail
+
+  // The bytes of `x` copied when it is returned to Julia: the words,
+  // images or letters of a container or element, the 8 bytes of a BMat8,
+  // and nothing for a scalar or for another bound object, which is moved.
+  template <typename T>
+  uint64_t returned_bytes(T const& x) {
+    if constexpr (std::is_same_v<T, PackedWords>) {
+      return x.letters.size() * sizeof(std::size_t)
+             + (x.offsets.size() + x.groups.size()) * sizeof(uint64_t);
+    } else if constexpr (std::is_same_v<T, std::string>) {
+      return x.size();
+    } else if constexpr (detail::is_std_vector<T>::value) {
+      using Value = typename T::value_type;
+      if constexpr (std::is_arithmetic_v<Value>) {
+        return x.size() * sizeof(Value);
+      } else {
+        uint64_t result = 0;
+        for (auto const& y : x) {
+          result += returned_bytes(y);
+        }
+        return result;
+      }
+    } else if constexpr (detail::has_point_type<T>::value) {
+      return x.degree() * sizeof(typename T::point_type);
+    } else if constexpr (std::is_same_v<T, libsemigroups::BMat8>) {
+      return sizeof(libsemigroups::BMat8);
+    } else {
+      return 0;
+    }
+  }
+
+  // Count n bytes copied against the innermost profiled call on this
+  // thread, if any. Calls on threads started by a binding count nothing, so
+  // batches count their input once, before they are split.
+  inline void count_bytes_copied([[maybe_unused]] std::size_t n) noexcept {
+#ifdef LIBSEMIGROUPS_JULIA_PROFILE
+    if (detail::current_binding != nullptr) {
+      detail::current_binding->bytes_copied.fetch_add(
+          n, std::memory_order_relaxed);
+    }
+#endif
+  }
+
+  // The word in the Julia buffer w, counted as copied
+  template <typename Word>
+  Word copy_word(jlcxx::ArrayRef<std::size_t> w) {
+    count_bytes_copied(w.size() * sizeof(std::size_t));
+    return Word(w.begin(), w.end());
+  }
+
+#ifdef LIBSEMIGROUPS_JULIA_PROFILE
+
+  namespace detail {
+
+    // Counts a call, and its time, for as long as it is in scope.
+    class BindingScope {
+     public:
+      explicit BindingScope(BindingCounters& counters)
+          : _counters(counters),
+            _outer(current_binding),
+            _start(std::chrono::steady_clock::now()) {
+        current_binding = &counters;
+        _counters.calls.fetch_add(1, std::memory_order_relaxed);
+      }
+
+      BindingScope(BindingScope const&)            = delete;
+      BindingScope& operator=(BindingScope const&) = delete;
+
+      ~BindingScope() {
+        auto const elapsed = std::chrono::steady_clock::now() - _start;
+        _counters.nanoseconds.fetch_add(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed)
+                .count(),
+            std::memory_order_relaxed);
+        current_binding = _outer;
+      }
+
+     private:
+      BindingCounters&                      _counters;
+      BindingCounters*                      _outer;
+      std::chrono::steady_clock::time_point _start;
+    };
+
+    template <typename R, typename... Args>
+    std::function<R(Args...)> profiled(BindingCounters&          counters,
+                                       std::function<R(Args...)> f) {
+      return [&counters, f = std::move(f)](Args... args) -> R {
+        BindingScope scope(counters);
+        if constexpr (std::is_void_v<R> || std::is_reference_v<R>) {
+          return f(std::forward<Args>(args)...);
+        } else {
+          R result = f(std::forward<Args>(args)...);
+          count_bytes_copied(returned_bytes(result));
+          return result;
+        }
+      };
+    }
+
+  }  // namespace detail
+
+  // `f`, a lambda or function pointer, counting its calls under `key`
+  template <typename F>
+  auto profiled(std::string const& key, F&& f) {
+    return detail::profiled(binding_counters(key),
+                            std::function(std::forward<F>(f)));
+  }
+
+#endif
+
+  // Binds methods on a jl::Module& or a jlcxx::TypeWrapper<T>, as its own
+  // method does, counting each under "name(label)" in a profiling build.
+  template <typename Wrapper>
+  class ProfiledMethods {
+   public:
+    ProfiledMethods(Wrapper wrapper, std::string label)
+        : _wrapper(wrapper), _label(std::move(label)) {}
+
+    template <typename F>
+    decltype(auto) method(std::string const& name, F&& f) {
+#ifdef LIBSEMIGROUPS_JULIA_PROFILE
+      std::string const key
+          = name == _label ? name : name + "(" + _label + ")";
+      return _wrapper.method(name, profiled(key, std::forward<F>(f)));
+#else
+      return _wrapper.method(name, std::forward<F>(f));
+#endif
+    }
+
+   private:
+    Wrapper     _wrapper;
+    std::string _label;
+  };
+
+  ProfiledMethods(jl::Module&, std::string) -> ProfiledMethods<jl::Module&>;
+
+}  // namespace libsemigroups_julia
+
+#endif  // LIBSEMIGROUPS_JULIA_BINDING_PROFILE_HPP_
@@ -0,0 +1,151 @@
+//
+// Semigroups.jl
+// Copyright (C) 2026, James W. Swent
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+// Batched BMat8 helpers on to_int() values stored contiguously, see
+// `src/packed-elements.jl`. Like the products in `batch-multiply.cpp`,
+// every kernel reads and writes the flat Julia buffers in place, so a batch
+// costs one call across the boundary however many matrices it holds. The
+// helpers themselves are libsemigroups' bmat8 ones, which are already
+// bit-parallel on the 64-bit value; a batch may be split between threads.
+//
+// group_by_row_space! buckets matrices by their row space basis in one
+// pass: the bases are computed (possibly on several threads) into the
+// output buffer, and then replaced by group numbers using a hash table from
+// basis to group.
+
+// CRITICAL: libsemigroups_julia.hpp MUST be included first (fmt consteval fix)
+#include "libsemigroups_julia.hpp"
+
+#include "packed-words.hpp"
+
+#include <libsemigroups/bmat8.hpp>
+#include <libsemigroups/exception.hpp>
+
+#include <jlcxx/array.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+namespace libsemigroups_julia {
+
+  namespace {
+
+    using libsemigroups::BMat8;
+
+    void throw_if_bad_lengths(size_t out, size_t in) {
+      if (out != in) {
+        throw libsemigroups::LibsemigroupsException(
+            __FILE__,
+            __LINE__,
+            __func__,
+            "expected an output buffer of length " + std::to_string(in)
+                + ", found " + std::to_string(out));
+      }
+    }
+
+    // out[k] = f(BMat8(xs[k])) for every k, on at most nthreads threads.
+    // `out` may be the same buffer as `xs`.
+    template <typename Out, typename Func>
+    void batch_apply(jlcxx::ArrayRef<Out>            out,
+                     jlcxx::ArrayRef<uint64_t> const xs,
+                     size_t                          nthreads,
+                     Func&&                          f) {
+      throw_if_bad_lengths(out.size(), xs.size());
+      uint64_t const* x = xs.data();
+      Out*            y = out.data();
+      for_each_block(
+          xs.size(), nthreads, [&](size_t, size_t first, size_t last) {
+            for (size_t k = first; k < last; ++k) {
+              y[k] = f(BMat8(x[k]));
+            }
+          });
+    }
+
+    // Write to groups[k] the 0-based number of the group of matrices with
+    // the same row space as xs[k], numbered in order of first appearance,
+    // and the row space basis of group j to bases[j]. Returns the number of
+    // groups; bases past the last group are left untouched.
+    size_t group_by_row_space(jlcxx::ArrayRef<uint64_t>       groups,
+                              jlcxx::ArrayRef<uint64_t>       bases,
+                              jlcxx::ArrayRef<uint64_t> const xs,
+                              size_t                          nthreads) {
+      throw_if_bad_lengths(groups.size(), xs.size());
+      throw_if_bad_lengths(bases.size(), xs.size());
+      batch_apply(groups, xs, nthreads, [](BMat8 const& x) {
+        return libsemigroups::bmat8::row_space_basis(x).to_int();
+      });
+      uint64_t* g = groups.data();
+      uint64_t* b = bases.data();
+
+      std::unordered_map<uint64_t, uint64_t> index;
+      index.reserve(xs.size());
+      for (size_t k = 0; k < xs.size(); ++k) {
+        auto [it, inserted] = index.emplace(g[k], index.size());
+        if (inserted) {
+          b[it->second] = g[k];
+        }
+        g[k] = it->second;
+      }
+      return index.size();
+    }
+
+  }  // namespace
+
+  void define_bmat8_batch(jl::Module& m) {
+    namespace bmat8 = libsemigroups::bmat8;
+
+    // BMat8 as to_int() values; each writes its results to the first
+    // argument, which must have the same length as xs.
+    m.method("bmat8_batch_transpose!",
+             [](jlcxx::ArrayRef<uint64_t>       out,
+                jlcxx::ArrayRef<uint64_t> const xs,
+                size_t                          nthreads) {
+               batch_apply(out, xs, nthreads, [](BMat8 const& x) {
+                 return bmat8::transpose(x).to_int();
+               });
+             });
+    m.method("bmat8_batch_row_space_basis!",
+             [](jlcxx::ArrayRef<uint64_t>       out,
+                jlcxx::ArrayRef<uint64_t> const xs,
+                size_t                          nthreads) {
+               batch_apply(out, xs, nthreads, [](BMat8 const& x) {
+                 return bmat8::row_space_basis(x).to_int();
+               });
+             });
+    m.method("bmat8_batch_col_space_basis!",
+             [](jlcxx::ArrayRef<uint64_t>       out,
+                jlcxx::ArrayRef<uint64_t> const xs,
+                size_t                          nthreads) {
+               batch_apply(out, xs, nthreads, [](BMat8 const& x) {
+                 return bmat8::col_space_basis(x).to_int();
+               });
+             });
+    m.method("bmat8_batch_is_regular_element!",
+             [](jlcxx::ArrayRef<uint8_t>        out,
+                jlcxx::ArrayRef<uint64_t> const xs,
+                size_t                          nthreads) {
+               batch_apply(out, xs, nthreads, [](BMat8 const& x) -> uint8_t {
+                 return bmat8::is_regular_element(x);
+               });
+             });
+    m.method("bmat8_group_by_row_space!", &group_by_row_space);
+  }
+
+}  // namespace libsemigroups_julia
@@ -0,0 +1,517 @@
+//
+// Semigroups.jl
+// Copyright (C) 2026, James W. Swent
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+// Checkpoints of ToddCoxeter and KnuthBendix, so that a long enumeration
+// can be resumed after the process is lost.
+//
+// libsemigroups does not expose the internal state of either algorithm (the
+// node manager, coincidence stacks and pending rules are private), so a
+// checkpoint records what the public API allows and a resumed object is
+// rebuilt from it:
+//
+// * ToddCoxeter: the part of the current word graph reachable from node 0,
+//   renumbered in breadth-first order, plus the relations, whether the
+//   presentation contains the empty word, and every setting that the
+//   bindings expose (see save_todd_coxeter for the list). It is resumed
+//   as ToddCoxeter(twosided, presentation) with the saved graph attached,
+//   so the enumeration continues from the saved table and the classes are
+//   counted as for the original presentation.
+// * KnuthBendix, with either rewriter: the active rules, the original rules
+//   and generating pairs, and every setting that the bindings expose.
+//   Pending rules are not accessible, so the original rules are re-added
+//   and reduced again by the active ones.
+//
+// Only two-sided congruences can be resumed this way; for one-sided
+// congruences the relations hold only at node 0, which the saved table does
+// not record.
+//
+// File layout (native endianness, every section 8-byte aligned):
+//
+//   CheckpointHeader
+//   uint64_t offsets[number_of_words + 1]   word i is letters[offsets[i],
+//   uint64_t letters[number_of_letters]       offsets[i + 1]); word 0 is the
+//                                             alphabet, then rules lhs, rhs
+//   uint32_t targets[number_of_nodes * out_degree]   (ToddCoxeter only;
+//                                             row-major, UNDEFINED as ~0)
+//
+// The reader maps the file into memory and copies the sections straight
+// into the word graph and presentation, with no parsing.
+
+// CRITICAL: libsemigroups_julia.hpp MUST be included first (fmt consteval fix)
+#include "libsemigroups_julia.hpp"
+
+#include "mapped-file.hpp"
+#include "packed-words.hpp"
+
+#include <libsemigroups/cong-common-helpers.hpp>
+#include <libsemigroups/exception.hpp>
+#include <libsemigroups/knuth-bendix-class.hpp>
+#include <libsemigroups/presentation.hpp>
+#include <libsemigroups/todd-coxeter-class.hpp>
+#include <libsemigroups/word-graph.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <numeric>
+#include <string>
+#include <vector>
+
+namespace libsemigroups_julia {
+
+  namespace {
+
+    using libsemigroups::congruence_kind;
+    using libsemigroups::Presentation;
+    using libsemigroups::ToddCoxeter;
+    using libsemigroups::WordGraph;
+    using libsemigroups::word_type;
+
+    using TC     = ToddCoxeter<word_type>;
+    using TCImpl = libsemigroups::detail::ToddCoxeterImpl;
+    using KB     = libsemigroups::KnuthBendix<word_type,
+                                          libsemigroups::detail::RewriteTrie,
+                                          libsemigroups::ShortLexCompare>;
+    using KBFromLeft
+        = libsemigroups::KnuthBendix<word_type,
+                                     libsemigroups::detail::RewriteFromLeft,
+                                     libsemigroups::ShortLexCompare>;
+
+    constexpr char checkpoint_magic[8]
+        = {'S', 'G', 'J', 'L', 'C', 'K', 'P', 'T'};
+    constexpr uint32_t checkpoint_version = 1;
+
+    enum class checkpoint_algorithm : uint32_t {
+      todd_coxeter           = 1,
+      knuth_bendix           = 2,
+      knuth_bendix_from_left = 3
+    };
+
+    // The algorithm recorded for each KnuthBendix rewriter
+    template <typename Thing>
+    constexpr checkpoint_algorithm knuth_bendix_algorithm
+        = checkpoint_algorithm::knuth_bendix;
+
+    template <>
+    constexpr checkpoint_algorithm knuth_bendix_algorithm<KBFromLeft>
+        = checkpoint_algorithm::knuth_bendix_from_left;
+
+    struct CheckpointHeader {
+      char     magic[8];
+      uint32_t version;
+      uint32_t algorithm;
+      uint64_t settings[16];
+      uint64_t contains_empty_word;
+      uint64_t number_of_words;
+      uint64_t number_of_letters;
+      uint64_t number_of_nodes;
+      uint64_t out_degree;
+    };
+
+    static_assert(sizeof(CheckpointHeader) % 8 == 0);
+
+    libsemigroups::LibsemigroupsException
+    checkpoint_error(std::string const& path, std::string const& msg) {
+      return file_error("checkpoint", path, msg);
+    }
+
+    void throw_if_not_twosided(congruence_kind knd, std::string const& path) {
+      if (knd != congruence_kind::twosided) {
+        throw checkpoint_error(
+            path, "only two-sided congruences can be checkpointed");
+      }
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+    // Writing
+    ////////////////////////////////////////////////////////////////////////
+
+    // Written with AtomicFileWriter, so that a process killed while
+    // checkpointing leaves the previous checkpoint.
+    void write_checkpoint(std::string const&           path,
+                          CheckpointHeader             header,
+                          PackedWords const&           words,
+                          std::vector<uint32_t> const& targets) {
+      std::memcpy(header.magic, checkpoint_magic, sizeof(header.magic));
+      header.version           = checkpoint_version;
+      header.number_of_words   = words.number_of_words();
+      header.number_of_letters = words.letters.size();
+
+      std::vector<uint64_t> letters(words.letters.cbegin(),
+                                    words.letters.cend());
+      AtomicFileWriter      out(path, "checkpoint");
+      out.write(&header, 1);
+      out.write(words.offsets.data(), words.offsets.size());
+      out.write(letters.data(), letters.size());
+      out.write(targets.data(), targets.size());
+      out.commit();
+    }
+
+    // Floating point settings are stored as the bits of a double
+    uint64_t setting_bits(double x) noexcept {
+      uint64_t result;
+      std::memcpy(&result, &x, sizeof(result));
+      return result;
+    }
+
+    double setting_value(uint64_t bits) noexcept {
+      double result;
+      std::memcpy(&result, &bits, sizeof(result));
+      return result;
+    }
+
+    template <typename Rules>
+    void push_rules(PackedWords& words, Rules const& rules) {
+      for (auto const& w : rules) {
+        words.push_back(w);
+      }
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+    // Reading
+    ////////////////////////////////////////////////////////////////////////
+
+    class MappedCheckpoint {
+     public:
+      explicit MappedCheckpoint(std::string const& path)
+          : _file(path, "checkpoint"),
+            _data(_file.data()),
+            _size(_file.size()) {
+        validate();
+      }
+
+      CheckpointHeader const& header() const noexcept {
+        return *reinterpret_cast<CheckpointHeader const*>(_data);
+      }
+
+      uint64_t const* offsets() const noexcept {
+        return reinterpret_cast<uint64_t const*>(_data
+                                                 + sizeof(CheckpointHeader));
+      }
+
+      uint64_t const* letters() const noexcept {
+        return offsets() + header().number_of_words + 1;
+      }
+
+      uint32_t const* targets() const noexcept {
+        return reinterpret_cast<uint32_t const*>(letters()
+                                                 + header().number_of_letters);
+      }
+
+      word_type word(size_t i) const {
+        return word_type(letters() + offsets()[i],
+                         letters() + offsets()[i + 1]);
+      }
+
+      std::string const& path() const noexcept {
+        return _file.path();
+      }
+
+     private:
+
+      void validate() const {
+        if (_size < sizeof(CheckpointHeader)
+            || std::memcmp(header().magic, checkpoint_magic, 8) != 0) {
+          throw checkpoint_error(path(), "not a checkpoint file");
+        }
+        auto const& h = header();
+        if (h.version != checkpoint_version) {
+          throw checkpoint_error(path(),
+                                 "unsupported version "
+                                     + std::to_string(h.version) + ", expected "
+                                     + std::to_string(checkpoint_version));
+        }
+        // Guard every multiplication below against absurd counts before
+        // computing the expected size.
+        uint64_t const limit = _size / sizeof(uint32_t);
+        if (h.number_of_words == 0 || h.number_of_words % 2 == 0
+            || h.number_of_words > limit || h.number_of_letters > limit
+            || h.number_of_nodes > limit || h.out_degree > limit
+            || (h.out_degree != 0
+                && h.number_of_nodes > limit / h.out_degree)) {
+          throw checkpoint_error(path(), "corrupt header");
+        }
+        uint64_t const expected
+            = sizeof(CheckpointHeader)
+              + 8 * (h.number_of_words + 1 + h.number_of_letters)
+              + 4 * h.number_of_nodes * h.out_degree;
+        if (expected != _size) {
+          throw checkpoint_error(path(),
+                                 "truncated or corrupt, expected "
+                                     + std::to_string(expected)
+                                     + " bytes, found "
+                                     + std::to_string(_size));
+        }
+        uint64_t const* o = offsets();
+        for (uint64_t i = 0; i < h.number_of_words; ++i) {
+          if (o[i] > o[i + 1]) {
+            throw checkpoint_error(path(), "corrupt word offsets");
+          }
+        }
+        if (o[0] != 0 || o[h.number_of_words] != h.number_of_letters) {
+          throw checkpoint_error(path(), "corrupt word offsets");
+        }
+      }
+
+      MappedFile           _file;
+      unsigned char const* _data;
+      size_t               _size;
+    };
+
+    // The alphabet (word 0) and rules of a checkpoint as a presentation.
+    Presentation<word_type> checkpoint_presentation(MappedCheckpoint const& f) {
+      Presentation<word_type> p;
+      p.alphabet(f.word(0));
+      p.contains_empty_word(f.header().contains_empty_word != 0);
+      for (size_t i = 1; i < f.header().number_of_words; ++i) {
+        p.rules.push_back(f.word(i));
+      }
+      p.throw_if_bad_alphabet_or_rules();
+      return p;
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+    // ToddCoxeter
+    ////////////////////////////////////////////////////////////////////////
+
+    void save_todd_coxeter(TC const& tc, std::string const& path) {
+      throw_if_not_twosided(tc.kind(), path);
+      auto const& p = tc.presentation();
+
+      // Letters are written as alphabet indices, which are the edge labels
+      // of the word graph.
+      PackedWords words;
+      word_type   w;
+      auto        push_indices = [&](word_type const& u) {
+        w.clear();
+        for (auto x : u) {
+          w.push_back(p.index(x));
+        }
+        words.push_back(w);
+      };
+      word_type alphabet(p.alphabet().size());
+      std::iota(alphabet.begin(), alphabet.end(), 0);
+      words.push_back(alphabet);
+      for (auto const& u : p.rules) {
+        push_indices(u);
+      }
+      for (auto const& u : tc.generating_pairs()) {
+        push_indices(u);
+      }
+
+      // Breadth-first from 0, so unreachable (e.g. killed) nodes are
+      // dropped and the table is renumbered compactly.
+      auto const&           wg    = tc.current_word_graph();
+      size_t const          deg   = wg.out_degree();
+      uint32_t const undef = static_cast<uint32_t>(libsemigroups::UNDEFINED);
+      std::vector<uint32_t> order;
+      std::vector<uint32_t> renumber(wg.number_of_nodes(), undef);
+      if (wg.number_of_nodes() != 0) {
+        order.push_back(0);
+        renumber[0] = 0;
+      }
+      for (size_t i = 0; i < order.size(); ++i) {
+        for (size_t a = 0; a < deg; ++a) {
+          auto t = wg.target_no_checks(order[i], a);
+          if (t != undef && renumber[t] == undef) {
+            renumber[t] = order.size();
+            order.push_back(t);
+          }
+        }
+      }
+      std::vector<uint32_t> targets(order.size() * deg, undef);
+      for (size_t i = 0; i < order.size(); ++i) {
+        for (size_t a = 0; a < deg; ++a) {
+          auto t = wg.target_no_checks(order[i], a);
+          if (t != undef) {
+            targets[i * deg + a] = renumber[t];
+          }
+        }
+      }
+
+      // Every setting bound in todd-coxeter.cpp; lookahead_stop_early_*
+      // are not bound, and so keep their defaults on resumption.
+      CheckpointHeader h{};
+      h.algorithm = static_cast<uint32_t>(checkpoint_algorithm::todd_coxeter);
+
+      h.settings[0]  = static_cast<uint64_t>(tc.strategy());
+      h.settings[1]  = static_cast<uint64_t>(tc.lookahead_extent());
+      h.settings[2]  = static_cast<uint64_t>(tc.lookahead_style());
+      h.settings[3]  = tc.save();
+      h.settings[4]  = tc.use_relations_in_extra();
+      h.settings[5]  = tc.lower_bound();
+      h.settings[6]  = static_cast<uint64_t>(tc.def_version());
+      h.settings[7]  = static_cast<uint64_t>(tc.def_policy());
+      h.settings[8]  = tc.lookahead_next();
+      h.settings[9]  = tc.lookahead_min();
+      h.settings[10] = setting_bits(tc.lookahead_growth_factor());
+      h.settings[11] = tc.lookahead_growth_threshold();
+      h.settings[12] = tc.hlt_defs();
+      h.settings[13] = tc.f_defs();
+      h.settings[14] = tc.def_max();
+      h.settings[15] = tc.large_collapse();
+      h.contains_empty_word = p.contains_empty_word();
+      h.number_of_nodes     = order.size();
+      h.out_degree          = deg;
+      write_checkpoint(path, h, words, targets);
+    }
+
+    TC load_todd_coxeter(MappedCheckpoint const& f) {
+      auto const& h = f.header();
+      auto        p = checkpoint_presentation(f);
+      if (h.number_of_nodes != 0 && h.out_degree != p.alphabet().size()) {
+        throw checkpoint_error(f.path(), "corrupt word graph");
+      }
+      // The presentation, with whether it contains the empty word, is the
+      // saved one, so that the classes are counted as they were before the
+      // checkpoint; the word graph, if any, is then attached to it.
+      TC tc(congruence_kind::twosided, p);
+      if (h.number_of_nodes != 0) {
+        uint32_t const undef = static_cast<uint32_t>(libsemigroups::UNDEFINED);
+        WordGraph<uint32_t> wg(h.number_of_nodes, h.out_degree);
+        uint32_t const*     t = f.targets();
+        for (size_t s = 0; s < h.number_of_nodes; ++s) {
+          for (size_t a = 0; a < h.out_degree; ++a, ++t) {
+            if (*t != undef) {
+              if (*t >= h.number_of_nodes) {
+                throw checkpoint_error(f.path(), "corrupt word graph");
+              }
+              wg.target_no_checks(s, a, *t);
+            }
+          }
+        }
+        // In libsemigroups 3.5 and 3.6 (the versions allowed by
+        // Project.toml), ToddCoxeter<Word> has no public way to attach a
+        // word graph to a presentation: its own init overloads hide the
+        // init(knd, p, wg) of its public base ToddCoxeterImpl. Calling that
+        // base directly is safe here because Word is word_type, and `tc`
+        // was constructed from `p`, so the presentation that
+        // ToddCoxeter<Word> keeps already agrees with the one given to its
+        // base. Revisit this when bumping libsemigroups_jll.
+        static_cast<TCImpl&>(tc).init(congruence_kind::twosided, p, wg);
+      }
+      tc.strategy(static_cast<TCImpl::options::strategy>(h.settings[0]));
+      tc.lookahead_extent(
+          static_cast<TCImpl::options::lookahead_extent>(h.settings[1]));
+      tc.lookahead_style(
+          static_cast<TCImpl::options::lookahead_style>(h.settings[2]));
+      tc.save(h.settings[3] != 0);
+      tc.use_relations_in_extra(h.settings[4] != 0);
+      tc.lower_bound(h.settings[5]);
+      tc.def_version(static_cast<TCImpl::options::def_version>(h.settings[6]));
+      tc.def_policy(static_cast<TCImpl::options::def_policy>(h.settings[7]));
+      tc.lookahead_next(h.settings[8]);
+      tc.lookahead_min(h.settings[9]);
+      tc.lookahead_growth_factor(
+          static_cast<float>(setting_value(h.settings[10])));
+      tc.lookahead_growth_threshold(h.settings[11]);
+      tc.hlt_defs(h.settings[12]);
+      tc.f_defs(h.settings[13]);
+      tc.def_max(h.settings[14]);
+      tc.large_collapse(h.settings[15]);
+      return tc;
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+    // KnuthBendix
+    ////////////////////////////////////////////////////////////////////////
+
+    template <typename Thing>
+    void save_knuth_bendix(Thing& kb, std::string const& path) {
+      throw_if_not_twosided(kb.kind(), path);
+      auto const& p = kb.presentation();
+
+      PackedWords words;
+      words.push_back(p.alphabet());
+      auto range = kb.active_rules();
+      while (!range.at_end()) {
+        words.push_back(range.get());
+        range.next();
+      }
+      push_rules(words, p.rules);
+      push_rules(words, kb.generating_pairs());
+
+      CheckpointHeader h{};
+      h.algorithm   = static_cast<uint32_t>(knuth_bendix_algorithm<Thing>);
+      h.settings[0] = kb.max_pending_rules();
+      h.settings[1] = kb.check_confluence_interval();
+      h.settings[2] = kb.max_overlap();
+      h.settings[3] = kb.max_rules();
+      h.settings[4] = static_cast<uint64_t>(kb.overlap_policy());
+      h.contains_empty_word = p.contains_empty_word();
+      write_checkpoint(path, h, words, {});
+    }
+
+    template <typename Thing>
+    Thing load_knuth_bendix(MappedCheckpoint const& f) {
+      auto const& h = f.header();
+      Thing       kb(congruence_kind::twosided, checkpoint_presentation(f));
+      kb.max_pending_rules(h.settings[0]);
+      kb.check_confluence_interval(h.settings[1]);
+      kb.max_overlap(h.settings[2]);
+      kb.max_rules(h.settings[3]);
+      kb.overlap_policy(
+          static_cast<typename Thing::options::overlap>(h.settings[4]));
+      return kb;
+    }
+
+    template <checkpoint_algorithm Algorithm>
+    void throw_if_not(MappedCheckpoint const& f, std::string const& name) {
+      if (f.header().algorithm != static_cast<uint32_t>(Algorithm)) {
+        throw checkpoint_error(f.path(), "not a " + name + " checkpoint");
+      }
+    }
+
+  }  // namespace
+
+  void define_checkpoint(jl::Module& m) {
+    m.method("save_checkpoint", [](TC const& tc, std::string const& path) {
+      save_todd_coxeter(tc, path);
+    });
+    m.method("save_checkpoint", [](KB& kb, std::string const& path) {
+      save_knuth_bendix(kb, path);
+    });
+    m.method("save_checkpoint", [](KBFromLeft& kb, std::string const& path) {
+      save_knuth_bendix(kb, path);
+    });
+
+    // 1 for ToddCoxeter, 2 for KnuthBendix, 3 for KnuthBendixRewriteFromLeft
+    m.method("checkpoint_algorithm", [](std::string const& path) -> uint32_t {
+      return MappedCheckpoint(path).header().algorithm;
+    });
+
+    m.method("load_todd_coxeter_checkpoint", [](std::string const& path) {
+      MappedCheckpoint f(path);
+      throw_if_not<checkpoint_algorithm::todd_coxeter>(f, "ToddCoxeter");
+      return load_todd_coxeter(f);
+    });
+    m.method("load_knuth_bendix_checkpoint", [](std::string const& path) {
+      MappedCheckpoint f(path);
+      throw_if_not<checkpoint_algorithm::knuth_bendix>(f, "KnuthBendix");
+      return load_knuth_bendix<KB>(f);
+    });
+    m.method("load_knuth_bendix_from_left_checkpoint",
+             [](std::string const& path) {
+               MappedCheckpoint f(path);
+               throw_if_not<checkpoint_algorithm::knuth_bendix_from_left>(
+                   f, "KnuthBendixRewriteFromLeft");
+               return load_knuth_bendix<KBFromLeft>(f);
+             });
+  }
+
+}  // namespace libsemigroups_julia
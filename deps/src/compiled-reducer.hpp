@@ -0,0 +1,242 @@
+//
+// Semigroups.jl
+// Copyright (C) 2026, James W. Swent
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+// A CompiledReducer is the active rules of a confluent KnuthBendix compiled
+// into the Aho-Corasick automaton of their left-hand sides: a complete
+// deterministic automaton, stored as one flat transition table, whose state
+// after reading a word records the longest suffix of it that is a prefix of
+// some left-hand side, and whether some left-hand side ends there.
+//
+// A word is reduced in one left-to-right pass. The letters read so far are
+// kept on a stack together with the state after each of them; when a
+// left-hand side ends at the current letter it is popped, the automaton
+// resumes from the state before it, and the right-hand side is pushed back
+// onto the unread input. The result has no left-hand side as a factor, and
+// so, since the rules are confluent, it is the normal form. Every buffer is
+// scratch space owned by the caller, so reducing many words allocates only
+// while the buffers grow.
+//
+// The automaton is immutable once built, so it may be shared by any number
+// of threads.
+
+#ifndef LIBSEMIGROUPS_JULIA_COMPILED_REDUCER_HPP_
+#define LIBSEMIGROUPS_JULIA_COMPILED_REDUCER_HPP_
+
+// CRITICAL: libsemigroups_julia.hpp MUST be included first (fmt consteval fix)
+#include "libsemigroups_julia.hpp"
+
+#include <libsemigroups/exception.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace libsemigroups_julia {
+
+  class CompiledReducer {
+   public:
+    using word_type  = libsemigroups::word_type;
+    using state_type = uint32_t;
+
+    // Scratch space for reduce, reused between words.
+    struct Workspace {
+      std::vector<state_type> states;
+      std::vector<uint32_t>   pending;
+      std::vector<size_t>     out;
+    };
+
+    CompiledReducer() = default;
+
+    // `alphabet` is the alphabet of the presentation, and `rules` the
+    // active rules as (lhs, rhs) pairs over it, oriented so that every
+    // rhs is shortlex smaller than its lhs.
+    template <typename Rules>
+    CompiledReducer(word_type const& alphabet, Rules const& rules)
+        : _alphabet(alphabet), _rhs_offsets(1, 0) {
+      size_t const max_letter
+          = alphabet.empty()
+                ? 0
+                : *std::max_element(alphabet.cbegin(), alphabet.cend()) + 1;
+      _index.assign(max_letter, UNDEFINED_LETTER);
+      for (size_t a = 0; a < alphabet.size(); ++a) {
+        _index[alphabet[a]] = a;
+      }
+      build(rules);
+    }
+
+    size_t number_of_letters() const noexcept {
+      return _alphabet.size();
+    }
+
+    size_t number_of_rules() const noexcept {
+      return _lhs_length.size();
+    }
+
+    size_t number_of_states() const noexcept {
+      return _match.size();
+    }
+
+    // Bytes used by the transition table and the rules.
+    size_t memory_usage() const noexcept {
+      return _delta.size() * sizeof(state_type)
+             + _match.size() * sizeof(uint32_t)
+             + _lhs_length.size() * sizeof(uint32_t)
+             + _rhs.size() * sizeof(uint32_t)
+             + _rhs_offsets.size() * sizeof(uint32_t);
+    }
+
+    // Append the normal form of [first, last) to `ws.out`, which is cleared
+    // first. Throws if a letter is not in the alphabet.
+    template <typename Iterator>
+    void reduce(Iterator first, Iterator last, Workspace& ws) const {
+      size_t const n = _alphabet.size();
+      ws.out.clear();
+      ws.states.assign(1, 0);
+      ws.pending.clear();
+      for (Iterator it = last; it != first;) {
+        --it;
+        ws.pending.push_back(index(*it));
+      }
+      while (!ws.pending.empty()) {
+        uint32_t const a = ws.pending.back();
+        ws.pending.pop_back();
+        state_type const s = _delta[ws.states.back() * n + a];
+        ws.out.push_back(a);
+        ws.states.push_back(s);
+        uint32_t const r = _match[s];
+        if (r != NO_MATCH) {
+          size_t const keep = ws.out.size() - _lhs_length[r];
+          ws.out.resize(keep);
+          ws.states.resize(keep + 1);
+          for (uint32_t k = _rhs_offsets[r + 1]; k != _rhs_offsets[r];) {
+            ws.pending.push_back(_rhs[--k]);
+          }
+        }
+      }
+      for (auto& x : ws.out) {
+        x = _alphabet[x];
+      }
+    }
+
+    word_type reduce(word_type const& w) const {
+      Workspace ws;
+      reduce(w.cbegin(), w.cend(), ws);
+      return word_type(ws.out.cbegin(), ws.out.cend());
+    }
+
+   private:
+    static constexpr uint32_t NO_MATCH         = ~uint32_t(0);
+    static constexpr uint32_t UNDEFINED_LETTER = ~uint32_t(0);
+
+    uint32_t index(size_t letter) const {
+      if (letter >= _index.size() || _index[letter] == UNDEFINED_LETTER) {
+        throw libsemigroups::LibsemigroupsException(
+            __FILE__,
+            __LINE__,
+            __func__,
+            "invalid letter " + std::to_string(letter)
+                + ", expected a letter of the alphabet");
+      }
+      return _index[letter];
+    }
+
+    // Build the trie of the left-hand sides, then complete it breadth
+    // first: the transitions of a state are those of its failure state,
+    // except along its own trie edges, and it matches a rule if it is the
+    // end of a left-hand side or its failure state matches one.
+    template <typename Rules>
+    void build(Rules const& rules) {
+      size_t const         n    = _alphabet.size();
+      constexpr state_type NONE = ~state_type(0);
+
+      std::vector<state_type> trie(n, NONE);
+      _match.assign(1, NO_MATCH);
+      for (auto const& rule : rules) {
+        auto const& lhs = rule.first;
+        if (lhs.empty()) {
+          throw libsemigroups::LibsemigroupsException(
+              __FILE__,
+              __LINE__,
+              __func__,
+              "expected every left-hand side to be non-empty");
+        }
+        state_type s = 0;
+        for (auto letter : lhs) {
+          uint32_t const a = index(letter);
+          if (trie[s * n + a] == NONE) {
+            trie[s * n + a] = _match.size();
+            _match.push_back(NO_MATCH);
+            trie.resize(trie.size() + n, NONE);
+          }
+          s = trie[s * n + a];
+        }
+        if (_match[s] == NO_MATCH) {
+          _match[s] = _lhs_length.size();
+        }
+        _lhs_length.push_back(lhs.size());
+        for (auto letter : rule.second) {
+          _rhs.push_back(index(letter));
+        }
+        _rhs_offsets.push_back(_rhs.size());
+      }
+
+      size_t const            N = _match.size();
+      std::vector<state_type> fail(N, 0);
+      std::vector<state_type> queue;
+      queue.reserve(N);
+      _delta.assign(N * n, 0);
+      for (size_t a = 0; a < n; ++a) {
+        state_type const t = trie[a];
+        if (t != NONE) {
+          _delta[a] = t;
+          queue.push_back(t);
+        }
+      }
+      for (size_t head = 0; head < queue.size(); ++head) {
+        state_type const s = queue[head];
+        if (_match[s] == NO_MATCH) {
+          _match[s] = _match[fail[s]];
+        }
+        for (size_t a = 0; a < n; ++a) {
+          state_type const t = trie[s * n + a];
+          state_type const f = _delta[fail[s] * n + a];
+          if (t == NONE) {
+            _delta[s * n + a] = f;
+          } else {
+            _delta[s * n + a] = t;
+            fail[t]           = f;
+            queue.push_back(t);
+          }
+        }
+      }
+    }
+
+    word_type               _alphabet;
+    std::vector<uint32_t>   _index;
+    std::vector<state_type> _delta;
+    std::vector<uint32_t>   _match;
+    std::vector<uint32_t>   _lhs_length;
+    std::vector<uint32_t>   _rhs;
+    std::vector<uint32_t>   _rhs_offsets;
+  };
+
+}  // namespace libsemigroups_julia
+
+#endif  // LIBSEMIGROUPS_JULIA_COMPILED_REDUCER_HPP_
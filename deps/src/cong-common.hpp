@@ -43,30 +43,256 @@
 // CRITICAL: libsemigroups_julia.hpp MUST be included first (fmt consteval fix)
 #include "libsemigroups_julia.hpp"
 
+#include "binding-profile.hpp"
+#include "packed-words.hpp"
+
 #include <libsemigroups/cong-common-helpers.hpp>
 
 #include <jlcxx/array.hpp>
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
 #include <vector>
 
 namespace libsemigroups_julia {
 
+  // Whether the finished state of a Thing can be queried (reduce_no_run,
+  // currently_contains, ...) from several threads at once. Off by default;
+  // translation units whose algorithm is read-only once finished opt in by
+  // specializing this before instantiating the helpers below.
+  template <typename Thing>
+  constexpr bool parallel_queries_v = false;
+
+  // Whether a batch of queries on a Thing that writes to scratch space of
+  // its own while answering them may instead be split across threads by
+  // giving every block but the first its own copy of the finished Thing.
+  // Off by default; worthwhile only when a copy is cheap next to a block.
+  template <typename Thing>
+  constexpr bool parallel_queries_by_copy_v = false;
+
+  // The fewest queries for which a block is given its own copy
+  inline constexpr std::size_t min_queries_per_copy = 64;
+
+  // Number of blocks a batch of n queries is split into.
+  template <typename Thing>
+  std::size_t query_blocks(std::size_t n, std::size_t nthreads) {
+    if constexpr (parallel_queries_v<Thing>) {
+      return std::max<std::size_t>(1, std::min(nthreads, n));
+    } else if constexpr (parallel_queries_by_copy_v<Thing>) {
+      return std::max<std::size_t>(
+          1, std::min(nthreads, n / min_queries_per_copy));
+    } else {
+      return 1;
+    }
+  }
+
+  // Copies of a finished Thing kept from one batch to the next, for a Thing
+  // whose batches are split by copying (see parallel_queries_by_copy_v), so
+  // that repeated batches on the same Thing do not copy it every time. The
+  // copies are remade when the presentation or generating pairs of the
+  // Thing they were made from have changed, and are never fewer than were
+  // last needed; clear() frees them.
   template <typename Thing>
-  inline void define_cong_common_word_helpers(jl::Module& m) {
+  class QueryCopies {
+   public:
+    using Word = typename Thing::native_word_type;
+
+    QueryCopies() : _copies(), _made(0), _pairs(), _presentation() {}
+
+    // At least n copies of `self`, which must be finished.
+    std::vector<Thing>& get(Thing const& self, std::size_t n) {
+      if (!made_from(self)) {
+        clear();
+        _presentation = self.presentation();
+        _pairs        = self.generating_pairs();
+      }
+      _copies.reserve(n);
+      while (_copies.size() < n) {
+        _copies.emplace_back(self);
+        ++_made;
+      }
+      return _copies;
+    }
+
+    std::size_t size() const noexcept {
+      return _copies.size();
+    }
+
+    // The number of copies made over the lifetime of `this`
+    std::size_t number_made() const noexcept {
+      return _made;
+    }
+
+    void clear() {
+      _copies = std::vector<Thing>();
+    }
+
+   private:
+    bool made_from(Thing const& self) const {
+      if (_copies.empty()) {
+        return false;
+      }
+      auto const& p = self.presentation();
+      return p.alphabet() == _presentation.alphabet()
+             && p.contains_empty_word() == _presentation.contains_empty_word()
+             && p.rules == _presentation.rules
+             && self.generating_pairs() == _pairs;
+    }
+
+    std::vector<Thing>                   _copies;
+    std::size_t                          _made;
+    std::vector<Word>                    _pairs;
+    libsemigroups::Presentation<Word>    _presentation;
+  };
+
+  // The Thing that block b of a batch queries: `self`, unless the batch is
+  // split by copying (see parallel_queries_by_copy_v), in which case every
+  // block but the first has its own copy, made before any block starts, or
+  // taken from `cache` if one is given.
+  template <typename Thing>
+  class QueryTargets {
+   public:
+    QueryTargets(Thing&              self,
+                 std::size_t         blocks,
+                 QueryCopies<Thing>* cache = nullptr)
+        : _self(self), _owned(), _copies(nullptr) {
+      if constexpr (parallel_queries_by_copy_v<Thing>) {
+        if (blocks > 1) {
+          if (cache != nullptr) {
+            _copies = &cache->get(self, blocks - 1);
+          } else {
+            _owned.reserve(blocks - 1);
+            for (std::size_t b = 1; b < blocks; ++b) {
+              _owned.emplace_back(self);
+            }
+            _copies = &_owned;
+          }
+        }
+      }
+    }
+
+    Thing& operator[](std::size_t b) {
+      return b == 0 || _copies == nullptr ? _self : (*_copies)[b - 1];
+    }
+
+   private:
+    Thing&              _self;
+    std::vector<Thing>  _owned;
+    std::vector<Thing>* _copies;
+  };
+
+  // Batched queries. Each takes packed input words, runs `self` to
+  // completion once, then answers every query against the finished state
+  // with one scratch word per block (no per-word run or finished check).
+  // The first query is answered once up front, so that any state built
+  // lazily on first use exists before the batch is split across threads,
+  // or copied for them. `cache` may be nullptr, in which case any copies
+  // are made for this batch only.
+
+  template <typename Thing>
+  PackedWords reduce_batch(Thing&                    self,
+                           jlcxx::ArrayRef<size_t>   letters,
+                           jlcxx::ArrayRef<uint64_t> offsets,
+                           size_t                    nthreads,
+                           QueryCopies<Thing>*       cache) {
+    using Word = typename Thing::native_word_type;
+    PackedWordsView words(letters, offsets);
+    count_bytes_copied(letters.size() * sizeof(size_t));
+    self.run();
+    std::size_t const        n = words.size();
+    std::vector<PackedWords> parts(query_blocks<Thing>(n, nthreads));
+    Word                     w;
+    if (n != 0) {
+      words.get(0, w);
+      static_cast<void>(
+          libsemigroups::congruence_common::reduce_no_run(self, w));
+    }
+    QueryTargets<Thing> targets(self, parts.size(), cache);
+    for_each_block(n, parts.size(), [&](size_t b, size_t first, size_t last) {
+      Thing& thing = targets[b];
+      Word   scratch;
+      for (size_t i = first; i < last; ++i) {
+        words.get(i, scratch);
+        parts[b].push_back(
+            libsemigroups::congruence_common::reduce_no_run(thing, scratch));
+      }
+    });
+    for (size_t b = 1; b < parts.size(); ++b) {
+      parts[0].append(parts[b]);
+    }
+    return std::move(parts[0]);
+  }
+
+  // out[i] is 1 if u[i] and v[i] are equivalent, and 0 otherwise.
+  template <typename Thing>
+  void contains_batch(Thing&                    self,
+                      jlcxx::ArrayRef<size_t>   u_letters,
+                      jlcxx::ArrayRef<uint64_t> u_offsets,
+                      jlcxx::ArrayRef<size_t>   v_letters,
+                      jlcxx::ArrayRef<uint64_t> v_offsets,
+                      jlcxx::ArrayRef<uint8_t>  out,
+                      size_t                    nthreads,
+                      QueryCopies<Thing>*       cache) {
+    using Word = typename Thing::native_word_type;
+    PackedWordsView us(u_letters, u_offsets);
+    PackedWordsView vs(v_letters, v_offsets);
+    if (us.size() != vs.size() || us.size() != out.size()) {
+      throw libsemigroups::LibsemigroupsException(
+          __FILE__,
+          __LINE__,
+          __func__,
+          "expected the same number of left words, right words and "
+          "results, found "
+              + std::to_string(us.size()) + ", " + std::to_string(vs.size())
+              + " and " + std::to_string(out.size()));
+    }
+    count_bytes_copied((u_letters.size() + v_letters.size()) * sizeof(size_t));
+    self.run();
+    std::size_t const n    = us.size();
+    uint8_t*          data = out.data();
+
+    auto query = [](Thing const& thing, Word const& uw, Word const& vw) {
+      return libsemigroups::congruence_common::currently_contains(thing, uw, vw)
+             == libsemigroups::tril::TRUE;
+    };
+    if (n != 0) {
+      Word uw, vw;
+      us.get(0, uw);
+      vs.get(0, vw);
+      data[0] = query(self, uw, vw);
+    }
+    std::size_t const   blocks = query_blocks<Thing>(n, nthreads);
+    QueryTargets<Thing> targets(self, blocks, cache);
+    for_each_block(n, blocks, [&](size_t b, size_t first, size_t last) {
+      Thing& thing = targets[b];
+      Word   uw, vw;
+      for (size_t i = first; i < last; ++i) {
+        us.get(i, uw);
+        vs.get(i, vw);
+        data[i] = query(thing, uw, vw);
+      }
+    });
+  }
+
+  template <typename Thing>
+  inline void define_cong_common_word_helpers(jl::Module& mod) {
+    ProfiledMethods m(mod, julia_type_label<Thing>());
     using Word = typename Thing::native_word_type;
 
     // reduce (triggers full enumeration)
     m.method("cong_common_reduce",
              [](Thing& self, jlcxx::ArrayRef<size_t> w) -> Word {
-               Word input(w.begin(), w.end());
+               Word input = copy_word<Word>(w);
                return libsemigroups::congruence_common::reduce(self, input);
              });
 
     // reduce_no_run (no enumeration)
     m.method("cong_common_reduce_no_run",
              [](Thing const& self, jlcxx::ArrayRef<size_t> w) -> Word {
-               Word input(w.begin(), w.end());
+               Word input = copy_word<Word>(w);
                return libsemigroups::congruence_common::reduce_no_run(self,
                                                                       input);
              });
@@ -76,8 +302,8 @@ namespace libsemigroups_julia {
              [](Thing&                  self,
                 jlcxx::ArrayRef<size_t> u,
                 jlcxx::ArrayRef<size_t> v) -> bool {
-               Word uw(u.begin(), u.end());
-               Word vw(v.begin(), v.end());
+               Word uw = copy_word<Word>(u);
+               Word vw = copy_word<Word>(v);
                return libsemigroups::congruence_common::contains(self, uw, vw);
              });
 
@@ -86,8 +312,8 @@ namespace libsemigroups_julia {
              [](Thing const&            self,
                 jlcxx::ArrayRef<size_t> u,
                 jlcxx::ArrayRef<size_t> v) -> libsemigroups::tril {
-               Word uw(u.begin(), u.end());
-               Word vw(v.begin(), v.end());
+               Word uw = copy_word<Word>(u);
+               Word vw = copy_word<Word>(v);
                return libsemigroups::congruence_common::currently_contains(
                    self, uw, vw);
              });
@@ -96,35 +322,106 @@ namespace libsemigroups_julia {
     m.method(
         "cong_common_add_generating_pair!",
         [](Thing& self, jlcxx::ArrayRef<size_t> u, jlcxx::ArrayRef<size_t> v) {
-          Word uw(u.begin(), u.end());
-          Word vw(v.begin(), v.end());
+          Word uw = copy_word<Word>(u);
+          Word vw = copy_word<Word>(v);
           libsemigroups::congruence_common::add_generating_pair(self, uw, vw);
         });
 
+    // Batched queries, see reduce_batch and contains_batch
+    m.method("cong_common_reduce_batch",
+             [](Thing&                    self,
+                jlcxx::ArrayRef<size_t>   letters,
+                jlcxx::ArrayRef<uint64_t> offsets,
+                size_t                    nthreads) -> PackedWords {
+               return reduce_batch(self, letters, offsets, nthreads, nullptr);
+             });
+
+    // out[i] is 1 if u[i] and v[i] are equivalent, and 0 otherwise.
+    m.method("cong_common_contains_batch!",
+             [](Thing&                    self,
+                jlcxx::ArrayRef<size_t>   u_letters,
+                jlcxx::ArrayRef<uint64_t> u_offsets,
+                jlcxx::ArrayRef<size_t>   v_letters,
+                jlcxx::ArrayRef<uint64_t> v_offsets,
+                jlcxx::ArrayRef<uint8_t>  out,
+                size_t                    nthreads) {
+               contains_batch(self,
+                              u_letters,
+                              u_offsets,
+                              v_letters,
+                              v_offsets,
+                              out,
+                              nthreads,
+                              nullptr);
+             });
+
+    // The same, reusing the copies kept by a QueryCopies, which Julia holds
+    // for as long as `self` (see _query_copies in src/cong-common.jl).
+    if constexpr (parallel_queries_by_copy_v<Thing>) {
+      using Copies = QueryCopies<Thing>;
+      auto type = mod.add_type<Copies>("QueryCopies" + julia_type_label<Thing>());
+      type.method("size", [](Copies const& self) -> size_t {
+        return self.size();
+      });
+      type.method("number_made", [](Copies const& self) -> size_t {
+        return self.number_made();
+      });
+      type.method("clear!", [](Copies& self) { self.clear(); });
+
+      m.method("cong_common_query_copies",
+               [](Thing const&) -> Copies { return Copies(); });
+      m.method("cong_common_reduce_batch",
+               [](Thing&                    self,
+                  Copies&                   copies,
+                  jlcxx::ArrayRef<size_t>   letters,
+                  jlcxx::ArrayRef<uint64_t> offsets,
+                  size_t                    nthreads) -> PackedWords {
+                 return reduce_batch(self, letters, offsets, nthreads, &copies);
+               });
+      m.method("cong_common_contains_batch!",
+               [](Thing&                    self,
+                  Copies&                   copies,
+                  jlcxx::ArrayRef<size_t>   u_letters,
+                  jlcxx::ArrayRef<uint64_t> u_offsets,
+                  jlcxx::ArrayRef<size_t>   v_letters,
+                  jlcxx::ArrayRef<uint64_t> v_offsets,
+                  jlcxx::ArrayRef<uint8_t>  out,
+                  size_t                    nthreads) {
+                 contains_batch(self,
+                                u_letters,
+                                u_offsets,
+                                v_letters,
+                                v_offsets,
+                                out,
+                                nthreads,
+                                &copies);
+               });
+    }
+
     m.method("cong_common_partition",
              [](Thing& self, jlcxx::ArrayRef<jl_value_t*> words)
-                 -> std::vector<std::vector<Word>> {
+                 -> PackedWords {
                std::vector<Word> input;
                input.reserve(words.size());
                for (jl_value_t* word_value : words) {
                  auto word = jlcxx::ArrayRef<size_t>(
                      reinterpret_cast<jl_array_t*>(word_value));
-                 input.emplace_back(word.begin(), word.end());
+                 input.push_back(copy_word<Word>(word));
                }
-               return libsemigroups::congruence_common::partition(
-                   self, input.begin(), input.end());
+               return PackedWords::from_groups(
+                   libsemigroups::congruence_common::partition(
+                       self, input.begin(), input.end()));
              });
   }
 
   template <typename Thing>
-  inline void define_cong_common_normal_forms(jl::Module& m) {
-    using Word = typename Thing::native_word_type;
-
+  inline void define_cong_common_normal_forms(jl::Module& mod) {
+    ProfiledMethods m(mod, julia_type_label<Thing>());
     // normal_forms() returns an rx-style range; use
     // .at_end()/.get()/.next().
-    m.method("cong_common_normal_forms", [](Thing& self) -> std::vector<Word> {
-      std::vector<Word> result;
-      auto range = libsemigroups::congruence_common::normal_forms(self);
+    m.method("cong_common_normal_forms", [](Thing& self) -> PackedWords {
+      PackedWords result;
+      auto        range = libsemigroups::congruence_common::normal_forms(self);
       while (!range.at_end()) {
         result.push_back(range.get());
         range.next();
@@ -134,13 +431,12 @@ namespace libsemigroups_julia {
   }
 
   template <typename Thing>
-  inline void define_cong_common_non_trivial_classes(jl::Module& m) {
-    using Word = typename Thing::native_word_type;
-
+  inline void define_cong_common_non_trivial_classes(jl::Module& mod) {
+    ProfiledMethods m(mod, julia_type_label<Thing>());
     m.method("cong_common_non_trivial_classes",
-             [](Thing& x, Thing& y) -> std::vector<std::vector<Word>> {
-               return libsemigroups::congruence_common::non_trivial_classes(x,
-                                                                            y);
+             [](Thing& x, Thing& y) -> PackedWords {
+               return PackedWords::from_groups(
+                   libsemigroups::congruence_common::non_trivial_classes(x, y));
              });
   }
 
@@ -159,4 +455,10 @@ namespace libsemigroups_julia {
 
 }  // namespace libsemigroups_julia
 
+namespace jlcxx {
+  template <typename Thing>
+  struct IsMirroredType<libsemigroups_julia::QueryCopies<Thing>>
+      : std::false_type {};
+}  // namespace jlcxx
+
 #endif  // LIBSEMIGROUPS_JULIA_CONG_COMMON_HPP_
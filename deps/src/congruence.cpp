@@ -37,13 +37,241 @@
 
 #include "cong-common.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <exception>
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <type_traits>
 #include <vector>
 
+namespace libsemigroups_julia {
+
+  // A race between separately configured congruence algorithms that records
+  // how every competitor fared. Congruence<word_type> runs a race of its own,
+  // but its competitors are fixed when it is constructed and the losers are
+  // discarded once a winner is found, so neither extra competitors nor
+  // per-runner statistics are available from it.
+  //
+  // Competitors are copies of the objects added. At most max_threads of them
+  // take part, each on its own thread; the first to finish wins and the
+  // others are killed.
+  class CongruenceRace {
+   public:
+    CongruenceRace()
+        : _competitors(),
+          _elapsed(0),
+          _max_threads(1),
+          _started(false),
+          _winner(libsemigroups::UNDEFINED) {}
+
+    template <typename Thing>
+    void add_runner(Thing const& thing, std::string const& name) {
+      if (_started) {
+        throw libsemigroups::LibsemigroupsException(
+            __FILE__,
+            __LINE__,
+            __func__,
+            "cannot add a runner to a race that has already been run");
+      }
+      auto ptr = std::make_shared<Thing>(thing);
+      _competitors.push_back(Competitor{ptr, name, 0, false, [ptr]() {
+                                          return competitor_size(*ptr);
+                                        }});
+    }
+
+    template <typename Thing>
+    Thing get(size_t i, std::string const& name) const {
+      throw_if_out_of_bounds(i);
+      auto ptr = std::dynamic_pointer_cast<Thing>(_competitors[i].runner);
+      if (ptr == nullptr) {
+        throw libsemigroups::LibsemigroupsException(
+            __FILE__,
+            __LINE__,
+            __func__,
+            "expected runner " + std::to_string(i) + " to be " + name
+                + ", found " + _competitors[i].name);
+      }
+      return *ptr;
+    }
+
+    void run() {
+      if (_started) {
+        return;
+      }
+      if (_competitors.empty()) {
+        throw libsemigroups::LibsemigroupsException(
+            __FILE__, __LINE__, __func__, "cannot run a race with no runners");
+      }
+      _started = true;
+
+      size_t const n = std::min(_max_threads, _competitors.size());
+      std::atomic<size_t> winner(libsemigroups::UNDEFINED);
+      std::exception_ptr  error;
+      std::mutex          mtx;
+
+      auto race = [&](size_t i) {
+        auto& c     = _competitors[i];
+        auto  start = std::chrono::steady_clock::now();
+        try {
+          c.runner->run();
+        } catch (...) {
+          std::lock_guard<std::mutex> lock(mtx);
+          if (!error) {
+            error = std::current_exception();
+          }
+        }
+        c.elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        std::chrono::steady_clock::now() - start)
+                        .count();
+        c.ran = true;
+        if (c.runner->finished()) {
+          size_t expected = libsemigroups::UNDEFINED;
+          if (winner.compare_exchange_strong(expected, i)) {
+            for (size_t j = 0; j < n; ++j) {
+              if (j != i) {
+                _competitors[j].runner->kill();
+              }
+            }
+          }
+        }
+      };
+
+      auto start = std::chrono::steady_clock::now();
+      if (n == 1) {
+        race(0);
+      } else {
+        std::vector<std::thread> threads;
+        threads.reserve(n);
+        for (size_t i = 0; i < n; ++i) {
+          threads.emplace_back(race, i);
+        }
+        for (auto& t : threads) {
+          t.join();
+        }
+      }
+      _elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                     std::chrono::steady_clock::now() - start)
+                     .count();
+      _winner = winner.load();
+      if (_winner == libsemigroups::UNDEFINED && error) {
+        std::rethrow_exception(error);
+      }
+    }
+
+    size_t number_of_runners() const noexcept {
+      return _competitors.size();
+    }
+
+    size_t max_threads() const noexcept {
+      return _max_threads;
+    }
+
+    void max_threads(size_t val) {
+      if (val == 0) {
+        throw libsemigroups::LibsemigroupsException(
+            __FILE__,
+            __LINE__,
+            __func__,
+            "the maximum number of threads must be positive, found 0");
+      }
+      _max_threads = val;
+    }
+
+    bool started() const noexcept {
+      return _started;
+    }
+
+    // UNDEFINED if the race has not been run or no competitor finished.
+    size_t winner() const noexcept {
+      return _winner;
+    }
+
+    int64_t elapsed() const noexcept {
+      return _elapsed;
+    }
+
+    std::string const& name(size_t i) const {
+      throw_if_out_of_bounds(i);
+      return _competitors[i].name;
+    }
+
+    bool ran(size_t i) const {
+      throw_if_out_of_bounds(i);
+      return _competitors[i].ran;
+    }
+
+    bool finished(size_t i) const {
+      throw_if_out_of_bounds(i);
+      return _competitors[i].runner->finished();
+    }
+
+    int64_t elapsed(size_t i) const {
+      throw_if_out_of_bounds(i);
+      return _competitors[i].elapsed;
+    }
+
+    uint64_t size(size_t i) const {
+      throw_if_out_of_bounds(i);
+      return _competitors[i].size();
+    }
+
+   private:
+    struct Competitor {
+      std::shared_ptr<libsemigroups::Runner> runner;
+      std::string                            name;
+      int64_t                                elapsed;
+      bool                                   ran;
+      std::function<uint64_t()>              size;
+    };
+
+    // The size of the data structure a competitor has built so far: nodes
+    // in the word graph for ToddCoxeter, active rules for KnuthBendix.
+    // Kambites builds nothing comparable, so reports 0.
+    template <typename Word>
+    static uint64_t
+    competitor_size(libsemigroups::ToddCoxeter<Word> const& tc) {
+      return tc.current_word_graph().number_of_nodes();
+    }
+
+    template <typename Word, typename Rewriter, typename Order>
+    static uint64_t competitor_size(
+        libsemigroups::KnuthBendix<Word, Rewriter, Order> const& kb) {
+      return kb.number_of_active_rules();
+    }
+
+    template <typename Word>
+    static uint64_t competitor_size(libsemigroups::Kambites<Word> const&) {
+      return 0;
+    }
+
+    void throw_if_out_of_bounds(size_t i) const {
+      if (i >= _competitors.size()) {
+        throw libsemigroups::LibsemigroupsException(
+            __FILE__,
+            __LINE__,
+            __func__,
+            "runner index out of bounds, expected value in [0, "
+                + std::to_string(_competitors.size()) + "), found "
+                + std::to_string(i));
+      }
+    }
+
+    std::vector<Competitor> _competitors;
+    int64_t                 _elapsed;
+    size_t                  _max_threads;
+    bool                    _started;
+    size_t                  _winner;
+  };
+
+}  // namespace libsemigroups_julia
+
 namespace jlcxx {
   template <>
   struct IsMirroredType<libsemigroups::Congruence<libsemigroups::word_type>>
@@ -53,6 +281,10 @@ namespace jlcxx {
   struct SuperType<libsemigroups::Congruence<libsemigroups::word_type>> {
     using type = libsemigroups::detail::CongruenceCommon;
   };
+
+  template <>
+  struct IsMirroredType<libsemigroups_julia::CongruenceRace>
+      : std::false_type {};
 }  // namespace jlcxx
 
 namespace libsemigroups_julia {
@@ -151,13 +383,19 @@ namespace libsemigroups_julia {
 
     ////////////////////////////////////////////////////////////////////////
     // Race-state queries
-    // (max_threads getter/setter intentionally NOT bound)
     ////////////////////////////////////////////////////////////////////////
 
     type.method("number_of_runners", [](C const& self) -> size_t {
       return self.number_of_runners();
     });
 
+    type.method("max_threads",
+                [](C const& self) -> size_t { return self.max_threads(); });
+
+    type.method("max_threads!", [](C& self, size_t val) -> C& {
+      return self.max_threads(val);
+    });
+
     ////////////////////////////////////////////////////////////////////////
     // Race introspection: has<Thing>() / get<Thing>()
     ////////////////////////////////////////////////////////////////////////
@@ -187,6 +425,95 @@ namespace libsemigroups_julia {
     ////////////////////////////////////////////////////////////////////////
 
     define_cong_common_word_helpers<C>(m);
+
+    ////////////////////////////////////////////////////////////////////////
+    // CongruenceRace - separately configured competitors with per-runner
+    // timing. Indices are 0-based; src/congruence.jl converts.
+    ////////////////////////////////////////////////////////////////////////
+
+    using KB = KnuthBendix<word_type,
+                           libsemigroups::detail::RewriteTrie,
+                           libsemigroups::ShortLexCompare>;
+    using KBFromLeft = KnuthBendix<word_type,
+                                   libsemigroups::detail::RewriteFromLeft,
+                                   libsemigroups::ShortLexCompare>;
+
+    auto race = m.add_type<CongruenceRace>("CongruenceRace");
+    race.constructor<>();
+
+    race.method("add_runner!",
+                [](CongruenceRace& self, ToddCoxeter<word_type> const& x) {
+                  self.add_runner(x, "ToddCoxeter");
+                });
+    race.method("add_runner!", [](CongruenceRace& self, KB const& x) {
+      self.add_runner(x, "KnuthBendix");
+    });
+    race.method("add_runner!", [](CongruenceRace& self, KBFromLeft const& x) {
+      self.add_runner(x, "KnuthBendixRewriteFromLeft");
+    });
+    race.method("add_runner!",
+                [](CongruenceRace& self, Kambites<word_type> const& x) {
+                  self.add_runner(x, "Kambites");
+                });
+
+    race.method("run!", [](CongruenceRace& self) { self.run(); });
+    race.method("number_of_runners", [](CongruenceRace const& self) -> size_t {
+      return self.number_of_runners();
+    });
+    race.method("max_threads", [](CongruenceRace const& self) -> size_t {
+      return self.max_threads();
+    });
+    race.method("max_threads!", [](CongruenceRace& self, size_t val) {
+      self.max_threads(val);
+    });
+    race.method("started", [](CongruenceRace const& self) -> bool {
+      return self.started();
+    });
+    race.method("winner", [](CongruenceRace const& self) -> size_t {
+      return self.winner();
+    });
+    race.method("elapsed", [](CongruenceRace const& self) -> int64_t {
+      return self.elapsed();
+    });
+
+    race.method("runner_name",
+                [](CongruenceRace const& self, size_t i) -> std::string {
+                  return self.name(i);
+                });
+    race.method("runner_ran", [](CongruenceRace const& self, size_t i) -> bool {
+      return self.ran(i);
+    });
+    race.method("runner_finished",
+                [](CongruenceRace const& self, size_t i) -> bool {
+                  return self.finished(i);
+                });
+    race.method("runner_elapsed",
+                [](CongruenceRace const& self, size_t i) -> int64_t {
+                  return self.elapsed(i);
+                });
+    race.method("runner_size",
+                [](CongruenceRace const& self, size_t i) -> uint64_t {
+                  return self.size(i);
+                });
+
+    race.method("race_get_todd_coxeter",
+                [](CongruenceRace const& self,
+                   size_t                i) -> ToddCoxeter<word_type> {
+                  return self.get<ToddCoxeter<word_type>>(i, "ToddCoxeter");
+                });
+    race.method("race_get_knuth_bendix",
+                [](CongruenceRace const& self, size_t i) -> KB {
+                  return self.get<KB>(i, "KnuthBendix");
+                });
+    race.method("race_get_knuth_bendix_from_left",
+                [](CongruenceRace const& self, size_t i) -> KBFromLeft {
+                  return self.get<KBFromLeft>(i, "KnuthBendixRewriteFromLeft");
+                });
+    race.method("race_get_kambites",
+                [](CongruenceRace const& self,
+                   size_t                i) -> Kambites<word_type> {
+                  return self.get<Kambites<word_type>>(i, "Kambites");
+                });
   }
 
 }  // namespace libsemigroups_julia
@@ -0,0 +1,173 @@
+//
+// Semigroups.jl
+// Copyright (C) 2026, James W. Swent
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+// Bindings for ElementTable<E>, see element-table.hpp, one type per element
+// type of transf.cpp. Elements go in either as the bound element objects or
+// as raw images in the layout of `src/packed-elements.jl`; positions are
+// 0-based, with UNDEFINED for an element not in the table.
+
+// CRITICAL: libsemigroups_julia.hpp MUST be included first (fmt consteval fix)
+#include "libsemigroups_julia.hpp"
+
+#include "element-table.hpp"
+
+#include <libsemigroups/exception.hpp>
+#include <libsemigroups/transf.hpp>
+
+#include <jlcxx/array.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace jlcxx {
+  template <typename E>
+  struct IsMirroredType<libsemigroups_julia::ElementTable<E>>
+      : std::false_type {};
+}  // namespace jlcxx
+
+namespace libsemigroups_julia {
+
+  namespace {
+
+    template <typename Table>
+    void throw_if_bad_degree(Table const& self, size_t degree) {
+      if (degree != self.degree()) {
+        throw libsemigroups::LibsemigroupsException(
+            __FILE__,
+            __LINE__,
+            __func__,
+            "expected an element of degree " + std::to_string(self.degree())
+                + ", found " + std::to_string(degree));
+      }
+    }
+
+    // The number of elements in a buffer of raw images
+    template <typename Table>
+    size_t number_of_elements(Table const& self, size_t length) {
+      if (length % self.degree() != 0) {
+        throw libsemigroups::LibsemigroupsException(
+            __FILE__,
+            __LINE__,
+            __func__,
+            "expected a multiple of the degree "
+                + std::to_string(self.degree()) + " images, found "
+                + std::to_string(length));
+      }
+      return length / self.degree();
+    }
+
+    void throw_if_bad_output(size_t length, size_t n) {
+      if (length != n) {
+        throw libsemigroups::LibsemigroupsException(
+            __FILE__,
+            __LINE__,
+            __func__,
+            "expected an output buffer of length " + std::to_string(n)
+                + ", found " + std::to_string(length));
+      }
+    }
+
+    template <typename E>
+    void bind_element_table(jl::Module& m, std::string const& name) {
+      using Table  = ElementTable<E>;
+      using Scalar = typename Table::point_type;
+
+      auto type = m.add_type<Table>(name);
+      type.template constructor<size_t, size_t>();
+
+      type.method("degree", &Table::degree);
+      type.method("size", &Table::size);
+      type.method("number_of_shards", &Table::number_of_shards);
+      type.method("memory_usage", &Table::memory_usage);
+
+      m.method("element_table_insert!",
+               [](Table& self, E const& x) -> uint64_t {
+                 throw_if_bad_degree(self, x.degree());
+                 return self.insert(&*x.cbegin());
+               });
+      m.method("element_table_find",
+               [](Table const& self, E const& x) -> uint64_t {
+                 throw_if_bad_degree(self, x.degree());
+                 return self.find(&*x.cbegin());
+               });
+
+      // Batches of raw images, writing one position per element to `out`
+      m.method("element_table_insert!",
+               [](Table&                    self,
+                  jlcxx::ArrayRef<Scalar>   xs,
+                  jlcxx::ArrayRef<uint64_t> out,
+                  size_t                    nthreads) {
+                 size_t const n = number_of_elements(self, xs.size());
+                 throw_if_bad_output(out.size(), n);
+                 self.insert(xs.data(), n, out.data(), nthreads);
+               });
+      m.method("element_table_find",
+               [](Table const&              self,
+                  jlcxx::ArrayRef<Scalar>   xs,
+                  jlcxx::ArrayRef<uint64_t> out,
+                  size_t                    nthreads) {
+                 size_t const n = number_of_elements(self, xs.size());
+                 throw_if_bad_output(out.size(), n);
+                 self.find(xs.data(), n, out.data(), nthreads);
+               });
+
+      // Copy the images of elements [first, first + n) to `out`
+      m.method("element_table_images!",
+               [](Table const&            self,
+                  size_t                  first,
+                  jlcxx::ArrayRef<Scalar> out) {
+                 size_t const n = number_of_elements(self, out.size());
+                 if (first > self.size() || n > self.size() - first) {
+                   throw libsemigroups::LibsemigroupsException(
+                       __FILE__,
+                       __LINE__,
+                       __func__,
+                       "expected elements in the range [0, "
+                           + std::to_string(self.size()) + "), found ["
+                           + std::to_string(first) + ", "
+                           + std::to_string(first + n) + ")");
+                 }
+                 std::copy(self.images(first),
+                           self.images(first + n),
+                           out.data());
+               });
+    }
+
+  }  // namespace
+
+  void define_element_table(jl::Module& m) {
+    using libsemigroups::Perm;
+    using libsemigroups::PPerm;
+    using libsemigroups::Transf;
+
+    bind_element_table<Transf<0, uint8_t>>(m, "ElementTableTransf1");
+    bind_element_table<Transf<0, uint16_t>>(m, "ElementTableTransf2");
+    bind_element_table<Transf<0, uint32_t>>(m, "ElementTableTransf4");
+    bind_element_table<PPerm<0, uint8_t>>(m, "ElementTablePPerm1");
+    bind_element_table<PPerm<0, uint16_t>>(m, "ElementTablePPerm2");
+    bind_element_table<PPerm<0, uint32_t>>(m, "ElementTablePPerm4");
+    bind_element_table<Perm<0, uint8_t>>(m, "ElementTablePerm1");
+    bind_element_table<Perm<0, uint16_t>>(m, "ElementTablePerm2");
+    bind_element_table<Perm<0, uint32_t>>(m, "ElementTablePerm4");
+  }
+
+}  // namespace libsemigroups_julia
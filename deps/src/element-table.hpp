@@ -0,0 +1,318 @@
+//
+// Semigroups.jl
+// Copyright (C) 2026, James W. Swent
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+// An ElementTable<E> numbers distinct transformations, partial
+// permutations or permutations of one degree, in the order they are first
+// inserted, for use outside of a FroidurePin (orbits, stabiliser chains and
+// so on).
+//
+// The elements are stored as their raw images, one after another in a
+// single arena, in the layout of `src/packed-elements.jl`, so an element
+// costs `degree` points and no allocation of its own. The hash table is
+// open addressing with linear probing, storing positions in the arena and
+// the hash of each element, so growing it reads no element.
+//
+// The table is split into a power of two number of shards, chosen from the
+// high bits of the hash. A batch of elements is inserted in three steps:
+//
+//   1. on every thread, for a block of the batch, hash the elements;
+//   2. on every thread, for a block of the shards, look up every element of
+//      the batch that belongs to those shards, and enter each new one as
+//      pending, pointing at its first occurrence in the batch;
+//   3. on one thread, in batch order, append the pending elements to the
+//      arena and replace their entries by their positions.
+//
+// Shards are only ever written by one thread at a time, so no locking is
+// needed, and the positions do not depend on the number of threads: they
+// are those of inserting the batch one element at a time. With one shard,
+// step 2 runs on one thread.
+
+#ifndef LIBSEMIGROUPS_JULIA_ELEMENT_TABLE_HPP_
+#define LIBSEMIGROUPS_JULIA_ELEMENT_TABLE_HPP_
+
+// CRITICAL: libsemigroups_julia.hpp MUST be included first (fmt consteval fix)
+#include "libsemigroups_julia.hpp"
+
+#include "packed-words.hpp"  // for for_each_block
+
+#include <libsemigroups/constants.hpp>
+#include <libsemigroups/exception.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace libsemigroups_julia {
+
+  template <typename E>
+  class ElementTable {
+   public:
+    using element_type = E;
+    using point_type   = typename E::point_type;
+
+    // Returned by find for an element not in the table
+    static constexpr uint64_t undefined
+        = static_cast<uint64_t>(libsemigroups::UNDEFINED);
+
+    // `shards` is rounded up to a power of two
+    ElementTable(size_t degree, size_t shards)
+        : _degree(degree), _shard_bits(0), _images(), _shards() {
+      if (degree == 0 || shards == 0 || shards > max_shards) {
+        throw libsemigroups::LibsemigroupsException(
+            __FILE__,
+            __LINE__,
+            __func__,
+            "expected a positive degree and between 1 and "
+                + std::to_string(max_shards) + " shards, found degree "
+                + std::to_string(degree) + " and "
+                + std::to_string(shards) + " shards");
+      }
+      while ((size_t(1) << _shard_bits) < shards) {
+        ++_shard_bits;
+      }
+      _shards.resize(size_t(1) << _shard_bits);
+    }
+
+    size_t degree() const noexcept {
+      return _degree;
+    }
+
+    size_t size() const noexcept {
+      return _images.size() / _degree;
+    }
+
+    size_t number_of_shards() const noexcept {
+      return _shards.size();
+    }
+
+    // The images of element i, which stay valid until the next insert
+    point_type const* images(size_t i) const noexcept {
+      return _images.data() + i * _degree;
+    }
+
+    // Bytes used by the arena and the hash table
+    size_t memory_usage() const noexcept {
+      size_t result = _images.capacity() * sizeof(point_type);
+      for (auto const& shard : _shards) {
+        result += shard.slots.capacity() * sizeof(Slot);
+      }
+      return result;
+    }
+
+    // The position of the element with images x, or undefined
+    uint64_t find(point_type const* x) const {
+      uint64_t const hash  = hash_images(x);
+      Shard const&   shard = _shards[shard_of(hash)];
+      if (shard.slots.empty()) {
+        return undefined;
+      }
+      return shard.slots[probe(shard, hash, x, nullptr)].value;
+    }
+
+    // Write the position of each of the n elements of xs, or undefined, to
+    // out, on at most nthreads threads.
+    void find(point_type const* xs,
+              size_t            n,
+              uint64_t*         out,
+              size_t            nthreads) const {
+      for_each_block(n, nthreads, [&](size_t, size_t first, size_t last) {
+        for (size_t k = first; k < last; ++k) {
+          out[k] = find(xs + k * _degree);
+        }
+      });
+    }
+
+    // The position of the element with images x, inserting it if it is
+    // not already in the table.
+    uint64_t insert(point_type const* x) {
+      uint64_t const hash  = hash_images(x);
+      Shard&         shard = _shards[shard_of(hash)];
+      reserve(shard, shard.count + 1);
+      Slot& slot = shard.slots[probe(shard, hash, x, nullptr)];
+      if (slot.value == undefined) {
+        slot = {hash, size()};
+        ++shard.count;
+        append(x);
+      }
+      return slot.value;
+    }
+
+    // Insert the n elements of xs, and write the position of each to out,
+    // on at most nthreads threads. See the comment at the top of the file.
+    void insert(point_type const* xs,
+                size_t            n,
+                uint64_t*         out,
+                size_t            nthreads) {
+      std::vector<uint64_t> hashes(n);
+      for_each_block(n, nthreads, [&](size_t, size_t first, size_t last) {
+        for (size_t k = first; k < last; ++k) {
+          hashes[k] = hash_images(xs + k * _degree);
+        }
+      });
+
+      for_each_block(
+          _shards.size(), nthreads, [&](size_t, size_t first, size_t last) {
+            for (size_t k = 0; k < n; ++k) {
+              size_t const s = shard_of(hashes[k]);
+              if (s < first || s >= last) {
+                continue;
+              }
+              Shard& shard = _shards[s];
+              reserve(shard, shard.count + 1);
+              Slot& slot
+                  = shard.slots[probe(shard, hashes[k], xs + k * _degree, xs)];
+              if (slot.value == undefined) {
+                slot = {hashes[k], pending | k};
+                ++shard.count;
+              }
+              out[k] = slot.value;
+            }
+          });
+
+      // No reserve here: it would allocate exactly this batch, and so copy
+      // the whole arena on every call, while append grows it geometrically.
+      for (size_t k = 0; k < n; ++k) {
+        uint64_t const value = out[k];
+        if ((value & pending) == 0) {
+          continue;
+        }
+        size_t const first = value & ~pending;
+        if (first != k) {
+          out[k] = out[first];
+          continue;
+        }
+        out[k] = size();
+        append(xs + k * _degree);
+        Shard&       shard = _shards[shard_of(hashes[k])];
+        size_t const mask  = shard.slots.size() - 1;
+        size_t       i     = slot_of(shard, hashes[k]);
+        while (shard.slots[i].value != value) {
+          i = (i + 1) & mask;
+        }
+        shard.slots[i].value = out[k];
+      }
+    }
+
+   private:
+    // Marks an entry made on step 2 of a batch insert, whose low bits are
+    // the position in the batch of the element.
+    static constexpr uint64_t pending = uint64_t(1) << 63;
+
+    static constexpr size_t max_shards = 1024;
+
+    struct Slot {
+      uint64_t hash;
+      uint64_t value;
+    };
+
+    struct Shard {
+      std::vector<Slot> slots;
+      size_t            shift = 64;
+      size_t            count = 0;
+    };
+
+    // The images hashed as libsemigroups hashes containers, then mixed by
+    // Fibonacci hashing, so that the high bits, which pick the shard, and
+    // the bits below them, which pick the slot, both depend on every point.
+    uint64_t hash_images(point_type const* x) const noexcept {
+      uint64_t seed = 0;
+      for (size_t i = 0; i < _degree; ++i) {
+        seed ^= uint64_t(x[i]) + 0x9E3779B97F4A7C16ULL + (seed << 6)
+                + (seed >> 2);
+      }
+      return seed * 0x9E3779B97F4A7C15ULL;
+    }
+
+    size_t shard_of(uint64_t hash) const noexcept {
+      return _shard_bits == 0 ? 0 : hash >> (64 - _shard_bits);
+    }
+
+    size_t slot_of(Shard const& shard, uint64_t hash) const noexcept {
+      return (hash << _shard_bits) >> shard.shift;
+    }
+
+    // The images of an entry, which are in the batch `batch` if pending
+    point_type const* images_of(uint64_t          value,
+                                point_type const* batch) const noexcept {
+      return (value & pending) ? batch + (value & ~pending) * _degree
+                               : images(value);
+    }
+
+    // The slot holding x, or the empty slot where it belongs
+    size_t probe(Shard const&      shard,
+                 uint64_t          hash,
+                 point_type const* x,
+                 point_type const* batch) const {
+      size_t const mask = shard.slots.size() - 1;
+      for (size_t i = slot_of(shard, hash);; i = (i + 1) & mask) {
+        Slot const& slot = shard.slots[i];
+        if (slot.value == undefined
+            || (slot.hash == hash
+                && std::equal(x, x + _degree, images_of(slot.value, batch)))) {
+          return i;
+        }
+      }
+    }
+
+    // Keeps the load factor of a shard at most 1/2
+    void reserve(Shard& shard, size_t n) {
+      if (2 * n <= shard.slots.size()) {
+        return;
+      }
+      size_t bits = 4;
+      while ((size_t(1) << bits) < 2 * n) {
+        ++bits;
+      }
+      std::vector<Slot> slots(size_t(1) << bits, Slot{0, undefined});
+      std::swap(shard.slots, slots);
+      shard.shift = 64 - bits;
+      size_t const mask = shard.slots.size() - 1;
+      for (auto const& slot : slots) {
+        if (slot.value != undefined) {
+          size_t i = slot_of(shard, slot.hash);
+          while (shard.slots[i].value != undefined) {
+            i = (i + 1) & mask;
+          }
+          shard.slots[i] = slot;
+        }
+      }
+    }
+
+    void append(point_type const* x) {
+      if (size() >= pending) {
+        throw libsemigroups::LibsemigroupsException(
+            __FILE__,
+            __LINE__,
+            __func__,
+            "cannot store more than " + std::to_string(pending)
+                + " elements");
+      }
+      _images.insert(_images.end(), x, x + _degree);
+    }
+
+    size_t                  _degree;
+    size_t                  _shard_bits;
+    std::vector<point_type> _images;
+    std::vector<Shard>      _shards;
+  };
+
+}  // namespace libsemigroups_julia
+
+#endif  // LIBSEMIGROUPS_JULIA_ELEMENT_TABLE_HPP_
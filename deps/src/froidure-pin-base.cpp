@@ -22,6 +22,10 @@
 // CRITICAL: libsemigroups_julia.hpp MUST be included first (fmt consteval fix)
 #include "libsemigroups_julia.hpp"
 
+#include "packed-words.hpp"
+
+#include <libsemigroups/constants.hpp>
+#include <libsemigroups/exception.hpp>
 #include <libsemigroups/froidure-pin-base.hpp>
 #include <libsemigroups/runner.hpp>
 #include <libsemigroups/types.hpp>
@@ -31,8 +35,94 @@
 #include <cstddef>
 #include <cstdint>
 #include <iterator>
+#include <string>
 #include <vector>
 
+namespace libsemigroups_julia {
+
+  // Stateful cursor over a range of normal forms or rules of a
+  // FroidurePinBase, handing out fixed-size chunks of PackedWords so that
+  // neither side ever holds the whole collection. Same get / next! / at_end
+  // protocol as Paths and WordRange: `get` is the current chunk, and the
+  // cursor is at its end once a chunk comes back empty. Rules are packed
+  // interleaved (lhs, rhs, lhs, rhs, ...), and a chunk contains
+  // `chunk_size` rules, i.e. 2 * chunk_size words.
+  //
+  // The cursor holds iterators into `fpb`, which must outlive it (the Julia
+  // wrapper pins the FroidurePin). Enumerating `fpb` further invalidates
+  // those iterators, so `next` throws if the size of `fpb` has changed
+  // since the cursor was made.
+  template <typename Iterator>
+  class FroidurePinWordCursor {
+   public:
+    FroidurePinWordCursor(libsemigroups::FroidurePinBase const& fpb,
+                          Iterator                              first,
+                          Iterator                              last,
+                          std::size_t                           chunk_size)
+        : _fpb(&fpb),
+          _size(fpb.current_size()),
+          _it(first),
+          _last(last),
+          _chunk_size(chunk_size),
+          _chunk() {
+      if (chunk_size == 0) {
+        throw libsemigroups::LibsemigroupsException(
+            __FILE__, __LINE__, __func__, "the chunk size must be positive");
+      }
+      fill();
+    }
+
+    PackedWords const& get() const noexcept {
+      return _chunk;
+    }
+
+    PackedWords& get() noexcept {
+      return _chunk;
+    }
+
+    bool at_end() const noexcept {
+      return _chunk.number_of_words() == 0;
+    }
+
+    void next() {
+      if (_fpb->current_size() != _size) {
+        throw libsemigroups::LibsemigroupsException(
+            __FILE__,
+            __LINE__,
+            __func__,
+            "the FroidurePin has been enumerated further since the cursor "
+            "was created");
+      }
+      fill();
+    }
+
+    std::size_t chunk_size() const noexcept {
+      return _chunk_size;
+    }
+
+   private:
+    void fill() {
+      _chunk.clear();
+      for (std::size_t i = 0; i < _chunk_size && _it != _last; ++i, ++_it) {
+        _chunk.push_back(*_it);
+      }
+    }
+
+    libsemigroups::FroidurePinBase const* _fpb;
+    std::size_t                           _size;
+    Iterator                              _it;
+    Iterator                              _last;
+    std::size_t                           _chunk_size;
+    PackedWords                           _chunk;
+  };
+
+  using NormalFormsCursor = FroidurePinWordCursor<
+      libsemigroups::FroidurePinBase::const_normal_form_iterator>;
+  using RulesCursor = FroidurePinWordCursor<
+      libsemigroups::FroidurePinBase::const_rule_iterator>;
+
+}  // namespace libsemigroups_julia
+
 namespace jlcxx {
   template <>
   struct IsMirroredType<libsemigroups::FroidurePinBase> : std::false_type {};
@@ -41,6 +131,14 @@ namespace jlcxx {
   struct SuperType<libsemigroups::FroidurePinBase> {
     using type = libsemigroups::Runner;
   };
+
+  template <>
+  struct IsMirroredType<libsemigroups_julia::NormalFormsCursor>
+      : std::false_type {};
+
+  template <>
+  struct IsMirroredType<libsemigroups_julia::RulesCursor> : std::false_type {
+  };
 }  // namespace jlcxx
 
 namespace libsemigroups_julia {
@@ -328,80 +426,141 @@ namespace libsemigroups_julia {
                   return self.current_left_cayley_graph();
                 });
 
+    ////////////////////////////////////////////////////////////////////////
+    // Idempotents — a parallel scan of the right Cayley graph
+    ////////////////////////////////////////////////////////////////////////
+
+    // idempotent_flags!(fpb, out, nthreads) fully enumerates fpb, and sets
+    // out[i] to 1 if element i is an idempotent and to 0 otherwise. The
+    // product of element i with itself is the node reached from i by the
+    // letters of the word of i, read from first_letter and suffix, so no
+    // elements are multiplied. The Cayley graph is no longer modified once
+    // the enumeration is complete, so the elements are split into blocks
+    // scanned in parallel.
+    m.method("idempotent_flags!",
+             [](FroidurePinBase&         fpb,
+                jlcxx::ArrayRef<uint8_t> out,
+                std::size_t              nthreads) {
+               fpb.run();
+               std::size_t const n = fpb.current_size();
+               if (out.size() != n) {
+                 throw libsemigroups::LibsemigroupsException(
+                     __FILE__,
+                     __LINE__,
+                     __func__,
+                     "expected a buffer of length " + std::to_string(n)
+                         + ", found " + std::to_string(out.size()));
+               }
+               auto const&    g     = fpb.current_right_cayley_graph();
+               uint8_t* const flags = out.data();
+               for_each_block(
+                   n, nthreads, [&](size_t, size_t first, size_t last) {
+                     for (uint32_t i = first; i < last; ++i) {
+                       uint32_t node = i;
+                       uint32_t j    = i;
+                       while (j != libsemigroups::UNDEFINED) {
+                         node = g.target_no_checks(
+                             node, fpb.first_letter_no_checks(j));
+                         j = fpb.suffix_no_checks(j);
+                       }
+                       flags[i] = (node == i);
+                     }
+                   });
+             });
+
     ////////////////////////////////////////////////////////////////////////
     // Materialized collections — rules and normal forms
     ////////////////////////////////////////////////////////////////////////
     // const_rule_iterator dereferences to relation_type =
     //   std::pair<word_type, word_type>
-    // CxxWrap cannot return std::pair, so we split into two parallel
-    // vectors: rules_lhs and rules_rhs.
-
-    // rules_lhs / rules_rhs — full enumeration, then collect
-    m.method("rules_lhs", [](FroidurePinBase& fpb) -> std::vector<word_type> {
-      std::vector<word_type> result;
-      auto                   it  = fpb.cbegin_rules();
-      auto                   end = fpb.cend_rules();
-      for (; it != end; ++it) {
-        result.push_back((*it).first);
-      }
-      return result;
+    // CxxWrap cannot return std::pair, so rules are packed interleaved
+    // (lhs, rhs, lhs, rhs, ...) into one PackedWords, walking the rules once.
+
+    // rules — full enumeration, then collect
+    m.method("rules", [](FroidurePinBase& fpb) -> PackedWords {
+      auto first = fpb.cbegin_rules();
+      return PackedWords::from(first, fpb.cend_rules());
     });
 
-    m.method("rules_rhs", [](FroidurePinBase& fpb) -> std::vector<word_type> {
-      std::vector<word_type> result;
-      auto                   it  = fpb.cbegin_rules();
-      auto                   end = fpb.cend_rules();
-      for (; it != end; ++it) {
-        result.push_back((*it).second);
-      }
-      return result;
+    // current_rules — no enumeration
+    m.method("current_rules", [](FroidurePinBase const& fpb) -> PackedWords {
+      return PackedWords::from(fpb.cbegin_current_rules(),
+                               fpb.cend_current_rules());
     });
 
-    // current_rules_lhs / current_rules_rhs — no enumeration
-    m.method("current_rules_lhs",
-             [](FroidurePinBase const& fpb) -> std::vector<word_type> {
-               std::vector<word_type> result;
-               auto                   it  = fpb.cbegin_current_rules();
-               auto                   end = fpb.cend_current_rules();
-               for (; it != end; ++it) {
-                 result.push_back((*it).first);
-               }
-               return result;
+    // normal_forms — full enumeration, then collect
+    m.method("normal_forms", [](FroidurePinBase& fpb) -> PackedWords {
+      auto first = fpb.cbegin_normal_forms();
+      return PackedWords::from(first, fpb.cend_normal_forms());
+    });
+
+    // current_normal_forms — no enumeration
+    m.method("current_normal_forms",
+             [](FroidurePinBase const& fpb) -> PackedWords {
+               return PackedWords::from(fpb.cbegin_current_normal_forms(),
+                                        fpb.cend_current_normal_forms());
              });
 
-    m.method("current_rules_rhs",
-             [](FroidurePinBase const& fpb) -> std::vector<word_type> {
-               std::vector<word_type> result;
-               auto                   it  = fpb.cbegin_current_rules();
-               auto                   end = fpb.cend_current_rules();
-               for (; it != end; ++it) {
-                 result.push_back((*it).second);
-               }
-               return result;
+    ////////////////////////////////////////////////////////////////////////
+    // Chunked cursors — rules and normal forms without materialization
+    ////////////////////////////////////////////////////////////////////////
+
+    // `get` returns the current chunk by reference, so that it is copied
+    // only once, into the Julia arrays of the chunk; the reference is valid
+    // until the next call to `next!`.
+    auto nf_cursor = m.add_type<NormalFormsCursor>("NormalFormsCursor");
+    nf_cursor.method("get", [](NormalFormsCursor& self) -> PackedWords& {
+      return self.get();
+    });
+    nf_cursor.method("next!", [](NormalFormsCursor& self) { self.next(); });
+    nf_cursor.method("at_end", [](NormalFormsCursor const& self) -> bool {
+      return self.at_end();
+    });
+    nf_cursor.method("chunk_size",
+                     [](NormalFormsCursor const& self) -> std::size_t {
+                       return self.chunk_size();
+                     });
+
+    auto rules_cursor = m.add_type<RulesCursor>("RulesCursor");
+    rules_cursor.method(
+        "get", [](RulesCursor& self) -> PackedWords& { return self.get(); });
+    rules_cursor.method("next!", [](RulesCursor& self) { self.next(); });
+    rules_cursor.method("at_end", [](RulesCursor const& self) -> bool {
+      return self.at_end();
+    });
+    rules_cursor.method("chunk_size",
+                        [](RulesCursor const& self) -> std::size_t {
+                          return self.chunk_size();
+                        });
+
+    // Factories. The non-current variants trigger full enumeration, exactly
+    // like normal_forms / rules above; the current_* variants do not.
+    m.method("normal_forms_cursor",
+             [](FroidurePinBase& fpb, std::size_t chunk_size) {
+               auto first = fpb.cbegin_normal_forms();
+               return NormalFormsCursor(
+                   fpb, first, fpb.cend_normal_forms(), chunk_size);
              });
 
-    // normal_forms — full enumeration, collect into vector<word_type>
-    m.method("normal_forms",
-             [](FroidurePinBase& fpb) -> std::vector<word_type> {
-               std::vector<word_type> result;
-               auto                   it  = fpb.cbegin_normal_forms();
-               auto                   end = fpb.cend_normal_forms();
-               for (; it != end; ++it) {
-                 result.push_back(*it);
-               }
-               return result;
+    m.method("current_normal_forms_cursor",
+             [](FroidurePinBase const& fpb, std::size_t chunk_size) {
+               return NormalFormsCursor(fpb,
+                                        fpb.cbegin_current_normal_forms(),
+                                        fpb.cend_current_normal_forms(),
+                                        chunk_size);
              });
 
-    // current_normal_forms — no enumeration
-    m.method("current_normal_forms",
-             [](FroidurePinBase const& fpb) -> std::vector<word_type> {
-               std::vector<word_type> result;
-               auto                   it  = fpb.cbegin_current_normal_forms();
-               auto                   end = fpb.cend_current_normal_forms();
-               for (; it != end; ++it) {
-                 result.push_back(*it);
-               }
-               return result;
+    m.method("rules_cursor", [](FroidurePinBase& fpb, std::size_t chunk_size) {
+      auto first = fpb.cbegin_rules();
+      return RulesCursor(fpb, first, fpb.cend_rules(), chunk_size);
+    });
+
+    m.method("current_rules_cursor",
+             [](FroidurePinBase const& fpb, std::size_t chunk_size) {
+               return RulesCursor(fpb,
+                                  fpb.cbegin_current_rules(),
+                                  fpb.cend_current_rules(),
+                                  chunk_size);
              });
   }
 
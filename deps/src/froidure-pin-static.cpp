@@ -0,0 +1,70 @@
+//
+// Semigroups.jl
+// Copyright (C) 2026, James W. Swent
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+// FroidurePin<Transf<N, uint8_t>>, FroidurePin<PPerm<N, uint8_t>> and
+// FroidurePin<Perm<N, uint8_t>> for N = 1, ..., max_static_degree, bound
+// as FroidurePinStaticTransfN, FroidurePinStaticPPermN and
+// FroidurePinStaticPermN. They take and return the dynamic Transf1, PPerm1
+// and Perm1, see froidure-pin.hpp, and src/froidure-pin.jl selects them
+// from the degree of the generators.
+//
+// These are kept apart from froidure-pin.cpp since instantiating
+// 3 * max_static_degree FroidurePins is the bulk of the compile time.
+
+// CRITICAL: libsemigroups_julia.hpp MUST be included first (fmt consteval fix)
+#include "libsemigroups_julia.hpp"
+
+#include "froidure-pin.hpp"
+
+#include <libsemigroups/froidure-pin.hpp>
+#include <libsemigroups/transf.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+
+namespace libsemigroups_julia {
+
+  namespace {
+
+    template <size_t... N>
+    void bind_static_froidure_pins(jl::Module& m, std::index_sequence<N...>) {
+      using libsemigroups::Perm;
+      using libsemigroups::PPerm;
+      using libsemigroups::Transf;
+
+      // N + 1, so that the degrees are 1, ..., max_static_degree
+      (bind_froidure_pin<Transf<0, uint8_t>, Transf<N + 1, uint8_t>>(
+           m, "FroidurePinStaticTransf" + std::to_string(N + 1)),
+       ...);
+      (bind_froidure_pin<PPerm<0, uint8_t>, PPerm<N + 1, uint8_t>>(
+           m, "FroidurePinStaticPPerm" + std::to_string(N + 1)),
+       ...);
+      (bind_froidure_pin<Perm<0, uint8_t>, Perm<N + 1, uint8_t>>(
+           m, "FroidurePinStaticPerm" + std::to_string(N + 1)),
+       ...);
+    }
+
+  }  // namespace
+
+  void define_froidure_pin_static(jl::Module& m) {
+    bind_static_froidure_pins(m, std::make_index_sequence<max_static_degree>());
+  }
+
+}  // namespace libsemigroups_julia
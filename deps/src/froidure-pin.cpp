@@ -17,11 +17,18 @@
 //
 // This file exposes the libsemigroups FroidurePin<E> template class to Julia
 // via CxxWrap for all 10 element types (Transf1/2/4, PPerm1/2/4, Perm1/2/4,
-// BMat8). FroidurePin<E> inherits from FroidurePinBase.
+// BMat8). FroidurePin<E> inherits from FroidurePinBase. The read-only
+// FrozenFroidurePin<E> (see frozen-froidure-pin.hpp) is bound alongside it
+// for the same element types. The bindings of FroidurePin<E> itself are in
+// froidure-pin.hpp, shared with froidure-pin-static.cpp.
 
 // CRITICAL: libsemigroups_julia.hpp MUST be included first (fmt consteval fix)
 #include "libsemigroups_julia.hpp"
 
+#include "binding-profile.hpp"
+#include "froidure-pin.hpp"
+#include "frozen-froidure-pin.hpp"
+
 #include <libsemigroups/bmat8.hpp>
 #include <libsemigroups/froidure-pin.hpp>
 #include <libsemigroups/transf.hpp>
@@ -34,61 +41,16 @@
 #include <vector>
 
 ////////////////////////////////////////////////////////////////////////
-// CxxWrap type traits — IsMirroredType and SuperType specializations
+// CxxWrap type traits — FroidurePin<E> traits are in froidure-pin.hpp
 ////////////////////////////////////////////////////////////////////////
 
 namespace jlcxx {
 
-  // IsMirroredType — one per concrete FroidurePin instantiation
-  template <>
-  struct IsMirroredType<
-      libsemigroups::FroidurePin<libsemigroups::Transf<0, uint8_t>>>
-      : std::false_type {};
-  template <>
-  struct IsMirroredType<
-      libsemigroups::FroidurePin<libsemigroups::Transf<0, uint16_t>>>
-      : std::false_type {};
-  template <>
-  struct IsMirroredType<
-      libsemigroups::FroidurePin<libsemigroups::Transf<0, uint32_t>>>
-      : std::false_type {};
-
-  template <>
-  struct IsMirroredType<
-      libsemigroups::FroidurePin<libsemigroups::PPerm<0, uint8_t>>>
-      : std::false_type {};
-  template <>
-  struct IsMirroredType<
-      libsemigroups::FroidurePin<libsemigroups::PPerm<0, uint16_t>>>
-      : std::false_type {};
-  template <>
-  struct IsMirroredType<
-      libsemigroups::FroidurePin<libsemigroups::PPerm<0, uint32_t>>>
-      : std::false_type {};
-
-  template <>
-  struct IsMirroredType<
-      libsemigroups::FroidurePin<libsemigroups::Perm<0, uint8_t>>>
-      : std::false_type {};
-  template <>
-  struct IsMirroredType<
-      libsemigroups::FroidurePin<libsemigroups::Perm<0, uint16_t>>>
-      : std::false_type {};
-  template <>
-  struct IsMirroredType<
-      libsemigroups::FroidurePin<libsemigroups::Perm<0, uint32_t>>>
-      : std::false_type {};
-
-  template <>
-  struct IsMirroredType<libsemigroups::FroidurePin<libsemigroups::BMat8>>
+  // FrozenFroidurePin<E> holds a memory-mapped file, and is never mirrored
+  template <typename E>
+  struct IsMirroredType<libsemigroups_julia::FrozenFroidurePin<E>>
       : std::false_type {};
 
-  // SuperType — partial specialization for all FroidurePin<E>
-  template <typename E, typename T>
-  struct SuperType<libsemigroups::FroidurePin<E, T>> {
-    using type = libsemigroups::FroidurePinBase;
-  };
-
 }  // namespace jlcxx
 
 namespace libsemigroups_julia {
@@ -96,246 +58,102 @@ namespace libsemigroups_julia {
   namespace {
 
     ////////////////////////////////////////////////////////////////////////
-    // bind_froidure_pin<E> — template helper that registers all
-    // element-typed methods for a single FroidurePin<E> instantiation.
+    // bind_frozen_froidure_pin<E> — the read-only FrozenFroidurePin<E>
+    // opened from a file written by save_froidure_pin. Nothing here
+    // enumerates; every method reads the mapped file.
     ////////////////////////////////////////////////////////////////////////
 
     template <typename E>
-    void bind_froidure_pin(jl::Module& m, std::string const& name) {
-      using FP = libsemigroups::FroidurePin<E>;
-      using libsemigroups::FroidurePinBase;
+    void bind_frozen_froidure_pin(jl::Module& mod, std::string const& name) {
+      using Frozen = FrozenFroidurePin<E>;
       using libsemigroups::word_type;
 
-      auto type
-          = m.add_type<FP>(name, jlcxx::julia_base_type<FroidurePinBase>());
+      auto frozen = mod.add_type<Frozen>(name);
+      frozen.constructor<std::string const&>();
 
-      ////////////////////////////////////////////////////////////////////
-      // 1. Constructors — 1-4 generator arg lambdas
-      //    (Can't construct StdVector of wrapped types Julia-side)
-      ////////////////////////////////////////////////////////////////////
+      ProfiledMethods m(mod, name);
+      ProfiledMethods type(frozen, name);
 
-      m.method(name, [](E const& g1) {
-        std::vector<E> v{g1};
-        return FP(v.begin(), v.end());
+      type.method("path", [](Frozen const& self) -> std::string {
+        return self.path();
       });
-
-      m.method(name, [](E const& g1, E const& g2) {
-        std::vector<E> v{g1, g2};
-        return FP(v.begin(), v.end());
+      type.method("size",
+                  [](Frozen const& self) -> size_t { return self.size(); });
+      type.method("degree",
+                  [](Frozen const& self) -> size_t { return self.degree(); });
+      type.method("number_of_generators", [](Frozen const& self) -> size_t {
+        return self.number_of_generators();
       });
-
-      m.method(name, [](E const& g1, E const& g2, E const& g3) {
-        std::vector<E> v{g1, g2, g3};
-        return FP(v.begin(), v.end());
+      type.method("number_of_idempotents", [](Frozen const& self) -> size_t {
+        return self.number_of_idempotents();
       });
-
-      m.method(name, [](E const& g1, E const& g2, E const& g3, E const& g4) {
-        std::vector<E> v{g1, g2, g3, g4};
-        return FP(v.begin(), v.end());
+      type.method("has_left_cayley_graph", [](Frozen const& self) -> bool {
+        return self.has_left_cayley_graph();
       });
 
-      ////////////////////////////////////////////////////////////////////
-      // 2. Element access — ALL return by copy (GC safety)
-      ////////////////////////////////////////////////////////////////////
-
-      // at (triggers partial enumeration)
-      type.method("at", [](FP& self, size_t i) -> E { return self.at(i); });
-
-      // sorted_at (triggers full enumeration)
-      type.method("sorted_at",
-                  [](FP& self, size_t i) -> E { return self.sorted_at(i); });
-
-      // sorted_at_no_checks
-      type.method("sorted_at_no_checks", [](FP& self, size_t i) -> E {
-        return self.sorted_at_no_checks(i);
-      });
-
-      // generator (const self)
-      type.method("generator", [](FP const& self, size_t i) -> E {
+      // Elements — returned by copy, constructed from the mapped scalars
+      type.method("at",
+                  [](Frozen const& self, size_t i) -> E { return self.at(i); });
+      type.method("generator", [](Frozen const& self, size_t i) -> E {
         return self.generator(i);
       });
-
-      // generator_no_checks (const self)
-      type.method("generator_no_checks", [](FP const& self, size_t i) -> E {
-        return self.generator_no_checks(i);
+      type.method("sorted_at", [](Frozen const& self, size_t i) -> E {
+        return self.sorted_at(i);
       });
-
-      // getindex_no_checks — binds operator[], const self
-      type.method("getindex_no_checks",
-                  [](FP const& self, size_t i) -> E { return self[i]; });
-
-      ////////////////////////////////////////////////////////////////////
-      // 3. Containment / position
-      ////////////////////////////////////////////////////////////////////
-
-      // contains(FP&, E const&) -> bool
-      type.method("contains", [](FP& self, E const& x) -> bool {
-        return self.contains(x);
+      m.method("idempotents", [](Frozen const& self) -> std::vector<E> {
+        return self.idempotents();
       });
 
-      // position(FP&, E const&) -> element_index_type
-      type.method("position", [](FP& self, E const& x) -> uint32_t {
+      // Positions
+      type.method("position", [](Frozen const& self, E const& x) -> uint32_t {
         return self.position(x);
       });
-
-      // current_position(FP const&, E const&) -> element_index_type
-      type.method("current_position",
-                  [](FP const& self, E const& x) -> uint32_t {
-                    return self.current_position(x);
+      type.method("sorted_position",
+                  [](Frozen const& self, E const& x) -> uint32_t {
+                    return self.sorted_position(x);
+                  });
+      type.method("to_sorted_position",
+                  [](Frozen const& self, size_t i) -> uint32_t {
+                    return self.to_sorted_position(i);
+                  });
+      m.method("position",
+               [](Frozen const& self, jlcxx::ArrayRef<size_t> arr) -> uint32_t {
+                 word_type w = copy_word<word_type>(arr);
+                 return self.position(w);
+               });
+      type.method("position_of_generator",
+                  [](Frozen const& self, size_t i) -> uint32_t {
+                    return self.position_of_generator(i);
                   });
 
-      // sorted_position(FP&, E const&) -> element_index_type
-      type.method("sorted_position", [](FP& self, E const& x) -> uint32_t {
-        return self.sorted_position(x);
-      });
-
-      // to_sorted_position(FP&, size_t) -> element_index_type
-      type.method("to_sorted_position", [](FP& self, size_t i) -> uint32_t {
-        return self.to_sorted_position(i);
-      });
-
-      ////////////////////////////////////////////////////////////////////
-      // 4. Fast product
-      ////////////////////////////////////////////////////////////////////
-
+      // Products, factorisations and the stored arrays
       type.method("fast_product",
-                  [](FP const& self, size_t i, size_t j) -> uint32_t {
+                  [](Frozen const& self, size_t i, size_t j) -> uint32_t {
                     return self.fast_product(i, j);
                   });
-
-      type.method("fast_product_no_checks",
-                  [](FP const& self, size_t i, size_t j) -> uint32_t {
-                    return self.fast_product_no_checks(i, j);
-                  });
-
-      ////////////////////////////////////////////////////////////////////
-      // 5. Idempotents
-      ////////////////////////////////////////////////////////////////////
-
-      type.method("number_of_idempotents", [](FP& self) -> size_t {
-        return self.number_of_idempotents();
-      });
-
-      type.method("is_idempotent", [](FP& self, size_t i) -> bool {
-        return self.is_idempotent(i);
-      });
-
-      type.method("is_idempotent_no_checks", [](FP& self, size_t i) -> bool {
-        return self.is_idempotent_no_checks(i);
-      });
-
-      ////////////////////////////////////////////////////////////////////
-      // 6. Modification
-      ////////////////////////////////////////////////////////////////////
-
-      // add_generator! (void — Julia wrapper returns self)
-      type.method("add_generator!",
-                  [](FP& self, E const& x) { self.add_generator(x); });
-
-      // add_generator_no_checks!
-      type.method("add_generator_no_checks!", [](FP& self, E const& x) {
-        self.add_generator_no_checks(x);
-      });
-
-      // closure! — single element wrapped in 1-element vector
-      type.method("closure!", [](FP& self, E const& x) {
-        std::vector<E> v{x};
-        self.closure(v.begin(), v.end());
-      });
-
-      // copy_closure — single element, returns new FP by value
-      // NOTE: copy_closure is not const in C++ (it may enumerate)
-      type.method("copy_closure", [](FP& self, E const& x) -> FP {
-        std::vector<E> v{x};
-        return self.copy_closure(v.begin(), v.end());
-      });
-
-      // copy_add_generators — single element, returns new FP by value
-      type.method("copy_add_generators", [](FP const& self, E const& x) -> FP {
-        std::vector<E> v{x};
-        return self.copy_add_generators(v.begin(), v.end());
-      });
-
-      ////////////////////////////////////////////////////////////////////
-      // 7. Word-element conversion (ArrayRef<size_t> for Julia Vector{UInt})
-      ////////////////////////////////////////////////////////////////////
-
-      // to_element — returns by copy (volatile const_reference!)
-      m.method("to_element",
-               [](FP const& self, jlcxx::ArrayRef<size_t> arr) -> E {
-                 word_type w(arr.begin(), arr.end());
-                 return self.to_element(w.begin(), w.end());
-               });
-
-      // to_element_no_checks
-      m.method("to_element_no_checks",
-               [](FP const& self, jlcxx::ArrayRef<size_t> arr) -> E {
-                 word_type w(arr.begin(), arr.end());
-                 return self.to_element_no_checks(w.begin(), w.end());
-               });
-
-      // equal_to — two words
-      m.method("equal_to",
-               [](FP const&               self,
-                  jlcxx::ArrayRef<size_t> arr1,
-                  jlcxx::ArrayRef<size_t> arr2) -> bool {
-                 word_type w1(arr1.begin(), arr1.end());
-                 word_type w2(arr2.begin(), arr2.end());
-                 return self.equal_to(
-                     w1.begin(), w1.end(), w2.begin(), w2.end());
+      m.method("minimal_factorisation",
+               [](Frozen const& self, size_t i) -> word_type {
+                 return self.minimal_factorisation(i);
                });
-
-      // equal_to_no_checks
-      m.method("equal_to_no_checks",
-               [](FP const&               self,
-                  jlcxx::ArrayRef<size_t> arr1,
-                  jlcxx::ArrayRef<size_t> arr2) -> bool {
-                 word_type w1(arr1.begin(), arr1.end());
-                 word_type w2(arr2.begin(), arr2.end());
-                 return self.equal_to_no_checks(
-                     w1.begin(), w1.end(), w2.begin(), w2.end());
-               });
-
-      ////////////////////////////////////////////////////////////////////
-      // 8. Materialized collections
-      ////////////////////////////////////////////////////////////////////
-
-      // idempotents — iterate cbegin_idempotents..cend_idempotents
-      // Use !(it == end) to avoid C++20 ambiguous reversed operator!=
-      m.method("idempotents", [](FP& self) -> std::vector<E> {
-        std::vector<E> result;
-        auto           it  = self.cbegin_idempotents();
-        auto           end = self.cend_idempotents();
-        for (; !(it == end); ++it) {
-          result.push_back(*it);
-        }
-        return result;
+      type.method("prefix", [](Frozen const& self, size_t i) -> uint32_t {
+        return self.prefix(i);
       });
-
-      // sorted_elements — iterate cbegin_sorted..cend_sorted
-      // Use !(it == end) to avoid C++20 ambiguous reversed operator!=
-      m.method("sorted_elements", [](FP& self) -> std::vector<E> {
-        std::vector<E> result;
-        auto           it  = self.cbegin_sorted();
-        auto           end = self.cend_sorted();
-        for (; !(it == end); ++it) {
-          result.push_back(*it);
-        }
-        return result;
+      type.method("suffix", [](Frozen const& self, size_t i) -> uint32_t {
+        return self.suffix(i);
       });
-
-      ////////////////////////////////////////////////////////////////////
-      // 9. Memory
-      ////////////////////////////////////////////////////////////////////
-
-      type.method("reserve!", [](FP& self, size_t val) { self.reserve(val); });
-
-      ////////////////////////////////////////////////////////////////////
-      // 10. Display
-      ////////////////////////////////////////////////////////////////////
-
-      m.method("to_human_readable_repr", [](FP const& self) -> std::string {
-        return libsemigroups::to_human_readable_repr(self);
+      type.method("first_letter",
+                  [](Frozen const& self, size_t i) -> uint32_t {
+                    return self.first_letter(i);
+                  });
+      type.method("final_letter",
+                  [](Frozen const& self, size_t i) -> uint32_t {
+                    return self.final_letter(i);
+                  });
+      type.method("length", [](Frozen const& self, size_t i) -> size_t {
+        return self.length(i);
+      });
+      type.method("is_idempotent", [](Frozen const& self, size_t i) -> bool {
+        return self.is_idempotent(i);
       });
     }
 
@@ -365,6 +183,26 @@ namespace libsemigroups_julia {
 
     // BMat8
     bind_froidure_pin<BMat8>(m, "FroidurePinBMat8");
+
+    // Frozen FroidurePin, same element types
+    bind_frozen_froidure_pin<Transf<0, uint8_t>>(m, "FrozenFroidurePinTransf1");
+    bind_frozen_froidure_pin<Transf<0, uint16_t>>(m,
+                                                  "FrozenFroidurePinTransf2");
+    bind_frozen_froidure_pin<Transf<0, uint32_t>>(m,
+                                                  "FrozenFroidurePinTransf4");
+    bind_frozen_froidure_pin<PPerm<0, uint8_t>>(m, "FrozenFroidurePinPPerm1");
+    bind_frozen_froidure_pin<PPerm<0, uint16_t>>(m, "FrozenFroidurePinPPerm2");
+    bind_frozen_froidure_pin<PPerm<0, uint32_t>>(m, "FrozenFroidurePinPPerm4");
+    bind_frozen_froidure_pin<Perm<0, uint8_t>>(m, "FrozenFroidurePinPerm1");
+    bind_frozen_froidure_pin<Perm<0, uint16_t>>(m, "FrozenFroidurePinPerm2");
+    bind_frozen_froidure_pin<Perm<0, uint32_t>>(m, "FrozenFroidurePinPerm4");
+    bind_frozen_froidure_pin<BMat8>(m, "FrozenFroidurePinBMat8");
+
+    // 1-3 Transf1/2/4, 4-6 PPerm1/2/4, 7-9 Perm1/2/4, 10 BMat8
+    m.method("frozen_froidure_pin_element_code",
+             [](std::string const& path) -> uint32_t {
+               return frozen_froidure_pin_element_code(path);
+             });
   }
 
 }  // namespace libsemigroups_julia
@@ -0,0 +1,557 @@
+//
+// Semigroups.jl
+// Copyright (C) 2026, James W. Swent
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+// bind_froidure_pin<E, Stored>, shared by froidure-pin.cpp, which binds
+// FroidurePin<E> for the dynamic-degree element types and BMat8, and
+// froidure-pin-static.cpp, which binds FroidurePin<Transf<N, uint8_t>> and
+// friends for small static degrees N.
+//
+// Julia only ever passes and receives elements of type E (e.g. the dynamic
+// Transf<0, uint8_t>). When the FroidurePin stores a different, static
+// degree type `Stored`, elements are converted at the boundary: every
+// element in the FroidurePin's element store and hash table is then a
+// fixed-size array rather than a heap-allocated std::vector.
+
+#ifndef LIBSEMIGROUPS_JULIA_FROIDURE_PIN_HPP_
+#define LIBSEMIGROUPS_JULIA_FROIDURE_PIN_HPP_
+
+// CRITICAL: libsemigroups_julia.hpp MUST be included first (fmt consteval fix)
+#include "libsemigroups_julia.hpp"
+
+#include "binding-profile.hpp"
+#include "frozen-froidure-pin.hpp"
+#include "parallel-froidure-pin.hpp"
+
+#include <libsemigroups/bmat8.hpp>
+#include <libsemigroups/constants.hpp>
+#include <libsemigroups/exception.hpp>
+#include <libsemigroups/froidure-pin.hpp>
+#include <libsemigroups/transf.hpp>
+
+#include <jlcxx/array.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////
+// CxxWrap type traits — IsMirroredType and SuperType specializations
+////////////////////////////////////////////////////////////////////////
+
+namespace jlcxx {
+
+  // IsMirroredType — for every FroidurePin<E>, of dynamic or static degree
+  template <size_t N, typename Scalar>
+  struct IsMirroredType<
+      libsemigroups::FroidurePin<libsemigroups::Transf<N, Scalar>>>
+      : std::false_type {};
+
+  template <size_t N, typename Scalar>
+  struct IsMirroredType<
+      libsemigroups::FroidurePin<libsemigroups::PPerm<N, Scalar>>>
+      : std::false_type {};
+
+  template <size_t N, typename Scalar>
+  struct IsMirroredType<
+      libsemigroups::FroidurePin<libsemigroups::Perm<N, Scalar>>>
+      : std::false_type {};
+
+  template <>
+  struct IsMirroredType<libsemigroups::FroidurePin<libsemigroups::BMat8>>
+      : std::false_type {};
+
+  // SuperType — partial specialization for all FroidurePin<E>
+  template <typename E, typename T>
+  struct SuperType<libsemigroups::FroidurePin<E, T>> {
+    using type = libsemigroups::FroidurePinBase;
+  };
+
+}  // namespace jlcxx
+
+namespace libsemigroups_julia {
+
+  ////////////////////////////////////////////////////////////////////////
+  // Static degree elements
+  ////////////////////////////////////////////////////////////////////////
+
+  // The degree of every element of type E, or 0 if E has dynamic degree
+  template <typename E>
+  inline constexpr size_t static_degree_v = 0;
+
+  template <size_t N, typename Scalar>
+  inline constexpr size_t static_degree_v<libsemigroups::Transf<N, Scalar>>
+      = N;
+
+  template <size_t N, typename Scalar>
+  inline constexpr size_t static_degree_v<libsemigroups::PPerm<N, Scalar>>
+      = N;
+
+  template <size_t N, typename Scalar>
+  inline constexpr size_t static_degree_v<libsemigroups::Perm<N, Scalar>>
+      = N;
+
+  // The largest static degree bound by froidure-pin-static.cpp; the Julia
+  // side selects the static FroidurePin for degrees 1 to this.
+  inline constexpr size_t max_static_degree = 16;
+
+  // Whether `x` has the degree of the elements of type Stored; always true
+  // if Stored has dynamic degree, since FroidurePin then checks the degree
+  // itself.
+  template <typename Stored, typename E>
+  bool has_stored_degree(E const& x) {
+    if constexpr (static_degree_v<Stored> == 0) {
+      return true;
+    } else {
+      return x.degree() == static_degree_v<Stored>;
+    }
+  }
+
+  // `x` as an element of type Stored, which is `x` itself if Stored is E.
+  template <typename Stored, typename E>
+  decltype(auto) to_stored(E const& x) {
+    if constexpr (std::is_same_v<Stored, E>) {
+      return (x);
+    } else {
+      if (!has_stored_degree<Stored>(x)) {
+        throw libsemigroups::LibsemigroupsException(
+            __FILE__,
+            __LINE__,
+            __func__,
+            "expected an element of degree "
+                + std::to_string(static_degree_v<Stored>) + ", found "
+                + std::to_string(x.degree()));
+      }
+      Stored result;
+      std::copy(x.cbegin(), x.cend(), result.begin());
+      return result;
+    }
+  }
+
+  // A copy of the stored element `x` as an element of type E.
+  template <typename E, typename Stored>
+  E from_stored(Stored const& x) {
+    if constexpr (std::is_same_v<Stored, E>) {
+      return x;
+    } else {
+      E result = E::one(static_degree_v<Stored>);
+      std::copy(x.cbegin(), x.cend(), result.begin());
+      return result;
+    }
+  }
+
+  // An estimate of the bytes libsemigroups' FroidurePin<Stored> uses per
+  // element in its element store: a pointer to a heap allocated copy, plus
+  // the images on the heap if the degree is dynamic. A BMat8 is stored by
+  // value.
+  template <typename Stored>
+  size_t stored_element_bytes(size_t degree) {
+    if constexpr (std::is_same_v<Stored, libsemigroups::BMat8>) {
+      return sizeof(Stored);
+    } else if constexpr (static_degree_v<Stored> != 0) {
+      return sizeof(void*) + sizeof(Stored);
+    } else {
+      return sizeof(void*) + sizeof(Stored)
+             + degree * sizeof(typename Stored::point_type);
+    }
+  }
+
+  // The elements whose images are stored one after another in `images`, as
+  // in the columns of a PackedElementVector (see src/packed-elements.jl),
+  // each in the layout of FrozenElement<Stored>.
+  template <typename Stored>
+  std::vector<Stored> unpack_elements(
+      jlcxx::ArrayRef<typename FrozenElement<Stored>::scalar_type> images,
+      size_t                                                        degree) {
+    using Element = FrozenElement<Stored>;
+    if constexpr (static_degree_v<Stored> != 0) {
+      if (degree != static_degree_v<Stored>) {
+        throw libsemigroups::LibsemigroupsException(
+            __FILE__,
+            __LINE__,
+            __func__,
+            "expected elements of degree "
+                + std::to_string(static_degree_v<Stored>) + ", found "
+                + std::to_string(degree));
+      }
+    }
+    size_t const width = Element::width(degree);
+    if (width == 0 || images.size() % width != 0) {
+      throw libsemigroups::LibsemigroupsException(
+          __FILE__,
+          __LINE__,
+          __func__,
+          "expected a buffer whose length is a multiple of "
+              + std::to_string(width) + ", found "
+              + std::to_string(images.size()));
+    }
+    count_bytes_copied(images.size() * sizeof(typename Element::scalar_type));
+    std::vector<Stored> result;
+    result.reserve(images.size() / width);
+    for (size_t i = 0; i < images.size(); i += width) {
+      result.push_back(Element::read(images.data() + i, degree));
+    }
+    return result;
+  }
+
+  ////////////////////////////////////////////////////////////////////////
+  // bind_froidure_pin<E, Stored> — registers all element-typed methods for
+  // a single FroidurePin<Stored> instantiation, taking and returning
+  // elements of type E.
+  ////////////////////////////////////////////////////////////////////////
+
+  template <typename E, typename Stored = E>
+  void bind_froidure_pin(jl::Module& mod, std::string const& name) {
+    using FP     = libsemigroups::FroidurePin<Stored>;
+    using Images = jlcxx::ArrayRef<typename FrozenElement<Stored>::scalar_type>;
+    using libsemigroups::FroidurePinBase;
+    using libsemigroups::word_type;
+
+    ProfiledMethods m(mod, name);
+    ProfiledMethods type(
+        mod.add_type<FP>(name, jlcxx::julia_base_type<FroidurePinBase>()),
+        name);
+
+    ////////////////////////////////////////////////////////////////////
+    // 1. Constructors — 1-4 generator arg lambdas, or any number of
+    //    generators from their packed images
+    //    (Can't construct StdVector of wrapped types Julia-side)
+    ////////////////////////////////////////////////////////////////////
+
+    m.method(name, [](E const& g1) {
+      std::vector<Stored> v{to_stored<Stored>(g1)};
+      return FP(v.begin(), v.end());
+    });
+
+    m.method(name, [](E const& g1, E const& g2) {
+      std::vector<Stored> v{to_stored<Stored>(g1),
+                            to_stored<Stored>(g2)};
+      return FP(v.begin(), v.end());
+    });
+
+    m.method(name, [](E const& g1, E const& g2, E const& g3) {
+      std::vector<Stored> v{to_stored<Stored>(g1),
+                            to_stored<Stored>(g2),
+                            to_stored<Stored>(g3)};
+      return FP(v.begin(), v.end());
+    });
+
+    m.method(name, [](E const& g1, E const& g2, E const& g3, E const& g4) {
+      std::vector<Stored> v{to_stored<Stored>(g1),
+                            to_stored<Stored>(g2),
+                            to_stored<Stored>(g3),
+                            to_stored<Stored>(g4)};
+      return FP(v.begin(), v.end());
+    });
+
+    // Any number of generators, from their packed images
+    m.method(name, [](Images images, size_t degree) {
+      auto v = unpack_elements<Stored>(images, degree);
+      return FP(v.begin(), v.end());
+    });
+
+    ////////////////////////////////////////////////////////////////////
+    // 2. Element access — ALL return by copy (GC safety)
+    ////////////////////////////////////////////////////////////////////
+
+    // at (triggers partial enumeration)
+    type.method("at", [](FP& self, size_t i) -> E {
+      return from_stored<E>(self.at(i));
+    });
+
+    // sorted_at (triggers full enumeration)
+    type.method("sorted_at", [](FP& self, size_t i) -> E {
+      return from_stored<E>(self.sorted_at(i));
+    });
+
+    // sorted_at_no_checks
+    type.method("sorted_at_no_checks", [](FP& self, size_t i) -> E {
+      return from_stored<E>(self.sorted_at_no_checks(i));
+    });
+
+    // generator (const self)
+    type.method("generator", [](FP const& self, size_t i) -> E {
+      return from_stored<E>(self.generator(i));
+    });
+
+    // generator_no_checks (const self)
+    type.method("generator_no_checks", [](FP const& self, size_t i) -> E {
+      return from_stored<E>(self.generator_no_checks(i));
+    });
+
+    // getindex_no_checks — binds operator[], const self
+    type.method("getindex_no_checks", [](FP const& self, size_t i) -> E {
+      return from_stored<E>(self[i]);
+    });
+
+    ////////////////////////////////////////////////////////////////////
+    // 3. Containment / position
+    ////////////////////////////////////////////////////////////////////
+
+    // An element of the wrong degree is in no FroidurePin<Stored>, as for
+    // dynamic degrees, where FroidurePin<E> checks the degree itself.
+
+    // contains(FP&, E const&) -> bool
+    type.method("contains", [](FP& self, E const& x) -> bool {
+      return has_stored_degree<Stored>(x)
+             && self.contains(to_stored<Stored>(x));
+    });
+
+    // position(FP&, E const&) -> element_index_type
+    type.method("position", [](FP& self, E const& x) -> uint32_t {
+      if (!has_stored_degree<Stored>(x)) {
+        return libsemigroups::UNDEFINED;
+      }
+      return self.position(to_stored<Stored>(x));
+    });
+
+    // current_position(FP const&, E const&) -> element_index_type
+    type.method("current_position",
+                [](FP const& self, E const& x) -> uint32_t {
+                  if (!has_stored_degree<Stored>(x)) {
+                    return libsemigroups::UNDEFINED;
+                  }
+                  return self.current_position(to_stored<Stored>(x));
+                });
+
+    // sorted_position(FP&, E const&) -> element_index_type
+    type.method("sorted_position", [](FP& self, E const& x) -> uint32_t {
+      if (!has_stored_degree<Stored>(x)) {
+        return libsemigroups::UNDEFINED;
+      }
+      return self.sorted_position(to_stored<Stored>(x));
+    });
+
+    // to_sorted_position(FP&, size_t) -> element_index_type
+    type.method("to_sorted_position", [](FP& self, size_t i) -> uint32_t {
+      return self.to_sorted_position(i);
+    });
+
+    // sorted_positions!(FP&, order, rank) fully enumerates and sorts, then
+    // writes the position of the k-th smallest element to order[k], and
+    // the sorted position of element i to rank[i]. libsemigroups keeps the
+    // sorted elements after the first call, so this is a copy of them.
+    type.method("sorted_positions!",
+                [](FP&                       self,
+                   jlcxx::ArrayRef<uint32_t> order,
+                   jlcxx::ArrayRef<uint32_t> rank) {
+                  size_t const n = self.size();
+                  if (order.size() != n || rank.size() != n) {
+                    throw libsemigroups::LibsemigroupsException(
+                        __FILE__,
+                        __LINE__,
+                        __func__,
+                        "expected buffers of length " + std::to_string(n));
+                  }
+                  for (size_t i = 0; i < n; ++i) {
+                    uint32_t const k = self.to_sorted_position(i);
+                    rank[i]          = k;
+                    order[k]         = i;
+                  }
+                });
+
+    ////////////////////////////////////////////////////////////////////
+    // 4. Fast product
+    ////////////////////////////////////////////////////////////////////
+
+    type.method("fast_product",
+                [](FP const& self, size_t i, size_t j) -> uint32_t {
+                  return self.fast_product(i, j);
+                });
+
+    type.method("fast_product_no_checks",
+                [](FP const& self, size_t i, size_t j) -> uint32_t {
+                  return self.fast_product_no_checks(i, j);
+                });
+
+    ////////////////////////////////////////////////////////////////////
+    // 5. Idempotents
+    ////////////////////////////////////////////////////////////////////
+
+    type.method("number_of_idempotents", [](FP& self) -> size_t {
+      return self.number_of_idempotents();
+    });
+
+    type.method("is_idempotent", [](FP& self, size_t i) -> bool {
+      return self.is_idempotent(i);
+    });
+
+    type.method("is_idempotent_no_checks", [](FP& self, size_t i) -> bool {
+      return self.is_idempotent_no_checks(i);
+    });
+
+    ////////////////////////////////////////////////////////////////////
+    // 6. Modification
+    ////////////////////////////////////////////////////////////////////
+
+    // add_generator! (void — Julia wrapper returns self)
+    type.method("add_generator!", [](FP& self, E const& x) {
+      self.add_generator(to_stored<Stored>(x));
+    });
+
+    // add_generator_no_checks!
+    type.method("add_generator_no_checks!", [](FP& self, E const& x) {
+      self.add_generator_no_checks(to_stored<Stored>(x));
+    });
+
+    // closure! — single element wrapped in 1-element vector
+    type.method("closure!", [](FP& self, E const& x) {
+      std::vector<Stored> v{to_stored<Stored>(x)};
+      self.closure(v.begin(), v.end());
+    });
+
+    // copy_closure — single element, returns new FP by value
+    // NOTE: copy_closure is not const in C++ (it may enumerate)
+    type.method("copy_closure", [](FP& self, E const& x) -> FP {
+      std::vector<Stored> v{to_stored<Stored>(x)};
+      return self.copy_closure(v.begin(), v.end());
+    });
+
+    // copy_add_generators — single element, returns new FP by value
+    type.method("copy_add_generators", [](FP const& self, E const& x) -> FP {
+      std::vector<Stored> v{to_stored<Stored>(x)};
+      return self.copy_add_generators(v.begin(), v.end());
+    });
+
+    // The same for many elements at once, from their packed images, so that
+    // FroidurePin is only re-initialised once
+    type.method("add_generators!",
+                [](FP& self, Images images, size_t degree) {
+                  auto v = unpack_elements<Stored>(images, degree);
+                  self.add_generators(v.begin(), v.end());
+                });
+
+    type.method("closure!", [](FP& self, Images images, size_t degree) {
+      auto v = unpack_elements<Stored>(images, degree);
+      self.closure(v.begin(), v.end());
+    });
+
+    type.method("copy_closure",
+                [](FP& self, Images images, size_t degree) -> FP {
+                  auto v = unpack_elements<Stored>(images, degree);
+                  return self.copy_closure(v.begin(), v.end());
+                });
+
+    type.method("copy_add_generators",
+                [](FP const& self, Images images, size_t degree) -> FP {
+                  auto v = unpack_elements<Stored>(images, degree);
+                  return self.copy_add_generators(v.begin(), v.end());
+                });
+
+    ////////////////////////////////////////////////////////////////////
+    // 7. Word-element conversion (ArrayRef<size_t> for Julia Vector{UInt})
+    ////////////////////////////////////////////////////////////////////
+
+    // to_element — returns by copy (volatile const_reference!)
+    m.method("to_element",
+             [](FP const& self, jlcxx::ArrayRef<size_t> arr) -> E {
+               word_type w = copy_word<word_type>(arr);
+               return from_stored<E>(self.to_element(w.begin(), w.end()));
+             });
+
+    // to_element_no_checks
+    m.method("to_element_no_checks",
+             [](FP const& self, jlcxx::ArrayRef<size_t> arr) -> E {
+               word_type w = copy_word<word_type>(arr);
+               return from_stored<E>(
+                   self.to_element_no_checks(w.begin(), w.end()));
+             });
+
+    // equal_to — two words
+    m.method("equal_to",
+             [](FP const&               self,
+                jlcxx::ArrayRef<size_t> arr1,
+                jlcxx::ArrayRef<size_t> arr2) -> bool {
+               word_type w1 = copy_word<word_type>(arr1);
+               word_type w2 = copy_word<word_type>(arr2);
+               return self.equal_to(
+                   w1.begin(), w1.end(), w2.begin(), w2.end());
+             });
+
+    // equal_to_no_checks
+    m.method("equal_to_no_checks",
+             [](FP const&               self,
+                jlcxx::ArrayRef<size_t> arr1,
+                jlcxx::ArrayRef<size_t> arr2) -> bool {
+               word_type w1 = copy_word<word_type>(arr1);
+               word_type w2 = copy_word<word_type>(arr2);
+               return self.equal_to_no_checks(
+                   w1.begin(), w1.end(), w2.begin(), w2.end());
+             });
+
+    ////////////////////////////////////////////////////////////////////
+    // 8. Memory
+    ////////////////////////////////////////////////////////////////////
+
+    type.method("reserve!", [](FP& self, size_t val) { self.reserve(val); });
+
+    // memory_usage(FP const&) -> estimated bytes for the elements found so
+    // far, in the order: element store, hash table, right and left Cayley
+    // graphs, the table of reduced pairs from which the rules are read, and
+    // the prefix, suffix, enumeration order, first and final letters and
+    // length of each element. The sizes are those of the containers in
+    // FroidurePin and FroidurePinBase, ignoring spare capacity.
+    type.method("memory_usage", [](FP const& self) -> std::vector<size_t> {
+      size_t const n = self.current_size();
+      size_t const g = self.number_of_generators();
+      size_t const d = (n == 0 ? 0 : self.degree());
+      return {n * stored_element_bytes<Stored>(d),
+              // a std::unordered_map node (next, key, value, hash) and bucket
+              n * 5 * sizeof(void*),
+              n * g * sizeof(uint32_t),
+              n * g * sizeof(uint32_t),
+              (n * g + 7) / 8,
+              n * (3 * sizeof(uint32_t) + 3 * sizeof(size_t))};
+    });
+
+    ////////////////////////////////////////////////////////////////////
+    // 9. Persistence (see bind_frozen_froidure_pin)
+    ////////////////////////////////////////////////////////////////////
+
+    // save_froidure_pin (triggers full enumeration). With nthreads > 1, or
+    // in compact mode, a FroidurePin that has not started running is
+    // enumerated by a ParallelFroidurePin instead, which numbers the
+    // elements the same way, and self is left as it was.
+    m.method("save_froidure_pin",
+             [](FP&                self,
+                std::string const& path,
+                size_t             nthreads,
+                bool               compact) {
+               if ((nthreads <= 1 && !compact) || self.started()
+                   || self.number_of_generators() == 0) {
+                 save_froidure_pin(self, path, compact);
+               } else {
+                 ParallelFroidurePin<Stored> p(self, nthreads, compact);
+                 save_froidure_pin(p, path, compact);
+               }
+             });
+
+    ////////////////////////////////////////////////////////////////////
+    // 10. Display
+    ////////////////////////////////////////////////////////////////////
+
+    m.method("to_human_readable_repr", [](FP const& self) -> std::string {
+      return libsemigroups::to_human_readable_repr(self);
+    });
+  }
+
+}  // namespace libsemigroups_julia
+
+#endif  // LIBSEMIGROUPS_JULIA_FROIDURE_PIN_HPP_
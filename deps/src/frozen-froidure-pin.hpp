@@ -0,0 +1,603 @@
+//
+// Semigroups.jl
+// Copyright (C) 2026, James W. Swent
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+// The results of a fully enumerated FroidurePin<E> on disk, and a
+// read-only FrozenFroidurePin<E> that answers queries directly from the
+// mapped file, so that a semigroup enumerated once can be queried by later
+// processes without enumerating it again.
+//
+// File layout (native endianness, every section 8-byte aligned):
+//
+//   FrozenFroidurePinHeader
+//   scalar_type elements[size * width]        element i in enumeration order
+//   uint32_t    generators[number_of_generators]   position of generator a
+//   uint32_t    right[size * number_of_generators]  right Cayley graph
+//   uint32_t    left[size * number_of_generators]   left Cayley graph, absent
+//                                                    if the header is compact
+//   uint32_t    prefix[size], suffix[size], first[size], final[size]
+//   uint32_t    length[size]
+//   uint32_t    sorted[size]                  index of sorted element i
+//   uint32_t    to_sorted[size]               sorted position of element i
+//   uint32_t    idempotents[number_of_idempotents]   in increasing order
+//
+// Undefined positions (the prefix and suffix of a generator) are stored as
+// UNDEFINED, i.e. ~0. A compact file, flagged as such in its header, has no
+// left Cayley graph; products are then always computed through the right
+// Cayley graph. The header is validated when a file is opened, and the file
+// must have exactly the size that it implies; the sections themselves are
+// trusted to have been written by save_froidure_pin, so that opening a file
+// does not read all of it.
+
+#ifndef LIBSEMIGROUPS_JULIA_FROZEN_FROIDURE_PIN_HPP_
+#define LIBSEMIGROUPS_JULIA_FROZEN_FROIDURE_PIN_HPP_
+
+// CRITICAL: libsemigroups_julia.hpp MUST be included first (fmt consteval fix)
+#include "libsemigroups_julia.hpp"
+
+#include "mapped-file.hpp"
+
+#include <libsemigroups/bmat8.hpp>
+#include <libsemigroups/constants.hpp>
+#include <libsemigroups/froidure-pin.hpp>
+#include <libsemigroups/transf.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace libsemigroups_julia {
+
+  ////////////////////////////////////////////////////////////////////////
+  // FrozenElement<E> — how elements of type E are stored
+  ////////////////////////////////////////////////////////////////////////
+
+  // Each element is stored as `width(degree)` scalars, compared
+  // lexicographically, which is the order used by operator< in
+  // libsemigroups for all of the element types below. `code` identifies the
+  // element type in the file header. Static and dynamic degree elements with
+  // the same scalar type share a code, so either can be saved and the file
+  // is always opened with the dynamic type.
+  template <typename E>
+  struct FrozenElement;
+
+  template <typename E, uint32_t Family>
+  struct FrozenPTransfElement {
+    using scalar_type = typename E::point_type;
+
+    static constexpr uint32_t code
+        = Family + (sizeof(scalar_type) == 1 ? 0 : sizeof(scalar_type) / 2);
+
+    static size_t width(size_t degree) noexcept {
+      return degree;
+    }
+
+    static bool has_degree(E const& x, size_t degree) noexcept {
+      return x.degree() == degree;
+    }
+
+    static void write(E const& x, scalar_type* out) {
+      std::copy(x.begin(), x.end(), out);
+    }
+
+    static E read(scalar_type const* in, size_t degree) {
+      return libsemigroups::make<E>(
+          std::vector<scalar_type>(in, in + degree));
+    }
+  };
+
+  template <size_t N, typename Scalar>
+  struct FrozenElement<libsemigroups::Transf<N, Scalar>>
+      : FrozenPTransfElement<libsemigroups::Transf<N, Scalar>, 1> {};
+
+  template <size_t N, typename Scalar>
+  struct FrozenElement<libsemigroups::PPerm<N, Scalar>>
+      : FrozenPTransfElement<libsemigroups::PPerm<N, Scalar>, 4> {};
+
+  template <size_t N, typename Scalar>
+  struct FrozenElement<libsemigroups::Perm<N, Scalar>>
+      : FrozenPTransfElement<libsemigroups::Perm<N, Scalar>, 7> {};
+
+  template <>
+  struct FrozenElement<libsemigroups::BMat8> {
+    using scalar_type = uint64_t;
+
+    static constexpr uint32_t code = 10;
+
+    static size_t width(size_t) noexcept {
+      return 1;
+    }
+
+    static bool has_degree(libsemigroups::BMat8 const&, size_t) noexcept {
+      return true;
+    }
+
+    static void write(libsemigroups::BMat8 const& x, scalar_type* out) {
+      *out = x.to_int();
+    }
+
+    static libsemigroups::BMat8 read(scalar_type const* in, size_t) {
+      return libsemigroups::BMat8(*in);
+    }
+  };
+
+  ////////////////////////////////////////////////////////////////////////
+  // File header
+  ////////////////////////////////////////////////////////////////////////
+
+  inline constexpr char frozen_froidure_pin_magic[8]
+      = {'S', 'G', 'J', 'L', 'F', 'P', 'I', 'N'};
+  inline constexpr uint32_t frozen_froidure_pin_version = 1;
+
+  struct FrozenFroidurePinHeader {
+    char     magic[8];
+    uint32_t version;
+    uint32_t element_code;
+    uint64_t degree;
+    uint64_t size;
+    uint64_t number_of_generators;
+    uint64_t number_of_idempotents;
+    uint64_t compact;  // 1 if there is no left Cayley graph, 0 otherwise
+  };
+
+  static_assert(sizeof(FrozenFroidurePinHeader) % 8 == 0);
+
+  template <typename T>
+  size_t frozen_section_bytes(uint64_t n) noexcept {
+    return (n * sizeof(T) + 7) / 8 * 8;
+  }
+
+  ////////////////////////////////////////////////////////////////////////
+  // Writing
+  ////////////////////////////////////////////////////////////////////////
+
+  // Fully enumerates `fp` and writes it to `path`, without the left Cayley
+  // graph if `compact` is true. `fp` is a libsemigroups::FroidurePin<E>, or
+  // a ParallelFroidurePin<E> from parallel-froidure-pin.hpp, which has the
+  // same member functions for everything used here.
+  template <typename FP>
+  void save_froidure_pin(FP&                fp,
+                         std::string const& path,
+                         bool               compact = false) {
+    using E           = typename FP::element_type;
+    using Element     = FrozenElement<E>;
+    using scalar_type = typename Element::scalar_type;
+
+    fp.run();
+    size_t const n     = fp.size();
+    size_t const ngens = fp.number_of_generators();
+    size_t const deg   = fp.degree();
+    size_t const width = Element::width(deg);
+
+    AtomicFileWriter        out(path, "FroidurePin");
+    FrozenFroidurePinHeader h{};
+    std::memcpy(h.magic, frozen_froidure_pin_magic, sizeof(h.magic));
+    h.version               = frozen_froidure_pin_version;
+    h.element_code          = Element::code;
+    h.degree                = deg;
+    h.size                  = n;
+    h.number_of_generators  = ngens;
+    h.number_of_idempotents = fp.number_of_idempotents();
+    h.compact               = compact;
+    out.write(&h, 1);
+
+    std::vector<scalar_type> elements(n * width);
+    for (size_t i = 0; i < n; ++i) {
+      Element::write(fp[i], elements.data() + i * width);
+    }
+    out.write(elements.data(), elements.size());
+    out.align();
+
+    std::vector<uint32_t> column;
+    auto                  write_column = [&](auto&& f, size_t m) {
+      column.resize(m);
+      for (size_t i = 0; i < m; ++i) {
+        column[i] = f(i);
+      }
+      out.write(column.data(), m);
+      out.align();
+    };
+
+    write_column(
+        [&](size_t a) { return fp.position_of_generator_no_checks(a); },
+        ngens);
+    auto const& right = fp.right_cayley_graph();
+    write_column(
+        [&](size_t k) {
+          return right.target_no_checks(k / ngens, k % ngens);
+        },
+        n * ngens);
+    if (!compact) {
+      auto const& left = fp.left_cayley_graph();
+      write_column(
+          [&](size_t k) {
+            return left.target_no_checks(k / ngens, k % ngens);
+          },
+          n * ngens);
+    }
+    write_column([&](size_t i) { return fp.prefix_no_checks(i); }, n);
+    write_column([&](size_t i) { return fp.suffix_no_checks(i); }, n);
+    write_column([&](size_t i) { return fp.first_letter_no_checks(i); }, n);
+    write_column([&](size_t i) { return fp.final_letter_no_checks(i); }, n);
+    write_column([&](size_t i) { return fp.length_no_checks(i); }, n);
+
+    // The sorted order is libsemigroups' own, but FrozenFroidurePin finds
+    // elements by binary search on the stored scalars, so check that the
+    // two orders agree.
+    std::vector<uint32_t> to_sorted(n), sorted(n);
+    for (size_t i = 0; i < n; ++i) {
+      to_sorted[i]         = fp.to_sorted_position(i);
+      sorted[to_sorted[i]] = i;
+    }
+    for (size_t i = 1; i < n; ++i) {
+      scalar_type const* x = elements.data() + sorted[i - 1] * width;
+      scalar_type const* y = elements.data() + sorted[i] * width;
+      if (!std::lexicographical_compare(x, x + width, y, y + width)) {
+        throw file_error(
+            "FroidurePin", path, "elements are not sorted lexicographically");
+      }
+    }
+    write_column([&](size_t i) { return sorted[i]; }, n);
+    write_column([&](size_t i) { return to_sorted[i]; }, n);
+
+    column.clear();
+    for (size_t i = 0; i < n; ++i) {
+      if (fp.is_idempotent_no_checks(i)) {
+        column.push_back(i);
+      }
+    }
+    out.write(column.data(), column.size());
+    out.align();
+    out.commit();
+  }
+
+  ////////////////////////////////////////////////////////////////////////
+  // Reading
+  ////////////////////////////////////////////////////////////////////////
+
+  // Every query reads the mapped sections in place; only the elements
+  // returned to the caller are constructed.
+  template <typename E>
+  class FrozenFroidurePin {
+   public:
+    using element_type = E;
+    using scalar_type  = typename FrozenElement<E>::scalar_type;
+
+    explicit FrozenFroidurePin(std::string const& path)
+        : _file(path, "FroidurePin") {
+      validate();
+      size_t const         n = size();
+      size_t const         g = number_of_generators();
+      unsigned char const* p = _file.data() + sizeof(FrozenFroidurePinHeader);
+      _width                 = FrozenElement<E>::width(degree());
+      _elements              = reinterpret_cast<scalar_type const*>(p);
+      p += frozen_section_bytes<scalar_type>(n * _width);
+
+      auto take = [&p](size_t count) {
+        auto section = reinterpret_cast<uint32_t const*>(p);
+        p += frozen_section_bytes<uint32_t>(count);
+        return section;
+      };
+      _generators  = take(g);
+      _right       = take(n * g);
+      _left        = has_left_cayley_graph() ? take(n * g) : nullptr;
+      _prefix      = take(n);
+      _suffix      = take(n);
+      _first       = take(n);
+      _final       = take(n);
+      _length      = take(n);
+      _sorted      = take(n);
+      _to_sorted   = take(n);
+      _idempotents = take(number_of_idempotents());
+    }
+
+    FrozenFroidurePin(FrozenFroidurePin const&)            = delete;
+    FrozenFroidurePin& operator=(FrozenFroidurePin const&) = delete;
+
+    std::string const& path() const noexcept {
+      return _file.path();
+    }
+
+    size_t size() const noexcept {
+      return header().size;
+    }
+
+    size_t degree() const noexcept {
+      return header().degree;
+    }
+
+    size_t number_of_generators() const noexcept {
+      return header().number_of_generators;
+    }
+
+    size_t number_of_idempotents() const noexcept {
+      return header().number_of_idempotents;
+    }
+
+    // false for a file written in compact mode
+    bool has_left_cayley_graph() const noexcept {
+      return header().compact == 0;
+    }
+
+    //////////////////////////////////////////////////////////////////////
+    // Elements
+    //////////////////////////////////////////////////////////////////////
+
+    E at(size_t i) const {
+      throw_if_bad_index(i);
+      return element(i);
+    }
+
+    E generator(size_t a) const {
+      throw_if_bad_letter(a);
+      return element(_generators[a]);
+    }
+
+    E sorted_at(size_t i) const {
+      throw_if_bad_index(i);
+      return element(_sorted[i]);
+    }
+
+    std::vector<E> idempotents() const {
+      std::vector<E> result;
+      result.reserve(number_of_idempotents());
+      for (size_t k = 0; k < number_of_idempotents(); ++k) {
+        result.push_back(element(_idempotents[k]));
+      }
+      return result;
+    }
+
+    //////////////////////////////////////////////////////////////////////
+    // Positions
+    //////////////////////////////////////////////////////////////////////
+
+    // Binary search in the sorted order, O(log(size) * width).
+    uint32_t position(E const& x) const {
+      uint32_t const i = sorted_position(x);
+      return i == undefined() ? i : _sorted[i];
+    }
+
+    uint32_t sorted_position(E const& x) const {
+      if (!FrozenElement<E>::has_degree(x, degree())) {
+        return undefined();
+      }
+      std::vector<scalar_type> key(_width);
+      FrozenElement<E>::write(x, key.data());
+      auto const* first = _sorted;
+      auto const* last  = _sorted + size();
+      auto const* it    = std::lower_bound(
+          first, last, key, [this](uint32_t i, auto const& k) {
+            scalar_type const* y = data(i);
+            return std::lexicographical_compare(
+                y, y + _width, k.cbegin(), k.cend());
+          });
+      if (it == last || !std::equal(key.cbegin(), key.cend(), data(*it))) {
+        return undefined();
+      }
+      return it - first;
+    }
+
+    uint32_t to_sorted_position(size_t i) const {
+      throw_if_bad_index(i);
+      return _to_sorted[i];
+    }
+
+    uint32_t position(libsemigroups::word_type const& w) const {
+      if (w.empty()) {
+        return undefined();
+      }
+      for (auto a : w) {
+        throw_if_bad_letter(a);
+      }
+      uint32_t i = _generators[w[0]];
+      for (auto it = w.cbegin() + 1; it != w.cend(); ++it) {
+        i = _right[i * number_of_generators() + *it];
+      }
+      return i;
+    }
+
+    //////////////////////////////////////////////////////////////////////
+    // Products and factorisations
+    //////////////////////////////////////////////////////////////////////
+
+    // The same reduction as froidure_pin::product_by_reduction, walking the
+    // shorter of the two factorisations through the Cayley graph on the
+    // other side, or always through the right Cayley graph in a compact
+    // file.
+    uint32_t fast_product(size_t i, size_t j) const {
+      throw_if_bad_index(i);
+      throw_if_bad_index(j);
+      size_t const g = number_of_generators();
+      if (_left != nullptr && _length[i] <= _length[j]) {
+        while (i != undefined()) {
+          j = _left[j * g + _final[i]];
+          i = _prefix[i];
+        }
+        return j;
+      }
+      while (j != undefined()) {
+        i = _right[i * g + _first[j]];
+        j = _suffix[j];
+      }
+      return i;
+    }
+
+    libsemigroups::word_type minimal_factorisation(size_t i) const {
+      throw_if_bad_index(i);
+      libsemigroups::word_type w;
+      w.reserve(_length[i]);
+      while (i != undefined()) {
+        w.push_back(_first[i]);
+        i = _suffix[i];
+      }
+      return w;
+    }
+
+    uint32_t prefix(size_t i) const {
+      throw_if_bad_index(i);
+      return _prefix[i];
+    }
+
+    uint32_t suffix(size_t i) const {
+      throw_if_bad_index(i);
+      return _suffix[i];
+    }
+
+    uint32_t first_letter(size_t i) const {
+      throw_if_bad_index(i);
+      return _first[i];
+    }
+
+    uint32_t final_letter(size_t i) const {
+      throw_if_bad_index(i);
+      return _final[i];
+    }
+
+    uint32_t length(size_t i) const {
+      throw_if_bad_index(i);
+      return _length[i];
+    }
+
+    uint32_t position_of_generator(size_t a) const {
+      throw_if_bad_letter(a);
+      return _generators[a];
+    }
+
+    bool is_idempotent(size_t i) const {
+      throw_if_bad_index(i);
+      return std::binary_search(
+          _idempotents, _idempotents + number_of_idempotents(), i);
+    }
+
+   private:
+    static constexpr uint32_t undefined() noexcept {
+      return static_cast<uint32_t>(libsemigroups::UNDEFINED);
+    }
+
+    FrozenFroidurePinHeader const& header() const noexcept {
+      return *reinterpret_cast<FrozenFroidurePinHeader const*>(_file.data());
+    }
+
+    scalar_type const* data(size_t i) const noexcept {
+      return _elements + i * _width;
+    }
+
+    E element(size_t i) const {
+      return FrozenElement<E>::read(data(i), degree());
+    }
+
+    void throw_if_bad_index(size_t i) const {
+      if (i >= size()) {
+        throw _file.error("element index out of range, expected value in [0, "
+                          + std::to_string(size()) + "), found "
+                          + std::to_string(i));
+      }
+    }
+
+    void throw_if_bad_letter(size_t a) const {
+      if (a >= number_of_generators()) {
+        throw _file.error("generator index out of range, expected value in "
+                          "[0, "
+                          + std::to_string(number_of_generators())
+                          + "), found " + std::to_string(a));
+      }
+    }
+
+    void validate() const {
+      if (_file.size() < sizeof(FrozenFroidurePinHeader)
+          || std::memcmp(header().magic, frozen_froidure_pin_magic, 8) != 0) {
+        throw _file.error("not a FroidurePin file");
+      }
+      auto const& h = header();
+      if (h.version != frozen_froidure_pin_version) {
+        throw _file.error("unsupported version " + std::to_string(h.version)
+                          + ", expected "
+                          + std::to_string(frozen_froidure_pin_version));
+      }
+      if (h.element_code != FrozenElement<E>::code) {
+        throw _file.error("contains elements of a different type");
+      }
+      // Guard every multiplication below against absurd counts before
+      // computing the expected size.
+      uint64_t const limit = _file.size() / sizeof(uint32_t);
+      uint64_t const width = FrozenElement<E>::width(h.degree);
+      if (h.size == 0 || h.size > limit || h.number_of_generators == 0
+          || h.number_of_generators > limit || width > limit
+          || h.size > limit / h.number_of_generators
+          || (width != 0 && h.size > limit / width)
+          || h.number_of_idempotents > h.size || h.compact > 1) {
+        throw _file.error("corrupt header");
+      }
+      uint64_t const expected = file_size(has_left_cayley_graph());
+      if (expected != _file.size()) {
+        throw _file.error("truncated or corrupt, expected "
+                          + std::to_string(expected) + " bytes"
+                          + (h.compact ? " in compact mode" : "")
+                          + ", found " + std::to_string(_file.size())
+                          + " bytes");
+      }
+    }
+
+    // The size of a file with this header, with or without the left Cayley
+    // graph.
+    uint64_t file_size(bool with_left_cayley_graph) const noexcept {
+      auto const&    h = header();
+      uint64_t const n = h.size, g = h.number_of_generators;
+      return sizeof(FrozenFroidurePinHeader)
+             + frozen_section_bytes<scalar_type>(
+                 n * FrozenElement<E>::width(h.degree))
+             + frozen_section_bytes<uint32_t>(g)
+             + (with_left_cayley_graph ? 2 : 1)
+                   * frozen_section_bytes<uint32_t>(n * g)
+             + 7 * frozen_section_bytes<uint32_t>(n)
+             + frozen_section_bytes<uint32_t>(h.number_of_idempotents);
+    }
+
+    MappedFile         _file;
+    size_t             _width;
+    scalar_type const* _elements;
+    uint32_t const*    _generators;
+    uint32_t const*    _right;
+    uint32_t const*    _left;
+    uint32_t const*    _prefix;
+    uint32_t const*    _suffix;
+    uint32_t const*    _first;
+    uint32_t const*    _final;
+    uint32_t const*    _length;
+    uint32_t const*    _sorted;
+    uint32_t const*    _to_sorted;
+    uint32_t const*    _idempotents;
+  };
+
+  // The element_code in the header of the file `path`, which identifies the
+  // FrozenFroidurePin<E> that can open it.
+  inline uint32_t frozen_froidure_pin_element_code(std::string const& path) {
+    MappedFile file(path, "FroidurePin");
+    if (file.size() < sizeof(FrozenFroidurePinHeader)
+        || std::memcmp(file.data(), frozen_froidure_pin_magic, 8) != 0) {
+      throw file.error("not a FroidurePin file");
+    }
+    return reinterpret_cast<FrozenFroidurePinHeader const*>(file.data())
+        ->element_code;
+  }
+
+}  // namespace libsemigroups_julia
+
+#endif  // LIBSEMIGROUPS_JULIA_FROZEN_FROIDURE_PIN_HPP_
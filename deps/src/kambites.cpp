@@ -43,13 +43,25 @@
 #include <cstdint>
 #include <string>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
+namespace libsemigroups_julia {
+  // The resumable range of normal forms of a Kambites
+  using KambitesNormalForms
+      = decltype(libsemigroups::congruence_common::normal_forms(
+          std::declval<libsemigroups::Kambites<libsemigroups::word_type>&>()));
+}  // namespace libsemigroups_julia
+
 namespace jlcxx {
   template <>
   struct IsMirroredType<libsemigroups::Kambites<libsemigroups::word_type>>
       : std::false_type {};
 
+  template <>
+  struct IsMirroredType<libsemigroups_julia::KambitesNormalForms>
+      : std::false_type {};
+
   template <>
   struct SuperType<libsemigroups::Kambites<libsemigroups::word_type>> {
     using type = libsemigroups::detail::CongruenceCommon;
@@ -58,6 +70,15 @@ namespace jlcxx {
 
 namespace libsemigroups_julia {
 
+  // A finished Kambites answers a query using scratch words of its own,
+  // but its suffix tree and small overlap data are only read, so a batch is
+  // split across threads by giving each block a copy. The copies are kept
+  // in a QueryCopies between batches, so the memory they use is bounded by
+  // the largest number of threads asked for, not the number of batches.
+  template <>
+  constexpr bool parallel_queries_by_copy_v<
+      libsemigroups::Kambites<libsemigroups::word_type>> = true;
+
   void define_kambites(jl::Module& m) {
     using libsemigroups::congruence_kind;
     using libsemigroups::Presentation;
@@ -153,7 +174,7 @@ namespace libsemigroups_julia {
     // than CxxWrap's opaque method-not-found error). The user-facing
     // `normal_forms(::Kambites)` override in `src/kambites.jl` already
     // throws ArgumentError for direct calls; this guards the indirect path.
-    m.method("cong_common_normal_forms", [](K&) -> std::vector<word_type> {
+    m.method("cong_common_normal_forms", [](K&) -> PackedWords {
       throw libsemigroups::LibsemigroupsException(
           __FILE__,
           __LINE__,
@@ -167,9 +188,9 @@ namespace libsemigroups_julia {
     // normal_forms template but caps iteration at n elements so callers can
     // safely take a finite prefix of the infinite normal-form range.
     m.method("kambites_normal_forms_take",
-             [](K& self, size_t n) -> std::vector<word_type> {
-               std::vector<word_type> result;
-               result.reserve(n);
+             [](K& self, size_t n) -> PackedWords {
+               PackedWords result;
+               result.offsets.reserve(n + 1);
                auto range
                    = libsemigroups::congruence_common::normal_forms(self);
                for (size_t i = 0; i < n && !range.at_end(); ++i) {
@@ -178,6 +199,34 @@ namespace libsemigroups_julia {
                }
                return result;
              });
+
+    // Resumable normal forms. A KambitesNormalForms refers to the Kambites
+    // it was made from, which must outlive it and not be modified, and
+    // holds its place in the range, so the next page of normal forms costs
+    // only that page.
+    auto range = m.add_type<KambitesNormalForms>("KambitesNormalFormsCxx");
+
+    m.method("kambites_normal_forms", [](K& self) -> KambitesNormalForms {
+      return libsemigroups::congruence_common::normal_forms(self);
+    });
+
+    range.method("get", [](KambitesNormalForms const& self) -> word_type {
+      return self.get();
+    });
+    range.method("next!", [](KambitesNormalForms& self) { self.next(); });
+    range.method("at_end", [](KambitesNormalForms const& self) -> bool {
+      return self.at_end();
+    });
+    range.method("take!",
+                 [](KambitesNormalForms& self, size_t n) -> PackedWords {
+                   return take_words(self, n);
+                 });
+    range.method("fill!",
+                 [](KambitesNormalForms&         self,
+                    jlcxx::ArrayRef<std::size_t> letters,
+                    jlcxx::ArrayRef<uint64_t>    offsets) -> std::size_t {
+                   return fill_words(self, letters, offsets);
+                 });
   }
 
 }  // namespace libsemigroups_julia
@@ -27,7 +27,9 @@
 #include <libsemigroups/presentation.hpp>
 #include <libsemigroups/word-graph.hpp>
 
+#include "compiled-reducer.hpp"
 #include "cong-common.hpp"
+#include "packed-words.hpp"
 
 #include <chrono>
 #include <cstddef>
@@ -40,217 +42,398 @@
 
 namespace jlcxx {
   template <>
+  struct IsMirroredType<libsemigroups_julia::CompiledReducer>
+      : std::false_type {};
+
+  template <typename Rewriter>
   struct IsMirroredType<
-      libsemigroups::detail::KnuthBendixImpl<libsemigroups::detail::RewriteTrie,
+      libsemigroups::detail::KnuthBendixImpl<Rewriter,
                                              libsemigroups::ShortLexCompare>>
       : std::false_type {};
 
-  template <>
+  template <typename Rewriter>
   struct IsMirroredType<
       libsemigroups::KnuthBendix<libsemigroups::word_type,
-                                 libsemigroups::detail::RewriteTrie,
+                                 Rewriter,
                                  libsemigroups::ShortLexCompare>>
       : std::false_type {};
 
-  template <>
+  template <typename Rewriter>
   struct SuperType<
-      libsemigroups::detail::KnuthBendixImpl<libsemigroups::detail::RewriteTrie,
+      libsemigroups::detail::KnuthBendixImpl<Rewriter,
                                              libsemigroups::ShortLexCompare>> {
     using type = libsemigroups::detail::CongruenceCommon;
   };
 
-  template <>
-  struct SuperType<
-      libsemigroups::KnuthBendix<libsemigroups::word_type,
-                                 libsemigroups::detail::RewriteTrie,
-                                 libsemigroups::ShortLexCompare>> {
-    using type = libsemigroups::detail::KnuthBendixImpl<
-        libsemigroups::detail::RewriteTrie,
-        libsemigroups::ShortLexCompare>;
+  template <typename Rewriter>
+  struct SuperType<libsemigroups::KnuthBendix<libsemigroups::word_type,
+                                              Rewriter,
+                                              libsemigroups::ShortLexCompare>> {
+    using type = libsemigroups::detail::
+        KnuthBendixImpl<Rewriter, libsemigroups::ShortLexCompare>;
   };
 }  // namespace jlcxx
 
 namespace libsemigroups_julia {
 
-  void define_knuth_bendix(jl::Module& m) {
-    using libsemigroups::congruence_kind;
-    using libsemigroups::Presentation;
-    using libsemigroups::word_type;
-
-    using CongruenceCommon = libsemigroups::detail::CongruenceCommon;
-    using KBImpl           = libsemigroups::detail::KnuthBendixImpl<
-        libsemigroups::detail::RewriteTrie,
-        libsemigroups::ShortLexCompare>;
-    using KB = libsemigroups::KnuthBendix<word_type,
-                                          libsemigroups::detail::RewriteTrie,
-                                          libsemigroups::ShortLexCompare>;
-
-    ////////////////////////////////////////////////////////////////////////
-    // overlap enum
-    ////////////////////////////////////////////////////////////////////////
-
-    m.add_bits<KB::options::overlap>("overlap", jl::julia_type("CppEnum"));
-    m.set_const("overlap_ABC", KB::options::overlap::ABC);
-    m.set_const("overlap_AB_BC", KB::options::overlap::AB_BC);
-    m.set_const("overlap_MAX_AB_BC", KB::options::overlap::MAX_AB_BC);
-
-    ////////////////////////////////////////////////////////////////////////
-    // Type registration
-    ////////////////////////////////////////////////////////////////////////
-
-    m.add_type<KBImpl>("KnuthBendixImplRewriteTrie",
-                       jlcxx::julia_base_type<CongruenceCommon>());
-    auto type = m.add_type<KB>("KnuthBendixRewriteTrie",
-                               jlcxx::julia_base_type<KBImpl>());
-
-    ////////////////////////////////////////////////////////////////////////
-    // Constructors
-    ////////////////////////////////////////////////////////////////////////
-
-    type.constructor<congruence_kind, Presentation<word_type> const&>();
-    type.constructor<KB const&>();  // copy ctor
-    type.method("init!", [](KB& self) -> KB& { return self.init(); });
-    type.method("init!",
-                [](KB&                            self,
-                   congruence_kind                knd,
-                   Presentation<word_type> const& p) -> KB& {
-                  return self.init(knd, p);
-                });
-
-    ////////////////////////////////////////////////////////////////////////
-    // Settings (getter / setter with DISTINCT names)
-    ////////////////////////////////////////////////////////////////////////
-
-    // max_pending_rules
-    type.method("max_pending_rules", [](KB const& self) -> size_t {
-      return self.max_pending_rules();
-    });
-    type.method("set_max_pending_rules!",
-                [](KB& self, size_t val) { self.max_pending_rules(val); });
-
-    // check_confluence_interval
-    type.method("check_confluence_interval", [](KB const& self) -> size_t {
-      return self.check_confluence_interval();
-    });
-    type.method("set_check_confluence_interval!", [](KB& self, size_t val) {
-      self.check_confluence_interval(val);
-    });
-
-    // max_overlap
-    type.method("max_overlap",
-                [](KB const& self) -> size_t { return self.max_overlap(); });
-    type.method("set_max_overlap!",
-                [](KB& self, size_t val) { self.max_overlap(val); });
-
-    // max_rules
-    type.method("max_rules",
-                [](KB const& self) -> size_t { return self.max_rules(); });
-    type.method("set_max_rules!",
-                [](KB& self, size_t val) { self.max_rules(val); });
-
-    // overlap_policy
-    type.method("overlap_policy", [](KB const& self) -> KB::options::overlap {
-      return self.overlap_policy();
-    });
-    type.method("set_overlap_policy!", [](KB& self, KB::options::overlap val) {
-      self.overlap_policy(val);
-    });
-
-    ////////////////////////////////////////////////////////////////////////
-    // Query methods
-    ////////////////////////////////////////////////////////////////////////
+  // A KnuthBendix answers reduce_no_run and currently_contains using
+  // scratch words that are members of KnuthBendixImpl, so, like a Kambites,
+  // a batch is split across threads by giving each block its own copy,
+  // kept between batches in a QueryCopies.
+  template <typename Rewriter>
+  constexpr bool parallel_queries_by_copy_v<
+      libsemigroups::KnuthBendix<libsemigroups::word_type,
+                                 Rewriter,
+                                 libsemigroups::ShortLexCompare>> = true;
 
-    type.method("number_of_active_rules", [](KB const& self) -> size_t {
-      return self.number_of_active_rules();
-    });
-    type.method("number_of_inactive_rules", [](KB const& self) -> size_t {
-      return self.number_of_inactive_rules();
-    });
-    type.method("number_of_pending_rules", [](KB const& self) -> size_t {
-      return self.number_of_pending_rules();
-    });
-    type.method("total_rules",
-                [](KB const& self) -> size_t { return self.total_rules(); });
-
-    type.method("confluent", [](KB& self) -> bool { return self.confluent(); });
-    type.method("confluent_known",
-                [](KB const& self) -> bool { return self.confluent_known(); });
-
-    type.method("number_of_classes",
-                [](KB& self) -> uint64_t { return self.number_of_classes(); });
-
-    type.method("kind",
-                [](KB const& self) -> congruence_kind { return self.kind(); });
-    type.method("number_of_generating_pairs", [](KB const& self) -> size_t {
-      return self.number_of_generating_pairs();
-    });
-    type.method("generating_pairs",
-                [](KB const& self) -> std::vector<word_type> {
-                  auto const& pairs = self.generating_pairs();
-                  return std::vector<word_type>(pairs.begin(), pairs.end());
-                });
-
-    // presentation — return by copy
-    type.method("presentation", [](KB const& self) -> Presentation<word_type> {
-      return self.presentation();
-    });
+  namespace {
 
-    ////////////////////////////////////////////////////////////////////////
-    // Rules access
-    ////////////////////////////////////////////////////////////////////////
-
-    // active_rules — collect the range to a flat vector<word_type>
-    // (even indices = lhs, odd indices = rhs)
-    // active_rules() returns an rx range — use .at_end()/.get()/.next()
-    m.method("kb_active_rules", [](KB& self) -> std::vector<word_type> {
-      std::vector<word_type> result;
-      auto                   range = self.active_rules();
-      while (!range.at_end()) {
-        auto const& pair = range.get();
-        result.push_back(pair.first);
-        result.push_back(pair.second);
-        range.next();
-      }
-      return result;
-    });
+    using OverlapTrie = libsemigroups::detail::KnuthBendixImpl<
+        libsemigroups::detail::RewriteTrie,
+        libsemigroups::ShortLexCompare>::options::overlap;
+
+    // Binds KnuthBendix<word_type, Rewriter, ShortLexCompare> as
+    // "KnuthBendix" + name, and its base as "KnuthBendixImpl" + name. The
+    // overlap policy is always passed as the enum of the RewriteTrie
+    // instantiation, which is the one registered with Julia.
+    //
+    // libsemigroups' rewriters orient every rule by shortlex, so
+    // ShortLexCompare is the only reduction order instantiated.
+    template <typename Rewriter>
+    void bind_knuth_bendix(jl::Module& m, std::string const& name) {
+      using libsemigroups::congruence_kind;
+      using libsemigroups::Presentation;
+      using libsemigroups::word_type;
+
+      using CongruenceCommon = libsemigroups::detail::CongruenceCommon;
+      using KBImpl = libsemigroups::detail::
+          KnuthBendixImpl<Rewriter, libsemigroups::ShortLexCompare>;
+      using KB = libsemigroups::
+          KnuthBendix<word_type, Rewriter, libsemigroups::ShortLexCompare>;
+      using Overlap = typename KB::options::overlap;
+
+      ////////////////////////////////////////////////////////////////////////
+      // Type registration
+      ////////////////////////////////////////////////////////////////////////
+
+      m.add_type<KBImpl>("KnuthBendixImpl" + name,
+                         jlcxx::julia_base_type<CongruenceCommon>());
+      auto type = m.add_type<KB>("KnuthBendix" + name,
+                                 jlcxx::julia_base_type<KBImpl>());
+
+      ////////////////////////////////////////////////////////////////////////
+      // Constructors
+      ////////////////////////////////////////////////////////////////////////
+
+      type.constructor<congruence_kind, Presentation<word_type> const&>();
+      type.constructor<KB const&>();  // copy ctor
+      type.method("init!", [](KB& self) -> KB& { return self.init(); });
+      type.method("init!",
+                  [](KB&                            self,
+                     congruence_kind                knd,
+                     Presentation<word_type> const& p) -> KB& {
+                    return self.init(knd, p);
+                  });
+
+      ////////////////////////////////////////////////////////////////////////
+      // Settings (getter / setter with DISTINCT names)
+      ////////////////////////////////////////////////////////////////////////
+
+      // max_pending_rules
+      type.method("max_pending_rules", [](KB const& self) -> size_t {
+        return self.max_pending_rules();
+      });
+      type.method("set_max_pending_rules!",
+                  [](KB& self, size_t val) { self.max_pending_rules(val); });
+
+      // check_confluence_interval
+      type.method("check_confluence_interval", [](KB const& self) -> size_t {
+        return self.check_confluence_interval();
+      });
+      type.method("set_check_confluence_interval!", [](KB& self, size_t val) {
+        self.check_confluence_interval(val);
+      });
+
+      // max_overlap
+      type.method("max_overlap",
+                  [](KB const& self) -> size_t { return self.max_overlap(); });
+      type.method("set_max_overlap!",
+                  [](KB& self, size_t val) { self.max_overlap(val); });
+
+      // max_rules
+      type.method("max_rules",
+                  [](KB const& self) -> size_t { return self.max_rules(); });
+      type.method("set_max_rules!",
+                  [](KB& self, size_t val) { self.max_rules(val); });
+
+      // overlap_policy
+      type.method("overlap_policy", [](KB const& self) -> OverlapTrie {
+        return static_cast<OverlapTrie>(self.overlap_policy());
+      });
+      type.method("set_overlap_policy!", [](KB& self, OverlapTrie val) {
+        self.overlap_policy(static_cast<Overlap>(val));
+      });
+
+      ////////////////////////////////////////////////////////////////////////
+      // Query methods
+      ////////////////////////////////////////////////////////////////////////
+
+      type.method("number_of_active_rules", [](KB const& self) -> size_t {
+        return self.number_of_active_rules();
+      });
+      type.method("number_of_inactive_rules", [](KB const& self) -> size_t {
+        return self.number_of_inactive_rules();
+      });
+      type.method("number_of_pending_rules", [](KB const& self) -> size_t {
+        return self.number_of_pending_rules();
+      });
+      type.method("total_rules",
+                  [](KB const& self) -> size_t { return self.total_rules(); });
+
+      type.method("confluent",
+                  [](KB& self) -> bool { return self.confluent(); });
+      type.method("confluent_known",
+                  [](KB const& self) -> bool {
+                    return self.confluent_known();
+                  });
+
+      type.method("number_of_classes",
+                  [](KB& self) -> uint64_t {
+                    return self.number_of_classes();
+                  });
+
+      type.method("kind",
+                  [](KB const& self) -> congruence_kind {
+                    return self.kind();
+                  });
+      type.method("number_of_generating_pairs", [](KB const& self) -> size_t {
+        return self.number_of_generating_pairs();
+      });
+      type.method("generating_pairs",
+                  [](KB const& self) -> std::vector<word_type> {
+                    auto const& pairs = self.generating_pairs();
+                    return std::vector<word_type>(pairs.begin(), pairs.end());
+                  });
+
+      // presentation — return by copy
+      type.method("presentation",
+                  [](KB const& self) -> Presentation<word_type> {
+                    return self.presentation();
+                  });
+
+      ////////////////////////////////////////////////////////////////////////
+      // Rules access
+      ////////////////////////////////////////////////////////////////////////
+
+      // active_rules — pack the range into PackedWords, interleaved
+      // (even indices = lhs, odd indices = rhs)
+      // active_rules() returns an rx range — use .at_end()/.get()/.next()
+      m.method("kb_active_rules", [](KB& self) -> PackedWords {
+        PackedWords result;
+        auto        range = self.active_rules();
+        while (!range.at_end()) {
+          result.push_back(range.get());
+          range.next();
+        }
+        return result;
+      });
+
+      ////////////////////////////////////////////////////////////////////////
+      // Graph access
+      ////////////////////////////////////////////////////////////////////////
+
+      // gilman_graph — return by const reference (large stable data)
+      type.method("gilman_graph",
+                  [](KB& self) -> libsemigroups::WordGraph<uint32_t> const& {
+                    return self.gilman_graph();
+                  });
+
+      // gilman_graph_node_labels — packed copy
+      type.method("gilman_graph_node_labels", [](KB& self) -> PackedWords {
+        return PackedWords::from(self.gilman_graph_node_labels());
+      });
+
+      ////////////////////////////////////////////////////////////////////////
+      // Display
+      ////////////////////////////////////////////////////////////////////////
+
+      type.method("to_human_readable_repr", [](KB& self) -> std::string {
+        return libsemigroups::to_human_readable_repr(self);
+      });
+
+      ////////////////////////////////////////////////////////////////////////
+      // Rebuilding with more rules
+      ////////////////////////////////////////////////////////////////////////
+
+      // kb_rebuild_with_rules!(KB&, letters, offsets). The new rules are
+      // packed words, interleaved (lhs, rhs, ...). libsemigroups cannot add
+      // rules to a KnuthBendix that has started, so `self` is replaced by a
+      // KnuthBendix, with the same settings, presentation and generating
+      // pairs, whose presentation also contains the new rules, and this is
+      // run to completion from scratch. Nothing is kept from any previous
+      // run of `self`; the Julia side compares the active rules before and
+      // after.
+      m.method("kb_rebuild_with_rules!",
+               [](KB&                       self,
+                  jlcxx::ArrayRef<size_t>   letters,
+                  jlcxx::ArrayRef<uint64_t> offsets) {
+                 PackedWordsView words(letters, offsets);
+                 if (words.size() % 2 != 0) {
+                   throw libsemigroups::LibsemigroupsException(
+                       __FILE__,
+                       __LINE__,
+                       __func__,
+                       "expected an even number of words, found "
+                           + std::to_string(words.size()));
+                 }
+                 if (self.kind() != congruence_kind::twosided) {
+                   throw libsemigroups::LibsemigroupsException(
+                       __FILE__,
+                       __LINE__,
+                       __func__,
+                       "rules can only be added to a 2-sided congruence");
+                 }
+                 Presentation<word_type> p(self.presentation());
+                 word_type               w;
+                 for (size_t i = 0; i < words.size(); ++i) {
+                   words.get(i, w);
+                   p.rules.push_back(w);
+                 }
+                 p.throw_if_bad_alphabet_or_rules();
+
+                 KB          kb(congruence_kind::twosided, p);
+                 auto const& pairs = self.generating_pairs();
+                 for (size_t i = 0; i + 1 < pairs.size(); i += 2) {
+                   libsemigroups::congruence_common::add_generating_pair(
+                       kb, pairs[i], pairs[i + 1]);
+                 }
+                 kb.max_pending_rules(self.max_pending_rules());
+                 kb.check_confluence_interval(self.check_confluence_interval());
+                 kb.max_overlap(self.max_overlap());
+                 kb.max_rules(self.max_rules());
+                 kb.overlap_policy(self.overlap_policy());
+                 kb.run();
+                 self = std::move(kb);
+               });
+
+      ////////////////////////////////////////////////////////////////////////
+      // Free functions (knuth_bendix:: namespace)
+      ////////////////////////////////////////////////////////////////////////
+
+      // by_overlap_length! (mutating)
+      m.method("kb_by_overlap_length!", [](KB& self) {
+        libsemigroups::knuth_bendix::by_overlap_length(self);
+      });
+
+      // is_reduced
+      m.method("kb_is_reduced", [](KB& self) -> bool {
+        return libsemigroups::knuth_bendix::is_reduced(self);
+      });
+
+      // kb_compiled_reducer — run `self` to completion and compile its
+      // active rules. A KnuthBendix that stops without becoming confluent
+      // (because of max_overlap or max_rules) has no normal forms to
+      // compile, and neither does a 1-sided one, whose active rules are not
+      // over the alphabet of its presentation.
+      m.method("kb_compiled_reducer", [](KB& self) -> CompiledReducer {
+        if (self.kind() != congruence_kind::twosided) {
+          throw libsemigroups::LibsemigroupsException(
+              __FILE__,
+              __LINE__,
+              __func__,
+              "only a 2-sided congruence can be compiled");
+        }
+        self.run();
+        if (!self.confluent()) {
+          throw libsemigroups::LibsemigroupsException(
+              __FILE__,
+              __LINE__,
+              __func__,
+              "the rewriting system is not confluent, it cannot be compiled");
+        }
+        std::vector<std::pair<word_type, word_type>> rules;
+        for (auto r = self.active_rules(); !r.at_end(); r.next()) {
+          rules.push_back(r.get());
+        }
+        return CompiledReducer(self.presentation().alphabet(), rules);
+      });
+
+      define_cong_common_helpers<KB>(m);
+    }
 
     ////////////////////////////////////////////////////////////////////////
-    // Graph access
+    // CompiledReducer — see compiled-reducer.hpp. Constructed only by
+    // kb_compiled_reducer.
     ////////////////////////////////////////////////////////////////////////
 
-    // gilman_graph — return by const reference (large stable data)
-    type.method("gilman_graph",
-                [](KB& self) -> libsemigroups::WordGraph<uint32_t> const& {
-                  return self.gilman_graph();
-                });
-
-    // gilman_graph_node_labels — collect to vector of vectors by copy
-    type.method("gilman_graph_node_labels",
-                [](KB& self) -> std::vector<word_type> {
-                  return self.gilman_graph_node_labels();
-                });
-
-    ////////////////////////////////////////////////////////////////////////
-    // Display
-    ////////////////////////////////////////////////////////////////////////
+    void bind_compiled_reducer(jl::Module& m) {
+      using libsemigroups::word_type;
+
+      auto type = m.add_type<CompiledReducer>("CompiledReducer");
+
+      type.method("number_of_letters", &CompiledReducer::number_of_letters);
+      type.method("number_of_rules", &CompiledReducer::number_of_rules);
+      type.method("number_of_states", &CompiledReducer::number_of_states);
+      type.method("memory_usage", &CompiledReducer::memory_usage);
+
+      type.method("reduce",
+                  [](CompiledReducer const&  self,
+                     jlcxx::ArrayRef<size_t> w) -> word_type {
+                    CompiledReducer::Workspace ws;
+                    self.reduce(w.begin(), w.end(), ws);
+                    return word_type(ws.out.cbegin(), ws.out.cend());
+                  });
+
+      // One Workspace per block, so that each word costs no allocation once
+      // the scratch buffers have grown to the longest word of the block.
+      type.method("reduce_batch",
+                  [](CompiledReducer const&    self,
+                     jlcxx::ArrayRef<size_t>   letters,
+                     jlcxx::ArrayRef<uint64_t> offsets,
+                     size_t                    nthreads) -> PackedWords {
+                    PackedWordsView          words(letters, offsets);
+                    std::size_t const        n = words.size();
+                    std::vector<PackedWords> parts(
+                        std::max<std::size_t>(1, std::min(nthreads, n)));
+                    for_each_block(
+                        n,
+                        parts.size(),
+                        [&](size_t b, size_t first, size_t last) {
+                          CompiledReducer::Workspace ws;
+                          PackedWords&               part = parts[b];
+                          for (size_t i = first; i < last; ++i) {
+                            auto const* w = letters.data() + offsets[i];
+                            self.reduce(
+                                w, letters.data() + offsets[i + 1], ws);
+                            part.push_back(ws.out);
+                          }
+                        });
+                    for (size_t b = 1; b < parts.size(); ++b) {
+                      parts[0].append(parts[b]);
+                    }
+                    return std::move(parts[0]);
+                  });
+    }
+
+  }  // namespace
 
-    type.method("to_human_readable_repr", [](KB& self) -> std::string {
-      return libsemigroups::to_human_readable_repr(self);
-    });
+  void define_knuth_bendix(jl::Module& m) {
+    using libsemigroups::Presentation;
+    using libsemigroups::word_type;
 
     ////////////////////////////////////////////////////////////////////////
-    // Free functions (knuth_bendix:: namespace)
+    // overlap enum
     ////////////////////////////////////////////////////////////////////////
 
-    // by_overlap_length! (mutating)
-    m.method("kb_by_overlap_length!", [](KB& self) {
-      libsemigroups::knuth_bendix::by_overlap_length(self);
-    });
+    m.add_bits<OverlapTrie>("overlap", jl::julia_type("CppEnum"));
+    m.set_const("overlap_ABC", OverlapTrie::ABC);
+    m.set_const("overlap_AB_BC", OverlapTrie::AB_BC);
+    m.set_const("overlap_MAX_AB_BC", OverlapTrie::MAX_AB_BC);
 
-    // is_reduced
-    m.method("kb_is_reduced", [](KB& self) -> bool {
-      return libsemigroups::knuth_bendix::is_reduced(self);
-    });
+    bind_compiled_reducer(m);
+    bind_knuth_bendix<libsemigroups::detail::RewriteTrie>(m, "RewriteTrie");
+    bind_knuth_bendix<libsemigroups::detail::RewriteFromLeft>(
+        m, "RewriteFromLeft");
 
     // redundant_rule — takes Presentation<word_type> and a timeout in
     // nanoseconds (int64_t), returns an index into p.rules (0-based).
@@ -261,8 +444,6 @@ namespace libsemigroups_julia {
                    p, std::chrono::nanoseconds(ns));
                return static_cast<size_t>(std::distance(p.rules.cbegin(), it));
              });
-
-    define_cong_common_helpers<KB>(m);
   }
 
 }  // namespace libsemigroups_julia
@@ -16,8 +16,10 @@
 // along with this program.  If not, see <http://www.gnu.org/licenses/>.
 //
 
-// This file defines the main Julia module that wraps libsemigroups
-// functionality.
+// This file defines the Julia modules that wrap libsemigroups
+// functionality: the main module, registered when Semigroups.jl is loaded,
+// and the FroidurePin module, registered on first use (see
+// src/LibSemigroups.jl).
 
 #include "libsemigroups_julia.hpp"
 
@@ -34,9 +36,15 @@ namespace libsemigroups_julia {
     // Define constants first (UNDEFINED, POSITIVE_INFINITY, etc.)
     define_constants(mod);
 
+    // Define the counters of profiled bindings (see binding-profile.hpp)
+    define_binding_profile(mod);
+
     // Define ReportGuard (RAII reporting control)
     define_report(mod);
 
+    // Define the packed word buffers shared by word-returning bindings
+    define_packed_words(mod);
+
     // Define base types (must be registered before derived types)
     define_runner(mod);
     define_cong_common(mod);
@@ -44,13 +52,15 @@ namespace libsemigroups_julia {
     // Define element types
     define_transf(mod);
     define_bmat8(mod);
+    define_batch_multiply(mod);
+    define_bmat8_batch(mod);
+    define_element_table(mod);
 
     define_order(mod);
     define_word_range(mod);
     define_word_graph(mod);
     define_paths(mod);
     define_froidure_pin_base(mod);
-    define_froidure_pin(mod);
     define_presentation(mod);
     define_presentation_examples(mod);
     define_knuth_bendix(mod);
@@ -58,6 +68,20 @@ namespace libsemigroups_julia {
     define_kambites(mod);
     define_congruence(mod);
     define_to_cong(mod);
+    define_to_froidure_pin(mod);
+    define_redundant_rules(mod);
+    define_batch_run(mod);
+    define_async_run(mod);
+    define_checkpoint(mod);
+  }
+
+  // The FroidurePin<E> and FrozenFroidurePin<E> instantiations for every
+  // element type, which are most of the types and methods bound. They use
+  // the element types, FroidurePinBase, WordGraph and PackedWords, so this is
+  // only ever registered after define_julia_module.
+  JLCXX_MODULE define_julia_module_froidure_pin(jl::Module& mod) {
+    define_froidure_pin(mod);
+    define_froidure_pin_static(mod);
   }
 
 }  // namespace libsemigroups_julia
@@ -55,17 +55,21 @@ namespace libsemigroups_julia {
 
   // Forward declarations of binding functions
   void define_constants(jl::Module& mod);
+  void define_binding_profile(jl::Module& mod);
   void define_report(jl::Module& mod);
+  void define_packed_words(jl::Module& mod);
   void define_runner(jl::Module& mod);
   void define_cong_common(jl::Module& mod);
   void define_transf(jl::Module& mod);
   void define_bmat8(jl::Module& mod);
+  void define_bmat8_batch(jl::Module& mod);
   void define_order(jl::Module& mod);
   void define_word_range(jl::Module& mod);
   void define_word_graph(jl::Module& mod);
   void define_paths(jl::Module& mod);
   void define_froidure_pin_base(jl::Module& mod);
   void define_froidure_pin(jl::Module& mod);
+  void define_froidure_pin_static(jl::Module& mod);
   void define_presentation(jl::Module& mod);
   void define_presentation_examples(jl::Module& mod);
   void define_knuth_bendix(jl::Module& mod);
@@ -73,6 +77,13 @@ namespace libsemigroups_julia {
   void define_kambites(jl::Module& mod);
   void define_congruence(jl::Module& mod);
   void define_to_cong(jl::Module& mod);
+  void define_to_froidure_pin(jl::Module& mod);
+  void define_batch_run(jl::Module& mod);
+  void define_async_run(jl::Module& mod);
+  void define_checkpoint(jl::Module& mod);
+  void define_batch_multiply(jl::Module& mod);
+  void define_element_table(jl::Module& mod);
+  void define_redundant_rules(jl::Module& mod);
 
 }  // namespace libsemigroups_julia
 
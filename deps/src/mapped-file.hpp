@@ -0,0 +1,199 @@
+//
+// Semigroups.jl
+// Copyright (C) 2026, James W. Swent
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+// Reading and writing the binary files of checkpoint.cpp and the frozen
+// FroidurePin format. Files are read by mapping them into memory, so that
+// their sections can be used in place, and written to path.tmp which is
+// renamed over path once complete, so that a process killed while writing
+// leaves the previous file intact.
+//
+// Errors are reported as "<what> <path>: <reason>", where `what` names the
+// kind of file, e.g. "checkpoint".
+
+#ifndef LIBSEMIGROUPS_JULIA_MAPPED_FILE_HPP_
+#define LIBSEMIGROUPS_JULIA_MAPPED_FILE_HPP_
+
+// CRITICAL: libsemigroups_julia.hpp MUST be included first (fmt consteval fix)
+#include "libsemigroups_julia.hpp"
+
+#include <libsemigroups/exception.hpp>
+
+#if defined(_WIN32)
+#include <fstream>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace libsemigroups_julia {
+
+  inline libsemigroups::LibsemigroupsException
+  file_error(std::string const& what,
+             std::string const& path,
+             std::string const& msg) {
+    return libsemigroups::LibsemigroupsException(
+        __FILE__, __LINE__, __func__, what + " " + path + ": " + msg);
+  }
+
+  // A read-only view of a whole file. On platforms without mmap the file is
+  // read into a buffer instead.
+  class MappedFile {
+   public:
+    MappedFile(std::string const& path, std::string const& what)
+        : _data(nullptr), _path(path), _size(0), _what(what) {
+#if defined(_WIN32)
+      std::ifstream in(path, std::ios::binary | std::ios::ate);
+      if (!in) {
+        throw error("cannot open for reading");
+      }
+      _buffer.resize(static_cast<size_t>(in.tellg()));
+      in.seekg(0);
+      in.read(reinterpret_cast<char*>(_buffer.data()), _buffer.size());
+      _data = _buffer.data();
+      _size = _buffer.size();
+#else
+      int fd = ::open(path.c_str(), O_RDONLY);
+      if (fd < 0) {
+        throw error("cannot open for reading");
+      }
+      struct stat st;
+      if (::fstat(fd, &st) != 0) {
+        ::close(fd);
+        throw error("cannot stat");
+      }
+      _size = static_cast<size_t>(st.st_size);
+      if (_size != 0) {
+        void* p = ::mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (p == MAP_FAILED) {
+          ::close(fd);
+          throw error("cannot map into memory");
+        }
+        _data = static_cast<unsigned char const*>(p);
+      }
+      ::close(fd);
+#endif
+    }
+
+    MappedFile(MappedFile const&)            = delete;
+    MappedFile& operator=(MappedFile const&) = delete;
+
+    ~MappedFile() {
+#if !defined(_WIN32)
+      if (_data != nullptr) {
+        ::munmap(const_cast<unsigned char*>(_data), _size);
+      }
+#endif
+    }
+
+    unsigned char const* data() const noexcept {
+      return _data;
+    }
+
+    size_t size() const noexcept {
+      return _size;
+    }
+
+    std::string const& path() const noexcept {
+      return _path;
+    }
+
+    libsemigroups::LibsemigroupsException
+    error(std::string const& msg) const {
+      return file_error(_what, _path, msg);
+    }
+
+   private:
+#if defined(_WIN32)
+    std::vector<unsigned char> _buffer;
+#endif
+    unsigned char const* _data;
+    std::string          _path;
+    size_t               _size;
+    std::string          _what;
+  };
+
+  // Writes path.tmp, and renames it over path in commit(). If commit() is
+  // never reached, e.g. because a write threw, path.tmp is removed.
+  class AtomicFileWriter {
+   public:
+    AtomicFileWriter(std::string const& path, std::string const& what)
+        : _file(nullptr),
+          _path(path),
+          _tmp(path + ".tmp"),
+          _what(what),
+          _written(0) {
+      _file = std::fopen(_tmp.c_str(), "wb");
+      if (_file == nullptr) {
+        throw file_error(_what, _path, "cannot open " + _tmp + " for writing");
+      }
+    }
+
+    AtomicFileWriter(AtomicFileWriter const&)            = delete;
+    AtomicFileWriter& operator=(AtomicFileWriter const&) = delete;
+
+    ~AtomicFileWriter() {
+      if (_file != nullptr) {
+        std::fclose(_file);
+        std::remove(_tmp.c_str());
+      }
+    }
+
+    template <typename T>
+    void write(T const* data, size_t n) {
+      if (n != 0 && std::fwrite(data, sizeof(T), n, _file) != n) {
+        throw file_error(_what, _path, "cannot write " + _tmp);
+      }
+      _written += n * sizeof(T);
+    }
+
+    // Pads with zero bytes up to the next multiple of 8, so that every
+    // section of a mapped file is aligned for any scalar type.
+    void align() {
+      static constexpr unsigned char zeros[8] = {};
+      write(zeros, (8 - _written % 8) % 8);
+    }
+
+    void commit() {
+      std::FILE* f = _file;
+      _file        = nullptr;
+      if (std::fclose(f) != 0
+          || std::rename(_tmp.c_str(), _path.c_str()) != 0) {
+        std::remove(_tmp.c_str());
+        throw file_error(_what, _path, "cannot write " + _tmp);
+      }
+    }
+
+   private:
+    std::FILE*  _file;
+    std::string _path;
+    std::string _tmp;
+    std::string _what;
+    size_t      _written;
+  };
+
+}  // namespace libsemigroups_julia
+
+#endif  // LIBSEMIGROUPS_JULIA_MAPPED_FILE_HPP_
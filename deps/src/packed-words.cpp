@@ -0,0 +1,67 @@
+//
+// Semigroups.jl
+// Copyright (C) 2026, James W. Swent
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+// CRITICAL: libsemigroups_julia.hpp MUST be included first (fmt consteval fix)
+#include "libsemigroups_julia.hpp"
+
+#include "packed-words.hpp"
+
+#include <jlcxx/array.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace libsemigroups_julia {
+
+  void define_packed_words(jl::Module& m) {
+    auto type = m.add_type<PackedWords>("PackedWords");
+
+    type.method("number_of_words", [](PackedWords const& self) -> std::size_t {
+      return self.number_of_words();
+    });
+
+    type.method("number_of_letters",
+                [](PackedWords const& self) -> std::size_t {
+                  return self.letters.size();
+                });
+
+    // letters / offsets borrow the buffers without copying. The Julia
+    // wrapper keeps the PackedWords alive for as long as the arrays are
+    // reachable, and only calls `letters` when there is at least one letter
+    // (an empty std::vector may have a null data pointer).
+    type.method("letters",
+                [](PackedWords& self) -> jlcxx::ArrayRef<std::size_t> {
+                  return jlcxx::make_julia_array(self.letters.data(),
+                                                 self.letters.size());
+                });
+
+    type.method("offsets", [](PackedWords& self) -> jlcxx::ArrayRef<uint64_t> {
+      return jlcxx::make_julia_array(self.offsets.data(), self.offsets.size());
+    });
+
+    type.method("number_of_groups",
+                [](PackedWords const& self) -> std::size_t {
+                  return self.number_of_groups();
+                });
+
+    type.method("groups", [](PackedWords& self) -> jlcxx::ArrayRef<uint64_t> {
+      return jlcxx::make_julia_array(self.groups.data(), self.groups.size());
+    });
+  }
+
+}  // namespace libsemigroups_julia
@@ -0,0 +1,256 @@
+//
+// Semigroups.jl
+// Copyright (C) 2026, James W. Swent
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+// A list of words stored in two flat buffers, used wherever many words
+// cross the C++/Julia boundary at once. Returning std::vector<word_type>
+// makes CxxWrap box every word as its own Julia array; a PackedWords is a
+// single Julia object whose buffers are read in place on the Julia side
+// (see `src/packed-words.jl`).
+
+#ifndef LIBSEMIGROUPS_JULIA_PACKED_WORDS_HPP_
+#define LIBSEMIGROUPS_JULIA_PACKED_WORDS_HPP_
+
+// CRITICAL: libsemigroups_julia.hpp MUST be included first (fmt consteval fix)
+#include "libsemigroups_julia.hpp"
+
+#include <libsemigroups/exception.hpp>
+
+#include <jlcxx/array.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace libsemigroups_julia {
+
+  // Word i occupies letters[offsets[i], offsets[i + 1]), so offsets always
+  // has one more entry than there are words and starts with 0. Letters are
+  // raw (0-based) like every other word at the binding boundary.
+  //
+  // Lists of lists of words (partitions, non-trivial classes) use the
+  // second level `groups` in the same way: group j is the words
+  // [groups[j], groups[j + 1]). For a flat list, groups is just {0}.
+  struct PackedWords {
+    std::vector<std::size_t> letters;
+    std::vector<uint64_t>    offsets = {0};
+    std::vector<uint64_t>    groups  = {0};
+
+    std::size_t number_of_words() const noexcept {
+      return offsets.size() - 1;
+    }
+
+    std::size_t number_of_groups() const noexcept {
+      return groups.size() - 1;
+    }
+
+    void clear() {
+      letters.clear();
+      offsets.assign(1, 0);
+      groups.assign(1, 0);
+    }
+
+    template <typename Word>
+    void push_back(Word const& w) {
+      letters.insert(letters.end(), w.cbegin(), w.cend());
+      offsets.push_back(letters.size());
+    }
+
+    // Append every word of `other`.
+    void append(PackedWords const& other) {
+      uint64_t const shift = letters.size();
+      letters.insert(letters.end(), other.letters.cbegin(), other.letters.cend());
+      for (auto it = other.offsets.cbegin() + 1; it != other.offsets.cend();
+           ++it) {
+        offsets.push_back(*it + shift);
+      }
+    }
+
+    // Rules are stored interleaved: lhs then rhs.
+    template <typename Word>
+    void push_back(std::pair<Word, Word> const& rule) {
+      push_back(rule.first);
+      push_back(rule.second);
+    }
+
+    template <typename Iterator>
+    static PackedWords from(Iterator first, Iterator last) {
+      PackedWords result;
+      for (; first != last; ++first) {
+        result.push_back(*first);
+      }
+      return result;
+    }
+
+    template <typename Words>
+    void push_group(Words const& words) {
+      for (auto const& w : words) {
+        push_back(w);
+      }
+      groups.push_back(number_of_words());
+    }
+
+    template <typename Words>
+    static PackedWords from(Words const& words) {
+      return from(words.cbegin(), words.cend());
+    }
+
+    template <typename Groups>
+    static PackedWords from_groups(Groups const& groups) {
+      PackedWords result;
+      for (auto const& group : groups) {
+        result.push_group(group);
+      }
+      return result;
+    }
+  };
+
+  // Read-only view of packed words passed in from Julia, with the same
+  // layout as PackedWords (letters plus offsets, no groups).
+  class PackedWordsView {
+   public:
+    PackedWordsView(jlcxx::ArrayRef<std::size_t> letters,
+                    jlcxx::ArrayRef<uint64_t>    offsets)
+        : _letters(letters.data()),
+          _offsets(offsets.data()),
+          _size(offsets.size() == 0 ? 0 : offsets.size() - 1) {
+      bool valid = offsets.size() != 0 && _offsets[0] == 0
+                   && _offsets[_size] == letters.size();
+      for (std::size_t i = 0; valid && i < _size; ++i) {
+        valid = _offsets[i] <= _offsets[i + 1];
+      }
+      if (!valid) {
+        throw libsemigroups::LibsemigroupsException(
+            __FILE__,
+            __LINE__,
+            __func__,
+            "invalid packed words, expected non-decreasing offsets from 0 to "
+                + std::to_string(letters.size()));
+      }
+    }
+
+    std::size_t size() const noexcept {
+      return _size;
+    }
+
+    // Copy word i into `out`, reusing its storage.
+    template <typename Word>
+    void get(std::size_t i, Word& out) const {
+      out.assign(_letters + _offsets[i], _letters + _offsets[i + 1]);
+    }
+
+   private:
+    std::size_t const* _letters;
+    uint64_t const*    _offsets;
+    std::size_t        _size;
+  };
+
+  // Split [0, n) into at most `nthreads` contiguous blocks and call
+  // f(block, first, last) for each, on its own thread when there is more
+  // than one block. Blocks are numbered in order, so per-block output can
+  // be concatenated afterwards. The first exception thrown by any block is
+  // rethrown once every thread has been joined.
+  template <typename Func>
+  std::size_t for_each_block(std::size_t n, std::size_t nthreads, Func&& f) {
+    std::size_t const blocks = std::max<std::size_t>(
+        1, std::min(nthreads, n));
+    if (blocks == 1) {
+      f(0, 0, n);
+      return 1;
+    }
+    std::vector<std::exception_ptr> errors(blocks);
+    std::vector<std::thread>        threads;
+    threads.reserve(blocks);
+    for (std::size_t b = 0; b < blocks; ++b) {
+      threads.emplace_back([&, b]() {
+        try {
+          f(b, (n * b) / blocks, (n * (b + 1)) / blocks);
+        } catch (...) {
+          errors[b] = std::current_exception();
+        }
+      });
+    }
+    for (auto& t : threads) {
+      t.join();
+    }
+    for (auto const& e : errors) {
+      if (e) {
+        std::rethrow_exception(e);
+      }
+    }
+    return blocks;
+  }
+
+  // Move the next (at most) n words of `range` into a PackedWords. `range`
+  // is anything with the get / next / at_end interface of libsemigroups'
+  // ranges, such as Paths or WordRange, and is left positioned after the
+  // last word taken.
+  template <typename Range>
+  PackedWords take_words(Range& range, std::size_t n) {
+    PackedWords result;
+    for (; n != 0 && !range.at_end(); --n) {
+      result.push_back(range.get());
+      range.next();
+    }
+    return result;
+  }
+
+  // Write the next words of `range` into buffers owned by the caller, for
+  // as long as they fit, and return how many were written. At most
+  // offsets.size() - 1 words and letters.size() letters are written, with
+  // the same layout as PackedWords; offsets past the last word written are
+  // left untouched. A word that does not fit stays the current word of
+  // `range`.
+  template <typename Range>
+  std::size_t fill_words(Range&                       range,
+                         jlcxx::ArrayRef<std::size_t> letters,
+                         jlcxx::ArrayRef<uint64_t>    offsets) {
+    if (offsets.size() == 0) {
+      return 0;
+    }
+    std::size_t* const out       = letters.data();
+    uint64_t* const    off       = offsets.data();
+    std::size_t const  max_words = offsets.size() - 1;
+    std::size_t const  capacity  = letters.size();
+    std::size_t        n         = 0;
+    off[0]                       = 0;
+    for (; n != max_words && !range.at_end(); range.next()) {
+      auto const& w = range.get();
+      if (w.size() > capacity - off[n]) {
+        break;
+      }
+      std::copy(w.cbegin(), w.cend(), out + off[n]);
+      off[n + 1] = off[n] + w.size();
+      ++n;
+    }
+    return n;
+  }
+
+}  // namespace libsemigroups_julia
+
+namespace jlcxx {
+  template <>
+  struct IsMirroredType<libsemigroups_julia::PackedWords> : std::false_type {
+  };
+}  // namespace jlcxx
+
+#endif  // LIBSEMIGROUPS_JULIA_PACKED_WORDS_HPP_
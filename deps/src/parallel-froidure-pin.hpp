@@ -0,0 +1,486 @@
+//
+// Semigroups.jl
+// Copyright (C) 2026, James W. Swent
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+// ParallelFroidurePin<E> enumerates the semigroup generated by the
+// generators of a FroidurePin<E> on several threads, and numbers the
+// elements, and fills in the Cayley graphs, prefixes, suffixes, first and
+// final letters and lengths, exactly as libsemigroups' FroidurePin<E> does
+// for the same generators. The state of a libsemigroups FroidurePin cannot
+// be filled in from outside, so the result is only available to
+// save_froidure_pin in frozen-froidure-pin.hpp, which takes either.
+//
+// The Froidure-Pin algorithm handles the elements one word length at a
+// time. For each length, the engine
+//
+//   1. on every thread, for a block of the elements of that length,
+//      multiplies by each generator where the pair is reduced, and looks the
+//      product up in the hash table of the elements found so far, which is
+//      read-only at this point;
+//   2. on one thread, in the order libsemigroups visits the pairs, numbers
+//      the products that were not found, discarding the repeats;
+//   3. on one thread, fills in the right Cayley graph for the remaining
+//      pairs, each of which is a couple of lookups;
+//   4. on every thread, fills in the left Cayley graph for the elements of
+//      that length.
+//
+// Only the products in step 1 are expensive, and they are independent. The
+// order of steps 2 and 3 is what makes every position agree with
+// libsemigroups.
+//
+// In compact mode, the left Cayley graph and the table of reduced pairs are
+// not stored. Step 1 then computes the product for every pair, step 3 is
+// skipped, and so is step 4. A pair that is not reduced never gives a new
+// element, so the numbering and the right Cayley graph are unchanged; the
+// cost is the extra products, and save_froidure_pin writes no left Cayley
+// graph.
+
+#ifndef LIBSEMIGROUPS_JULIA_PARALLEL_FROIDURE_PIN_HPP_
+#define LIBSEMIGROUPS_JULIA_PARALLEL_FROIDURE_PIN_HPP_
+
+// CRITICAL: libsemigroups_julia.hpp MUST be included first (fmt consteval fix)
+#include "libsemigroups_julia.hpp"
+
+#include "packed-words.hpp"  // for for_each_block
+
+#include <libsemigroups/adapters.hpp>
+#include <libsemigroups/constants.hpp>
+#include <libsemigroups/exception.hpp>
+#include <libsemigroups/froidure-pin.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace libsemigroups_julia {
+
+  template <typename E>
+  class ParallelFroidurePin {
+   public:
+    using element_type = E;
+
+    // The part of a WordGraph that save_froidure_pin reads
+    class CayleyGraph {
+     public:
+      uint32_t target_no_checks(size_t i, size_t a) const noexcept {
+        return _targets[i * _ngens + a];
+      }
+
+     private:
+      friend class ParallelFroidurePin;
+
+      std::vector<uint32_t> _targets;
+      size_t                _ngens = 0;
+    };
+
+    ParallelFroidurePin(libsemigroups::FroidurePin<E> const& fp,
+                        size_t                               nthreads,
+                        bool                                 compact = false)
+        : _gens(),
+          _nthreads(std::max<size_t>(nthreads, 1)),
+          _compact(compact),
+          _finished(false) {
+      for (size_t a = 0; a < fp.number_of_generators(); ++a) {
+        _gens.push_back(fp.generator(a));
+      }
+      _right._ngens = _left._ngens = _gens.size();
+      reserve_slots(1);
+    }
+
+    // Fully enumerates the semigroup
+    void run();
+
+    size_t size() const noexcept {
+      return _elements.size();
+    }
+
+    size_t number_of_generators() const noexcept {
+      return _gens.size();
+    }
+
+    size_t degree() const {
+      return _gens.empty() ? 0 : libsemigroups::Degree<E>()(_gens[0]);
+    }
+
+    size_t number_of_idempotents() const noexcept {
+      return _number_of_idempotents;
+    }
+
+    E const& operator[](size_t i) const noexcept {
+      return _elements[i];
+    }
+
+    uint32_t position_of_generator_no_checks(size_t a) const noexcept {
+      return _letter_to_pos[a];
+    }
+
+    CayleyGraph const& right_cayley_graph() const noexcept {
+      return _right;
+    }
+
+    CayleyGraph const& left_cayley_graph() const noexcept {
+      return _left;
+    }
+
+    uint32_t prefix_no_checks(size_t i) const noexcept {
+      return _prefix[i];
+    }
+
+    uint32_t suffix_no_checks(size_t i) const noexcept {
+      return _suffix[i];
+    }
+
+    uint32_t first_letter_no_checks(size_t i) const noexcept {
+      return _first[i];
+    }
+
+    uint32_t final_letter_no_checks(size_t i) const noexcept {
+      return _final[i];
+    }
+
+    uint32_t length_no_checks(size_t i) const noexcept {
+      return _length[i];
+    }
+
+    uint32_t to_sorted_position(size_t i) const noexcept {
+      return _to_sorted[i];
+    }
+
+    bool is_idempotent_no_checks(size_t i) const noexcept {
+      return _idempotent[i];
+    }
+
+   private:
+    using EqualTo = libsemigroups::EqualTo<E>;
+    using Hash    = libsemigroups::Hash<E>;
+    using Less    = libsemigroups::Less<E>;
+    using Product = libsemigroups::Product<E>;
+
+    static constexpr uint32_t undefined
+        = static_cast<uint32_t>(libsemigroups::UNDEFINED);
+
+    // A product found on step 1 of a level that was not yet known
+    struct Candidate {
+      size_t   pair;  // i * number_of_generators() + j
+      uint64_t hash;
+      E        x;
+    };
+
+    ////////////////////////////////////////////////////////////////////////
+    // Hash table of positions
+    ////////////////////////////////////////////////////////////////////////
+
+    // Open addressing with linear probing, storing positions in _elements,
+    // so that the elements are not stored twice. find is safe to call from
+    // several threads as long as nothing is inserted.
+
+    size_t slot(uint64_t hash) const noexcept {
+      // Fibonacci hashing, so that hash values that differ only in their
+      // high bits still spread over the table
+      return (hash * 0x9E3779B97F4A7C15ULL) >> _shift;
+    }
+
+    uint32_t find(E const& x, uint64_t hash) const {
+      size_t const mask = _slots.size() - 1;
+      for (size_t k = slot(hash);; k = (k + 1) & mask) {
+        uint32_t const i = _slots[k];
+        if (i == undefined || EqualTo()(_elements[i], x)) {
+          return i;
+        }
+      }
+    }
+
+    void insert(uint32_t pos, uint64_t hash) {
+      size_t const mask = _slots.size() - 1;
+      size_t       k    = slot(hash);
+      while (_slots[k] != undefined) {
+        k = (k + 1) & mask;
+      }
+      _slots[k] = pos;
+    }
+
+    // Keeps the load factor at most 1/2
+    void reserve_slots(size_t n) {
+      if (2 * n <= _slots.size()) {
+        return;
+      }
+      size_t bits = 10;
+      while ((size_t(1) << bits) < 2 * n) {
+        ++bits;
+      }
+      _slots.assign(size_t(1) << bits, undefined);
+      _shift = 64 - bits;
+      for (size_t i = 0; i < _elements.size(); ++i) {
+        insert(static_cast<uint32_t>(i), Hash()(_elements[i]));
+      }
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+    // Enumeration
+    ////////////////////////////////////////////////////////////////////////
+
+    uint32_t add_element(E&& x, uint64_t hash) {
+      if (_elements.size() >= undefined) {
+        throw libsemigroups::LibsemigroupsException(
+            __FILE__,
+            __LINE__,
+            __func__,
+            "cannot enumerate more than " + std::to_string(undefined)
+                + " elements");
+      }
+      uint32_t const pos = static_cast<uint32_t>(_elements.size());
+      if (!_found_one && EqualTo()(x, libsemigroups::One<E>()(x))) {
+        _found_one = true;
+        _pos_one   = pos;
+      }
+      reserve_slots(_elements.size() + 1);
+      _elements.push_back(std::move(x));
+      insert(pos, hash);
+      size_t const ngens = _gens.size();
+      _right._targets.resize(_right._targets.size() + ngens, undefined);
+      if (!_compact) {
+        _left._targets.resize(_left._targets.size() + ngens, undefined);
+        _reduced.resize(_reduced.size() + ngens, false);
+      }
+      return pos;
+    }
+
+    void add_generators();
+    void enumerate_level(size_t lo, size_t hi, bool first_level);
+    void left_cayley_graph_level(size_t lo, size_t hi, bool first_level);
+    void idempotents_and_sorting();
+
+    std::vector<E>        _gens;
+    std::vector<E>        _elements;
+    std::vector<uint32_t> _letter_to_pos;
+    std::vector<uint32_t> _prefix, _suffix, _first, _final, _length;
+    std::vector<uint8_t>  _reduced;
+    CayleyGraph           _right, _left;
+    std::vector<uint32_t> _slots;
+    size_t                _shift = 64;
+    bool                  _found_one = false;
+    uint32_t              _pos_one   = undefined;
+    std::vector<uint8_t>  _idempotent;
+    size_t                _number_of_idempotents = 0;
+    std::vector<uint32_t> _to_sorted;
+    size_t                _nthreads;
+    bool                  _compact;
+    bool                  _finished;
+  };
+
+  ////////////////////////////////////////////////////////////////////////
+  // ParallelFroidurePin — out of line
+  ////////////////////////////////////////////////////////////////////////
+
+  template <typename E>
+  void ParallelFroidurePin<E>::run() {
+    if (_finished) {
+      return;
+    }
+    add_generators();
+    size_t lo = 0, hi = _elements.size();
+    for (bool first_level = true; lo < hi; first_level = false) {
+      enumerate_level(lo, hi, first_level);
+      if (!_compact) {
+        left_cayley_graph_level(lo, hi, first_level);
+      }
+      lo = hi;
+      hi = _elements.size();
+    }
+    idempotents_and_sorting();
+    _finished = true;
+  }
+
+  // As in FroidurePin::add_generators: a generator equal to an earlier one
+  // is not a new element, but its letter still needs a position.
+  template <typename E>
+  void ParallelFroidurePin<E>::add_generators() {
+    for (size_t j = 0; j < _gens.size(); ++j) {
+      uint64_t const h   = Hash()(_gens[j]);
+      uint32_t       pos = find(_gens[j], h);
+      if (pos == undefined) {
+        pos = add_element(E(_gens[j]), h);
+        _first.push_back(j);
+        _final.push_back(j);
+        _length.push_back(1);
+        _prefix.push_back(undefined);
+        _suffix.push_back(undefined);
+      }
+      _letter_to_pos.push_back(pos);
+    }
+  }
+
+  template <typename E>
+  void ParallelFroidurePin<E>::enumerate_level(size_t lo,
+                                               size_t hi,
+                                               bool   first_level) {
+    size_t const ngens = _gens.size();
+    // Whether the suffix of i times generator j is a new element
+    auto suffix_reduced
+        = [&](size_t i, size_t j) { return _reduced[_suffix[i] * ngens + j]; };
+
+    // Step 1: the products, in parallel
+    std::vector<std::vector<Candidate>> candidates(_nthreads);
+    for_each_block(hi - lo, _nthreads, [&](size_t b, size_t first, size_t last) {
+      if (first == last) {
+        return;
+      }
+      E    tmp(_elements[lo + first]);
+      auto& out = candidates[b];
+      for (size_t i = lo + first; i < lo + last; ++i) {
+        for (size_t j = 0; j < ngens; ++j) {
+          if (!_compact && !first_level && !suffix_reduced(i, j)) {
+            continue;
+          }
+          Product()(tmp, _elements[i], _gens[j]);
+          uint64_t const h   = Hash()(tmp);
+          uint32_t const pos = find(tmp, h);
+          if (pos != undefined) {
+            _right._targets[i * ngens + j] = pos;
+          } else {
+            out.push_back({i * ngens + j, h, tmp});
+          }
+        }
+      }
+    });
+
+    // Step 2: the new elements, in the order libsemigroups finds them
+    for (auto& block : candidates) {
+      for (auto& c : block) {
+        size_t const i   = c.pair / ngens;
+        size_t const j   = c.pair % ngens;
+        uint32_t     pos = find(c.x, c.hash);
+        if (pos == undefined) {
+          pos = add_element(std::move(c.x), c.hash);
+          _first.push_back(_first[i]);
+          _final.push_back(j);
+          _length.push_back(_length[i] + 1);
+          _prefix.push_back(i);
+          _suffix.push_back(first_level
+                                ? _letter_to_pos[j]
+                                : _right._targets[_suffix[i] * ngens + j]);
+          if (!_compact) {
+            _reduced[c.pair] = true;
+          }
+        }
+        _right._targets[c.pair] = pos;
+      }
+      block.clear();
+      block.shrink_to_fit();
+    }
+
+    // Step 3: the pairs that are not reduced, as in FroidurePin::enumerate.
+    // Every target read here is either from an earlier level, or for a pair
+    // that libsemigroups has also already visited.
+    if (first_level || _compact) {
+      return;
+    }
+    auto right = [&](size_t i, size_t j) -> uint32_t& {
+      return _right._targets[i * ngens + j];
+    };
+    for (size_t i = lo; i < hi; ++i) {
+      uint32_t const b = _first[i];
+      uint32_t const s = _suffix[i];
+      for (size_t j = 0; j < ngens; ++j) {
+        if (suffix_reduced(i, j)) {
+          continue;
+        }
+        uint32_t const r = right(s, j);
+        if (_found_one && r == _pos_one) {
+          right(i, j) = _letter_to_pos[b];
+        } else if (_prefix[r] != undefined) {
+          right(i, j)
+              = right(_left._targets[_prefix[r] * ngens + b], _final[r]);
+        } else {
+          right(i, j) = right(_letter_to_pos[b], _final[r]);
+        }
+      }
+    }
+  }
+
+  template <typename E>
+  void ParallelFroidurePin<E>::left_cayley_graph_level(size_t lo,
+                                                       size_t hi,
+                                                       bool   first_level) {
+    size_t const ngens = _gens.size();
+    auto&        left  = _left._targets;
+    auto const&  right = _right._targets;
+    for_each_block(hi - lo, _nthreads, [&](size_t, size_t first, size_t last) {
+      for (size_t i = lo + first; i < lo + last; ++i) {
+        uint32_t const b = _final[i];
+        for (size_t j = 0; j < ngens; ++j) {
+          uint32_t const x = first_level
+                                 ? _letter_to_pos[j]
+                                 : left[_prefix[i] * ngens + j];
+          left[i * ngens + j] = right[x * ngens + b];
+        }
+      }
+    });
+  }
+
+  template <typename E>
+  void ParallelFroidurePin<E>::idempotents_and_sorting() {
+    size_t const n = _elements.size();
+
+    _idempotent.assign(n, false);
+    for_each_block(n, _nthreads, [&](size_t, size_t first, size_t last) {
+      if (first == last) {
+        return;
+      }
+      E tmp(_elements[first]);
+      for (size_t i = first; i < last; ++i) {
+        Product()(tmp, _elements[i], _elements[i]);
+        _idempotent[i] = EqualTo()(tmp, _elements[i]);
+      }
+    });
+    _number_of_idempotents
+        = std::count(_idempotent.begin(), _idempotent.end(), true);
+
+    // Each block is sorted on its own thread, then the blocks are merged
+    std::vector<uint32_t> sorted(n);
+    std::iota(sorted.begin(), sorted.end(), 0);
+    auto less = [this](uint32_t i, uint32_t j) {
+      return Less()(_elements[i], _elements[j]);
+    };
+    std::vector<size_t> bounds;
+    size_t const        blocks = for_each_block(
+        n, _nthreads, [&](size_t, size_t first, size_t last) {
+          std::sort(sorted.begin() + first, sorted.begin() + last, less);
+        });
+    for (size_t b = 0; b <= blocks; ++b) {
+      bounds.push_back((n * b) / blocks);
+    }
+    for (size_t b = 2; b < bounds.size(); ++b) {
+      std::inplace_merge(sorted.begin(),
+                         sorted.begin() + bounds[b - 1],
+                         sorted.begin() + bounds[b],
+                         less);
+    }
+
+    _to_sorted.resize(n);
+    for (size_t i = 0; i < n; ++i) {
+      _to_sorted[sorted[i]] = i;
+    }
+  }
+
+}  // namespace libsemigroups_julia
+
+#endif  // LIBSEMIGROUPS_JULIA_PARALLEL_FROIDURE_PIN_HPP_
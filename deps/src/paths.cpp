@@ -18,14 +18,21 @@
 
 #include "libsemigroups_julia.hpp"
 
+#include "packed-words.hpp"
+
+#include <libsemigroups/constants.hpp>
 #include <libsemigroups/order.hpp>
 #include <libsemigroups/paths.hpp>
 #include <libsemigroups/types.hpp>
 #include <libsemigroups/word-graph.hpp>
 
+#include <jlcxx/array.hpp>
+
 #include <cstddef>
 #include <cstdint>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace jlcxx {
   template <>
@@ -34,9 +41,87 @@ namespace jlcxx {
 
 namespace libsemigroups_julia {
 
-  void define_paths(jl::Module& m) {
+  namespace {
+
     using Paths_     = libsemigroups::Paths<uint32_t>;
     using WordGraph_ = libsemigroups::WordGraph<uint32_t>;
+
+    // Call f(k, count) for k = 0, ..., n - 1, where count is the number of
+    // paths in the range of `p` of length p.min() + k, ignoring p.max() and
+    // how far `p` has been advanced. The number of paths of length L
+    // ending at each node is the L-th power of the adjacency matrix applied
+    // to the source, so each length is one product with the transpose,
+    // computed by pulling along the reversed edges; the nodes are split
+    // into blocks that write disjoint entries. Counts are modulo 2 ^ 64.
+    template <typename Func>
+    void for_each_path_count(Paths_ const& p,
+                             std::size_t   n,
+                             std::size_t   nthreads,
+                             Func&&        f) {
+      p.throw_if_source_undefined();
+      WordGraph_ const& wg     = p.word_graph();
+      uint32_t const    target = p.target();
+      std::size_t const N      = wg.number_of_nodes();
+      std::size_t const deg    = wg.out_degree();
+
+      std::vector<uint64_t> offsets(N + 1, 0);
+      for (uint32_t s = 0; s < N; ++s) {
+        for (std::size_t a = 0; a < deg; ++a) {
+          uint32_t const t = wg.target_no_checks(s, a);
+          if (t != libsemigroups::UNDEFINED) {
+            ++offsets[t + 1];
+          }
+        }
+      }
+      for (std::size_t v = 0; v < N; ++v) {
+        offsets[v + 1] += offsets[v];
+      }
+      std::vector<uint32_t> sources(offsets[N]);
+      std::vector<uint64_t> next(offsets.cbegin(), offsets.cend() - 1);
+      for (uint32_t s = 0; s < N; ++s) {
+        for (std::size_t a = 0; a < deg; ++a) {
+          uint32_t const t = wg.target_no_checks(s, a);
+          if (t != libsemigroups::UNDEFINED) {
+            sources[next[t]++] = s;
+          }
+        }
+      }
+
+      std::vector<uint64_t> cur(N, 0);
+      next.assign(N, 0);
+      cur[p.source()]          = 1;
+      std::size_t const length = p.min() + n;
+      for (std::size_t L = 0; L < length; ++L) {
+        if (L >= p.min()) {
+          uint64_t count = 0;
+          if (target != libsemigroups::UNDEFINED) {
+            count = cur[target];
+          } else {
+            for (auto x : cur) {
+              count += x;
+            }
+          }
+          f(L - p.min(), count);
+        }
+        if (L + 1 == length) {
+          break;
+        }
+        for_each_block(N, nthreads, [&](size_t, size_t first, size_t last) {
+          for (std::size_t v = first; v < last; ++v) {
+            uint64_t x = 0;
+            for (uint64_t k = offsets[v]; k < offsets[v + 1]; ++k) {
+              x += cur[sources[k]];
+            }
+            next[v] = x;
+          }
+        });
+        std::swap(cur, next);
+      }
+    }
+
+  }  // namespace
+
+  void define_paths(jl::Module& m) {
     using libsemigroups::Order;
 
     // Registered as "PathsCxx" so the public Julia name `Paths` is free for
@@ -84,6 +169,62 @@ namespace libsemigroups_julia {
     type.method("count",
                 [](Paths_ const& self) -> uint64_t { return self.count(); });
 
+    // --- Bulk enumeration and counting ---
+    // `get` copies one word across the boundary per call; these advance the
+    // range natively and return many words at once, see packed-words.hpp.
+
+    type.method("take!", [](Paths_& self, std::size_t n) -> PackedWords {
+      return take_words(self, n);
+    });
+
+    type.method("fill!",
+                [](Paths_&                      self,
+                   jlcxx::ArrayRef<std::size_t> letters,
+                   jlcxx::ArrayRef<uint64_t>    offsets) -> std::size_t {
+                  return fill_words(self, letters, offsets);
+                });
+
+    // count_by_length!(p, out, nthreads) writes the number of paths of
+    // length min(p) + k to out[k], for every k.
+    type.method("count_by_length!",
+                [](Paths_ const&             self,
+                   jlcxx::ArrayRef<uint64_t> out,
+                   std::size_t               nthreads) {
+                  uint64_t* const first = out.data();
+                  for_each_path_count(
+                      self, out.size(), nthreads, [&](size_t k, uint64_t c) {
+                        first[k] = c;
+                      });
+                });
+
+    // number_of_paths(p, nthreads) is the number of paths in the range of p
+    // from its start, however far p has been advanced. With more than one
+    // thread and a finite maximum length, this is the sum of the counts in
+    // count_by_length!, otherwise it is the count of a fresh range with the
+    // same settings, leaving the choice of algorithm to libsemigroups.
+    type.method(
+        "number_of_paths",
+        [](Paths_ const& self, std::size_t nthreads) -> uint64_t {
+          self.throw_if_source_undefined();
+          if (nthreads > 1 && self.max() != libsemigroups::POSITIVE_INFINITY) {
+            if (self.max() < self.min()) {
+              return 0;
+            }
+            uint64_t result = 0;
+            for_each_path_count(self,
+                                self.max() - self.min() + 1,
+                                nthreads,
+                                [&](size_t, uint64_t c) { result += c; });
+            return result;
+          }
+          Paths_ fresh(self.word_graph());
+          fresh.source(self.source())
+              .target(self.target())
+              .min(self.min())
+              .max(self.max());
+          return fresh.count();
+        });
+
     // --- Settings: getter / setter pairs ---
     // Same-name different-arity overloads are unreliable in CxxWrap; split
     // setters to use the `!` suffix per Julia convention.
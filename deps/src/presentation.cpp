@@ -18,6 +18,8 @@
 
 #include "libsemigroups_julia.hpp"
 
+#include "packed-words.hpp"
+
 #include <libsemigroups/presentation.hpp>
 #include <libsemigroups/types.hpp>
 
@@ -318,10 +320,10 @@ namespace libsemigroups_julia {
                return libsemigroups::presentation::to_gap_string(p, var_name);
              });
 
-    m.method("rules_vector",
-             [](Presentation<word_type> const& p) -> std::vector<word_type> {
-               return std::vector<word_type>(p.rules.cbegin(), p.rules.cend());
-             });
+    // rules_vector - p.rules packed into one PackedWords (lhs, rhs, ...)
+    m.method("rules_vector", [](Presentation<word_type> const& p) -> PackedWords {
+      return PackedWords::from(p.rules);
+    });
 
     type.method(
         "is_equal",
@@ -0,0 +1,238 @@
+//
+// Semigroups.jl
+// Copyright (C) 2026, James W. Swent
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+// Removal of redundant rules from a presentation in one native pass.
+//
+// Trivial rules u = u, and duplicates of earlier rules (u = v and v = u
+// being the same rule), are removed first. Every remaining rule is then a
+// candidate, and the pass proceeds in rounds: each candidate is tested
+// concurrently, by running KnuthBendix or ToddCoxeter for a bounded time on
+// the other rules and asking whether they already identify its two sides.
+// Removing one rule may make another necessary, so only the last rule
+// shown to be redundant is removed in each round, and the next round tests
+// just the other rules shown redundant in this one. Removing rules never
+// makes another rule redundant, so a rule not shown redundant is not tested
+// again.
+//
+// This is libsemigroups' knuth_bendix::redundant_rule and
+// todd_coxeter::redundant_rule applied until no redundant rule is found,
+// with every test of a round run at once and every removal recorded.
+
+// CRITICAL: libsemigroups_julia.hpp MUST be included first (fmt consteval fix)
+#include "libsemigroups_julia.hpp"
+
+#include "packed-words.hpp"
+
+#include <libsemigroups/cong-common-helpers.hpp>
+#include <libsemigroups/exception.hpp>
+#include <libsemigroups/knuth-bendix-class.hpp>
+#include <libsemigroups/presentation.hpp>
+#include <libsemigroups/todd-coxeter-class.hpp>
+#include <libsemigroups/types.hpp>
+
+#include <jlcxx/array.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace libsemigroups_julia {
+
+  namespace {
+
+    using libsemigroups::Presentation;
+    using libsemigroups::word_type;
+
+    using Clock = std::chrono::steady_clock;
+    using Rule  = std::pair<word_type, word_type>;
+
+    // Why a rule was removed, as recorded in the log.
+    enum class removal : uint8_t { trivial = 0, duplicate = 1, redundant = 2 };
+
+    // Whether the rules other than rules[i] are shown, within `timeout`, to
+    // identify the two sides of rules[i].
+    template <typename Thing>
+    bool follows(Presentation<word_type> const& p,
+                 std::vector<Rule> const&       rules,
+                 size_t                         i,
+                 std::chrono::nanoseconds       timeout) {
+      Presentation<word_type> q(p);
+      q.rules.clear();
+      for (size_t j = 0; j < rules.size(); ++j) {
+        if (j != i) {
+          q.rules.push_back(rules[j].first);
+          q.rules.push_back(rules[j].second);
+        }
+      }
+      Thing thing(libsemigroups::congruence_kind::twosided, q);
+      thing.run_for(timeout);
+      return libsemigroups::congruence_common::currently_contains(
+                 thing, rules[i].first, rules[i].second)
+             == libsemigroups::tril::TRUE;
+    }
+
+    // Remove redundant rules from `p` in place, recording the 0-based index
+    // in the original rules of each rule removed, and why, in removal order.
+    // Each test runs for at most `timeout`, and no test starts once `budget`
+    // has elapsed, if it is non-negative. Returns the number removed.
+    template <typename Thing>
+    size_t remove_redundant_rules(Presentation<word_type>& p,
+                                  uint64_t*                removed,
+                                  uint8_t*                 reasons,
+                                  size_t                   nthreads,
+                                  int64_t                  timeout,
+                                  int64_t                  budget) {
+      size_t count  = 0;
+      auto   record = [&](size_t index, removal why) {
+        removed[count] = index;
+        reasons[count] = static_cast<uint8_t>(why);
+        ++count;
+      };
+
+      std::vector<Rule>   rules;
+      std::vector<size_t> origin;
+      {
+        std::set<Rule> seen;
+        for (size_t i = 0; i < p.rules.size() / 2; ++i) {
+          word_type const& u = p.rules[2 * i];
+          word_type const& v = p.rules[2 * i + 1];
+          if (u == v) {
+            record(i, removal::trivial);
+          } else if (!seen.insert(Rule(std::minmax(u, v))).second) {
+            record(i, removal::duplicate);
+          } else {
+            rules.emplace_back(u, v);
+            origin.push_back(i);
+          }
+        }
+      }
+
+      auto const deadline = Clock::now() + std::chrono::nanoseconds(budget);
+      std::vector<size_t> candidates(rules.size());
+      for (size_t i = 0; i < candidates.size(); ++i) {
+        candidates[i] = i;
+      }
+
+      while (!candidates.empty()) {
+        std::vector<uint8_t> shown(candidates.size(), false);
+        std::atomic<size_t>  next(0);
+        for_each_block(
+            candidates.size(), nthreads, [&](size_t, size_t, size_t) {
+              for (size_t k = next++; k < candidates.size(); k = next++) {
+                auto t = std::chrono::nanoseconds(timeout);
+                if (budget >= 0) {
+                  auto const left = deadline - Clock::now();
+                  if (left <= Clock::duration::zero()) {
+                    return;
+                  }
+                  t = std::min(
+                      t,
+                      std::chrono::duration_cast<std::chrono::nanoseconds>(
+                          left));
+                }
+                shown[k] = follows<Thing>(p, rules, candidates[k], t);
+              }
+            });
+
+        std::vector<size_t> next_candidates;
+        for (size_t k = 0; k < candidates.size(); ++k) {
+          if (shown[k]) {
+            next_candidates.push_back(candidates[k]);
+          }
+        }
+        if (next_candidates.empty()) {
+          break;
+        }
+        // Candidates are in increasing order, so this is the last rule
+        // shown to be redundant, as in libsemigroups' redundant_rule.
+        size_t const i = next_candidates.back();
+        next_candidates.pop_back();
+        record(origin[i], removal::redundant);
+        rules.erase(rules.begin() + i);
+        origin.erase(origin.begin() + i);
+        for (auto& j : next_candidates) {
+          j -= (j > i);
+        }
+        candidates = std::move(next_candidates);
+      }
+
+      p.rules.clear();
+      for (auto& rule : rules) {
+        p.rules.push_back(std::move(rule.first));
+        p.rules.push_back(std::move(rule.second));
+      }
+      return count;
+    }
+
+  }  // namespace
+
+  void define_redundant_rules(jl::Module& m) {
+    using KB = libsemigroups::KnuthBendix<word_type,
+                                          libsemigroups::detail::RewriteTrie,
+                                          libsemigroups::ShortLexCompare>;
+    using TC = libsemigroups::ToddCoxeter<word_type>;
+
+    // remove_redundant_rules!(p, removed, reasons, nthreads, timeout, budget,
+    // todd_coxeter) removes rules from p in place and writes the 0-based
+    // original index of each rule removed to `removed`, and why to
+    // `reasons` (0 trivial, 1 duplicate, 2 redundant), returning how many
+    // were removed. Both buffers must have room for every rule of p.
+    // Timeouts are in nanoseconds, and a negative budget is no budget.
+    m.method("remove_redundant_rules!",
+             [](Presentation<word_type>&  p,
+                jlcxx::ArrayRef<uint64_t> removed,
+                jlcxx::ArrayRef<uint8_t>  reasons,
+                size_t                    nthreads,
+                int64_t                   timeout,
+                int64_t                   budget,
+                bool                      todd_coxeter) -> size_t {
+               libsemigroups::presentation::throw_if_odd_number_of_rules(p);
+               p.throw_if_bad_alphabet_or_rules();
+               size_t const n = p.rules.size() / 2;
+               if (removed.size() < n || reasons.size() < n) {
+                 throw libsemigroups::LibsemigroupsException(
+                     __FILE__,
+                     __LINE__,
+                     __func__,
+                     "expected buffers of length at least "
+                         + std::to_string(n));
+               }
+               if (todd_coxeter) {
+                 return remove_redundant_rules<TC>(p,
+                                                   removed.data(),
+                                                   reasons.data(),
+                                                   nthreads,
+                                                   timeout,
+                                                   budget);
+               }
+               return remove_redundant_rules<KB>(p,
+                                                 removed.data(),
+                                                 reasons.data(),
+                                                 nthreads,
+                                                 timeout,
+                                                 budget);
+             });
+  }
+
+}  // namespace libsemigroups_julia
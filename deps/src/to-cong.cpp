@@ -20,10 +20,16 @@
 #include "libsemigroups_julia.hpp"
 
 #include <cstdint>
+#include <utility>
 
-#include <libsemigroups/cong-class.hpp>         // for Congruence
-#include <libsemigroups/froidure-pin-base.hpp>  // for FroidurePinBase
-#include <libsemigroups/to-cong.hpp>            // for to<Congruence<Word>>
+#include <libsemigroups/cong-class.hpp>          // for Congruence
+#include <libsemigroups/froidure-pin-base.hpp>   // for FroidurePinBase
+#include <libsemigroups/knuth-bendix-class.hpp>  // for KnuthBendix
+#include <libsemigroups/presentation.hpp>        // for Presentation
+#include <libsemigroups/to-cong.hpp>             // for to<Congruence<Word>>
+#include <libsemigroups/to-presentation.hpp>     // for to<Presentation>
+#include <libsemigroups/to-todd-coxeter.hpp>     // for to<ToddCoxeter>
+#include <libsemigroups/todd-coxeter-class.hpp>  // for ToddCoxeter
 #include <libsemigroups/types.hpp>       // for congruence_kind, word_type
 #include <libsemigroups/word-graph.hpp>  // for WordGraph
 
@@ -53,6 +59,36 @@ namespace libsemigroups_julia {
                    libsemigroups::Congruence<libsemigroups::word_type>>(knd,
                                                                         wg);
              });
+
+    // The ToddCoxeter and KnuthBendix that to_congruence_from_fpb would race,
+    // made on their own. The ToddCoxeter is made from a single copy of `wg`,
+    // with a node added for the identity if `fpb` does not contain one,
+    // which is moved into it rather than copied again. Same checks as
+    // to_congruence_from_fpb.
+    m.method("to_todd_coxeter_from_fpb",
+             [](libsemigroups::congruence_kind            knd,
+                libsemigroups::FroidurePinBase&           fpb,
+                libsemigroups::WordGraph<uint32_t> const& wg)
+                 -> libsemigroups::ToddCoxeter<libsemigroups::word_type> {
+               return libsemigroups::to<
+                   libsemigroups::ToddCoxeter<libsemigroups::word_type>>(
+                   knd, fpb, wg);
+             });
+
+    // The KnuthBendix is made from the presentation given by the rules of
+    // `fpb`, which is moved into it. Triggers full enumeration of `fpb`.
+    m.method("to_knuth_bendix_from_fpb",
+             [](libsemigroups::congruence_kind  knd,
+                libsemigroups::FroidurePinBase& fpb) {
+               using libsemigroups::word_type;
+               using KB = libsemigroups::KnuthBendix<
+                   word_type,
+                   libsemigroups::detail::RewriteTrie,
+                   libsemigroups::ShortLexCompare>;
+               auto p = libsemigroups::to<
+                   libsemigroups::Presentation<word_type>>(fpb);
+               return KB(knd, std::move(p));
+             });
   }
 
 }  // namespace libsemigroups_julia
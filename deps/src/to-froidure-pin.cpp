@@ -0,0 +1,106 @@
+//
+// Semigroups.jl
+// Copyright (C) 2026, James W. Swent
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+// The generators of the FroidurePin of a complete word graph, such as the
+// word graph of a ToddCoxeter once it has run: letter a acts on the nodes of
+// the graph by following the edges labelled a. The images are written
+// straight into the columns of a packed element matrix owned by Julia, from
+// which src/froidure-pin.jl makes the FroidurePin in one call, so the graph
+// is read once and never copied.
+
+// CRITICAL: libsemigroups_julia.hpp MUST be included first (fmt consteval fix)
+#include "libsemigroups_julia.hpp"
+
+#include <libsemigroups/constants.hpp>
+#include <libsemigroups/exception.hpp>
+#include <libsemigroups/word-graph.hpp>
+
+#include <jlcxx/array.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+
+namespace libsemigroups_julia {
+
+  namespace {
+
+    // Write the image of node s under letter a to out[a * N + s], where N is
+    // the number of nodes of `wg`. Throws if `out` has the wrong length, if
+    // `Scalar` cannot hold every node, or if `wg` is not complete.
+    template <typename Scalar>
+    void word_graph_generator_images(
+        libsemigroups::WordGraph<uint32_t> const& wg,
+        jlcxx::ArrayRef<Scalar>                   out) {
+      size_t const N = wg.number_of_nodes();
+      size_t const n = wg.out_degree();
+      if (out.size() != N * n) {
+        throw libsemigroups::LibsemigroupsException(
+            __FILE__,
+            __LINE__,
+            __func__,
+            "expected a buffer of length " + std::to_string(N * n)
+                + ", found " + std::to_string(out.size()));
+      }
+      if (N != 0 && N - 1 > std::numeric_limits<Scalar>::max()) {
+        throw libsemigroups::LibsemigroupsException(
+            __FILE__,
+            __LINE__,
+            __func__,
+            "the word graph has too many nodes, " + std::to_string(N)
+                + ", for the scalar type");
+      }
+      Scalar* data = out.data();
+      for (size_t a = 0; a < n; ++a) {
+        for (size_t s = 0; s < N; ++s) {
+          auto const t = wg.target_no_checks(s, a);
+          if (t == libsemigroups::UNDEFINED) {
+            throw libsemigroups::LibsemigroupsException(
+                __FILE__,
+                __LINE__,
+                __func__,
+                "expected a complete word graph, but node "
+                    + std::to_string(s) + " has no edge labelled "
+                    + std::to_string(a));
+          }
+          data[a * N + s] = static_cast<Scalar>(t);
+        }
+      }
+    }
+
+  }  // namespace
+
+  void define_to_froidure_pin(jl::Module& m) {
+    using libsemigroups::WordGraph;
+
+    m.method("word_graph_generator_images!",
+             [](WordGraph<uint32_t> const& wg, jlcxx::ArrayRef<uint8_t> out) {
+               word_graph_generator_images(wg, out);
+             });
+    m.method("word_graph_generator_images!",
+             [](WordGraph<uint32_t> const& wg, jlcxx::ArrayRef<uint16_t> out) {
+               word_graph_generator_images(wg, out);
+             });
+    m.method("word_graph_generator_images!",
+             [](WordGraph<uint32_t> const& wg, jlcxx::ArrayRef<uint32_t> out) {
+               word_graph_generator_images(wg, out);
+             });
+  }
+
+}  // namespace libsemigroups_julia
@@ -61,6 +61,13 @@ namespace jlcxx {
 
 namespace libsemigroups_julia {
 
+  // Once finished, a ToddCoxeter answers queries by walking its word graph,
+  // so batched queries may be split across threads.
+  template <>
+  constexpr bool
+      parallel_queries_v<libsemigroups::ToddCoxeter<libsemigroups::word_type>>
+      = true;
+
   void define_todd_coxeter(jl::Module& m) {
     using libsemigroups::congruence_kind;
     using libsemigroups::Order;
@@ -210,6 +217,54 @@ namespace libsemigroups_julia {
                   self.def_policy(val);
                 });
 
+    // Sizing of the enumeration: when lookaheads happen (lookahead_next,
+    // lookahead_min, lookahead_growth_factor, lookahead_growth_threshold),
+    // how many definitions are made between them (hlt_defs, f_defs,
+    // def_max), and when coincidences are processed in bulk
+    // (large_collapse). The setters that validate their argument throw
+    // LibsemigroupsException.
+    type.method("lookahead_next",
+                [](TC const& self) -> size_t { return self.lookahead_next(); });
+    type.method("set_lookahead_next!",
+                [](TC& self, size_t val) { self.lookahead_next(val); });
+
+    type.method("lookahead_min",
+                [](TC const& self) -> size_t { return self.lookahead_min(); });
+    type.method("set_lookahead_min!",
+                [](TC& self, size_t val) { self.lookahead_min(val); });
+
+    type.method("lookahead_growth_factor", [](TC const& self) -> float {
+      return self.lookahead_growth_factor();
+    });
+    type.method("set_lookahead_growth_factor!",
+                [](TC& self, float val) { self.lookahead_growth_factor(val); });
+
+    type.method("lookahead_growth_threshold", [](TC const& self) -> size_t {
+      return self.lookahead_growth_threshold();
+    });
+    type.method("set_lookahead_growth_threshold!", [](TC& self, size_t val) {
+      self.lookahead_growth_threshold(val);
+    });
+
+    type.method("hlt_defs",
+                [](TC const& self) -> size_t { return self.hlt_defs(); });
+    type.method("set_hlt_defs!",
+                [](TC& self, size_t val) { self.hlt_defs(val); });
+
+    type.method("f_defs",
+                [](TC const& self) -> size_t { return self.f_defs(); });
+    type.method("set_f_defs!", [](TC& self, size_t val) { self.f_defs(val); });
+
+    type.method("def_max",
+                [](TC const& self) -> size_t { return self.def_max(); });
+    type.method("set_def_max!",
+                [](TC& self, size_t val) { self.def_max(val); });
+
+    type.method("large_collapse",
+                [](TC const& self) -> size_t { return self.large_collapse(); });
+    type.method("set_large_collapse!",
+                [](TC& self, size_t val) { self.large_collapse(val); });
+
     type.method("standardize!", [](TC& self, Order ord) -> bool {
       return self.standardize(ord);
     });
@@ -247,6 +302,46 @@ namespace libsemigroups_julia {
       return self.index_of(ww.begin(), ww.end());
     });
 
+    // index_of_batch! - out[i] is the raw class index of word i. The first
+    // word goes through index_of, which runs and (if needed) standardizes
+    // the word graph exactly like the single-word binding; the rest use
+    // current_index_of against the finished, standardized word graph. See
+    // the batched cong-common helpers for the threading.
+    m.method("tc_index_of_batch!",
+             [](TC&                       self,
+                jlcxx::ArrayRef<size_t>   letters,
+                jlcxx::ArrayRef<uint64_t> offsets,
+                jlcxx::ArrayRef<size_t>   out,
+                size_t                    nthreads) {
+               PackedWordsView words(letters, offsets);
+               if (words.size() != out.size()) {
+                 throw libsemigroups::LibsemigroupsException(
+                     __FILE__,
+                     __LINE__,
+                     __func__,
+                     "expected " + std::to_string(words.size())
+                         + " results, found " + std::to_string(out.size()));
+               }
+               std::size_t const n    = words.size();
+               size_t*           data = out.data();
+               if (n == 0) {
+                 return;
+               }
+               word_type w;
+               words.get(0, w);
+               data[0] = self.index_of(w.begin(), w.end());
+               for_each_block(n,
+                              query_blocks<TC>(n, nthreads),
+                              [&](size_t, size_t first, size_t last) {
+                                word_type scratch;
+                                for (size_t i = first; i < last; ++i) {
+                                  words.get(i, scratch);
+                                  data[i] = self.current_index_of(
+                                      scratch.begin(), scratch.end());
+                                }
+                              });
+             });
+
     type.method("current_word_of", [](TC const& self, size_t i) -> word_type {
       word_type out;
       self.current_word_of(std::back_inserter(out), i);
@@ -18,10 +18,19 @@
 
 #include "libsemigroups_julia.hpp"
 
+#include "packed-words.hpp"
+
+#include <libsemigroups/exception.hpp>
 #include <libsemigroups/word-graph.hpp>
 
+#include <jlcxx/array.hpp>
+
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
 
 namespace jlcxx {
   template <>
@@ -31,6 +40,170 @@ namespace jlcxx {
 
 namespace libsemigroups_julia {
 
+  namespace {
+
+    // The targets of a WordGraph<uint32_t> live in a single node-major
+    // std::vector (DynamicArray2). Rows can be padded with unused columns
+    // when the out-degree has grown after construction, so the distance
+    // between consecutive rows is not always out_degree().
+    std::size_t targets_stride(libsemigroups::WordGraph<uint32_t> const& g) {
+      if (g.number_of_nodes() < 2) {
+        return g.out_degree();
+      }
+      return static_cast<std::size_t>(&*g.cbegin_targets(1)
+                                      - &*g.cbegin_targets(0));
+    }
+
+    void throw_if_bad_table_size(libsemigroups::WordGraph<uint32_t> const& g,
+                                 std::size_t                               n) {
+      if (n != g.number_of_nodes() * g.out_degree()) {
+        throw libsemigroups::LibsemigroupsException(
+            __FILE__,
+            __LINE__,
+            __func__,
+            "expected a table with " + std::to_string(g.number_of_nodes())
+                + " x " + std::to_string(g.out_degree()) + " entries, found "
+                + std::to_string(n));
+      }
+    }
+
+    void throw_if_bad_node(libsemigroups::WordGraph<uint32_t> const& g,
+                           uint32_t                                  s) {
+      if (s >= g.number_of_nodes()) {
+        throw libsemigroups::LibsemigroupsException(
+            __FILE__,
+            __LINE__,
+            __func__,
+            "node value out of bounds, expected value in [0, "
+                + std::to_string(g.number_of_nodes()) + "), found "
+                + std::to_string(s));
+      }
+    }
+
+    void throw_if_bad_length(libsemigroups::WordGraph<uint32_t> const& g,
+                             std::size_t                               n) {
+      if (n != g.number_of_nodes()) {
+        throw libsemigroups::LibsemigroupsException(
+            __FILE__,
+            __LINE__,
+            __func__,
+            "expected one entry per node ("
+                + std::to_string(g.number_of_nodes()) + "), found "
+                + std::to_string(n));
+      }
+    }
+
+    ////////////////////////////////////////////////////////////////////////
+    // Algorithms. Nodes and labels are raw (0-based) and missing edges are
+    // UNDEFINED, as everywhere else at the binding boundary. Every traversal
+    // is iterative, so that graphs with millions of nodes do not overflow
+    // the stack, and visits the edges of a node in label order.
+    ////////////////////////////////////////////////////////////////////////
+
+    constexpr uint32_t UNDEF = static_cast<uint32_t>(libsemigroups::UNDEFINED);
+
+    // Tarjan's algorithm. Writes the component of every node to `id` and
+    // returns the number of components. Components are numbered in the
+    // order they are completed, so that every edge between two different
+    // components goes from a larger number to a smaller one.
+    std::size_t scc_ids(libsemigroups::WordGraph<uint32_t> const& g,
+                        uint32_t*                                 id) {
+      std::size_t const     n   = g.number_of_nodes();
+      std::size_t const     deg = g.out_degree();
+      std::vector<uint32_t> index(n, UNDEF), low(n), stack;
+      std::vector<std::pair<uint32_t, uint32_t>> frames;
+      std::fill(id, id + n, UNDEF);
+      uint32_t    next  = 0;
+      std::size_t count = 0;
+
+      auto visit = [&](uint32_t v) {
+        index[v] = low[v] = next++;
+        stack.push_back(v);
+        frames.emplace_back(v, 0);
+      };
+
+      for (uint32_t root = 0; root < n; ++root) {
+        if (index[root] != UNDEF) {
+          continue;
+        }
+        visit(root);
+        while (!frames.empty()) {
+          uint32_t const v = frames.back().first;
+          if (frames.back().second < deg) {
+            uint32_t const t = g.target_no_checks(v, frames.back().second++);
+            if (t == UNDEF) {
+              continue;
+            } else if (index[t] == UNDEF) {
+              visit(t);
+            } else if (id[t] == UNDEF) {
+              low[v] = std::min(low[v], index[t]);
+            }
+            continue;
+          }
+          if (low[v] == index[v]) {
+            uint32_t w;
+            do {
+              w = stack.back();
+              stack.pop_back();
+              id[w] = count;
+            } while (w != v);
+            ++count;
+          }
+          frames.pop_back();
+          if (!frames.empty()) {
+            uint32_t const u = frames.back().first;
+            low[u]           = std::min(low[u], low[v]);
+          }
+        }
+      }
+      return count;
+    }
+
+    // The nodes reachable from `source`, in breadth-first order.
+    std::vector<uint32_t> bfs_order(libsemigroups::WordGraph<uint32_t> const& g,
+                                    uint32_t source) {
+      std::size_t const     deg = g.out_degree();
+      std::vector<bool>     seen(g.number_of_nodes(), false);
+      std::vector<uint32_t> order = {source};
+      seen[source]                = true;
+      for (std::size_t i = 0; i < order.size(); ++i) {
+        for (std::size_t a = 0; a < deg; ++a) {
+          uint32_t const t = g.target_no_checks(order[i], a);
+          if (t != UNDEF && !seen[t]) {
+            seen[t] = true;
+            order.push_back(t);
+          }
+        }
+      }
+      return order;
+    }
+
+    // The nodes reachable from `source`, in depth-first preorder.
+    std::vector<uint32_t> dfs_order(libsemigroups::WordGraph<uint32_t> const& g,
+                                    uint32_t source) {
+      std::size_t const     deg = g.out_degree();
+      std::vector<bool>     seen(g.number_of_nodes(), false);
+      std::vector<uint32_t> order = {source};
+      std::vector<std::pair<uint32_t, uint32_t>> frames = {{source, 0}};
+      seen[source] = true;
+      while (!frames.empty()) {
+        auto& [v, a] = frames.back();
+        if (a == deg) {
+          frames.pop_back();
+          continue;
+        }
+        uint32_t const t = g.target_no_checks(v, a++);
+        if (t != UNDEF && !seen[t]) {
+          seen[t] = true;
+          order.push_back(t);
+          frames.emplace_back(t, 0);
+        }
+      }
+      return order;
+    }
+
+  }  // namespace
+
   void define_word_graph(jl::Module& m) {
     using WordGraph_ = libsemigroups::WordGraph<uint32_t>;
 
@@ -74,6 +247,220 @@ namespace libsemigroups_julia {
 
     type.method("add_nodes!",
                 [](WordGraph_& g, std::size_t n) { g.add_nodes(n); });
+
+    // --- Bulk access ---
+    // Whole target tables cross the boundary in one call instead of one
+    // `target` call per edge. Values are raw (0-based, UNDEFINED is
+    // typemax(uint32_t)); the Julia wrapper owns any conversion.
+
+    type.method("targets_stride", [](WordGraph_ const& g) -> std::size_t {
+      return targets_stride(g);
+    });
+
+    // targets_view borrows the table as a (stride x number_of_nodes) Julia
+    // matrix without copying. The memory belongs to `g` and is invalidated
+    // by anything that reallocates it (add_nodes!, adding generators to the
+    // owning FroidurePin, ...). Requires number_of_nodes() > 0 and
+    // out_degree() > 0; the Julia wrapper checks this before calling.
+    type.method("targets_view",
+                [](WordGraph_ const& g) -> jlcxx::ArrayRef<uint32_t, 2> {
+                  auto* first = const_cast<uint32_t*>(&*g.cbegin_targets(0));
+                  return jlcxx::make_julia_array(
+                      first, targets_stride(g), g.number_of_nodes());
+                });
+
+    // copy_targets! writes the table into a caller-allocated buffer laid out
+    // as a column-major (number_of_nodes x out_degree) matrix.
+    type.method(
+        "copy_targets!",
+        [](WordGraph_ const& g, jlcxx::ArrayRef<uint32_t> out) {
+          throw_if_bad_table_size(g, out.size());
+          std::size_t const n    = g.number_of_nodes();
+          uint32_t*         data = out.data();
+          for (uint32_t s = 0; s < n; ++s) {
+            auto it = g.cbegin_targets(s);
+            for (std::size_t a = 0; a < g.out_degree(); ++a, ++it) {
+              data[s + a * n] = *it;
+            }
+          }
+        });
+
+    // set_targets! overwrites every edge from a buffer with the same layout
+    // as copy_targets!. All entries are validated before anything is
+    // written, so `g` is unchanged if this throws.
+    type.method(
+        "set_targets!", [](WordGraph_& g, jlcxx::ArrayRef<uint32_t> in) {
+          throw_if_bad_table_size(g, in.size());
+          std::size_t const n    = g.number_of_nodes();
+          uint32_t const    undf = static_cast<uint32_t>(libsemigroups::UNDEFINED);
+          uint32_t const*   data = in.data();
+          for (std::size_t i = 0; i < in.size(); ++i) {
+            if (data[i] != undf && data[i] >= n) {
+              throw libsemigroups::LibsemigroupsException(
+                  __FILE__,
+                  __LINE__,
+                  __func__,
+                  "target value out of bounds, expected value in [0, "
+                      + std::to_string(n) + ") or UNDEFINED, found "
+                      + std::to_string(data[i]));
+            }
+          }
+          for (std::size_t a = 0; a < g.out_degree(); ++a) {
+            for (uint32_t s = 0; s < n; ++s) {
+              uint32_t t = data[s + a * n];
+              if (t == undf) {
+                g.remove_target_no_checks(s, a);
+              } else {
+                g.target_no_checks(s, a, t);
+              }
+            }
+          }
+        });
+
+    // --- Algorithms ---
+    // See the helpers above. Results are written to caller-allocated
+    // buffers, or returned as one std::vector, so that each is a single
+    // call across the boundary.
+
+    // wg_scc_ids!(g, out) -> number of components; out[s] is the component
+    // of node s.
+    m.method("wg_scc_ids!",
+             [](WordGraph_ const& g, jlcxx::ArrayRef<uint32_t> out)
+                 -> std::size_t {
+               throw_if_bad_length(g, out.size());
+               return scc_ids(g, out.data());
+             });
+
+    m.method("wg_bfs_order",
+             [](WordGraph_ const& g, uint32_t source) -> std::vector<uint32_t> {
+               throw_if_bad_node(g, source);
+               return bfs_order(g, source);
+             });
+
+    m.method("wg_dfs_order",
+             [](WordGraph_ const& g, uint32_t source) -> std::vector<uint32_t> {
+               throw_if_bad_node(g, source);
+               return dfs_order(g, source);
+             });
+
+    // wg_quotient(g, blocks, number_of_blocks) -> the word graph whose
+    // nodes are the blocks, with an edge labelled a from the block of s to
+    // the block of t whenever g has one from s to t. Throws if two nodes in
+    // one block have a-edges into different blocks, since a WordGraph has
+    // at most one edge per label.
+    m.method("wg_quotient",
+             [](WordGraph_ const&         g,
+                jlcxx::ArrayRef<uint32_t> blocks,
+                std::size_t               number_of_blocks) -> WordGraph_ {
+               throw_if_bad_length(g, blocks.size());
+               uint32_t const* block = blocks.data();
+               for (std::size_t s = 0; s < blocks.size(); ++s) {
+                 if (block[s] >= number_of_blocks) {
+                   throw libsemigroups::LibsemigroupsException(
+                       __FILE__,
+                       __LINE__,
+                       __func__,
+                       "block value out of bounds, expected value in [0, "
+                           + std::to_string(number_of_blocks) + "), found "
+                           + std::to_string(block[s]));
+                 }
+               }
+               std::size_t const deg = g.out_degree();
+               WordGraph_        q(number_of_blocks, deg);
+               for (uint32_t s = 0; s < g.number_of_nodes(); ++s) {
+                 for (std::size_t a = 0; a < deg; ++a) {
+                   uint32_t const t = g.target_no_checks(s, a);
+                   if (t == UNDEF) {
+                     continue;
+                   }
+                   uint32_t const old = q.target_no_checks(block[s], a);
+                   if (old == UNDEF) {
+                     q.target_no_checks(block[s], a, block[t]);
+                   } else if (old != block[t]) {
+                     throw libsemigroups::LibsemigroupsException(
+                         __FILE__,
+                         __LINE__,
+                         __func__,
+                         "the partition is not compatible with the word "
+                         "graph, found edges labelled "
+                             + std::to_string(a) + " from block "
+                             + std::to_string(block[s]) + " into blocks "
+                             + std::to_string(old) + " and "
+                             + std::to_string(block[t]));
+                   }
+                 }
+               }
+               return q;
+             });
+
+    type.method("number_of_edges", [](WordGraph_ const& g) -> std::size_t {
+      return g.number_of_edges();
+    });
+
+    // wg_csr!(g, offsets, targets, labels, nthreads) writes the edges in
+    // compressed sparse row form: the edges of node s are entries
+    // [offsets[s], offsets[s + 1]) of targets and labels, in label order.
+    // The nodes are split into blocks, each counted and then written on its
+    // own thread.
+    m.method(
+        "wg_csr!",
+        [](WordGraph_ const&         g,
+           jlcxx::ArrayRef<uint64_t> offsets,
+           jlcxx::ArrayRef<uint32_t> targets,
+           jlcxx::ArrayRef<uint32_t> labels,
+           std::size_t               nthreads) {
+          std::size_t const n   = g.number_of_nodes();
+          std::size_t const deg = g.out_degree();
+          if (offsets.size() != n + 1 || targets.size() != labels.size()) {
+            throw libsemigroups::LibsemigroupsException(
+                __FILE__,
+                __LINE__,
+                __func__,
+                "expected " + std::to_string(n + 1)
+                    + " offsets and as many targets as labels, found "
+                    + std::to_string(offsets.size()) + ", "
+                    + std::to_string(targets.size()) + " and "
+                    + std::to_string(labels.size()));
+          }
+          uint64_t* off = offsets.data();
+          off[0]        = 0;
+          for_each_block(n, nthreads, [&](size_t, size_t first, size_t last) {
+            for (size_t s = first; s < last; ++s) {
+              uint64_t k = 0;
+              for (std::size_t a = 0; a < deg; ++a) {
+                k += g.target_no_checks(s, a) != UNDEF;
+              }
+              off[s + 1] = k;
+            }
+          });
+          for (std::size_t s = 0; s < n; ++s) {
+            off[s + 1] += off[s];
+          }
+          if (off[n] != targets.size()) {
+            throw libsemigroups::LibsemigroupsException(
+                __FILE__,
+                __LINE__,
+                __func__,
+                "expected " + std::to_string(off[n])
+                    + " targets and labels, found "
+                    + std::to_string(targets.size()));
+          }
+          uint32_t* tgt = targets.data();
+          uint32_t* lbl = labels.data();
+          for_each_block(n, nthreads, [&](size_t, size_t first, size_t last) {
+            for (size_t s = first; s < last; ++s) {
+              uint64_t k = off[s];
+              for (std::size_t a = 0; a < deg; ++a) {
+                uint32_t const t = g.target_no_checks(s, a);
+                if (t != UNDEF) {
+                  tgt[k] = t;
+                  lbl[k] = a;
+                  ++k;
+                }
+              }
+            }
+          });
+        });
   }
 
 }  // namespace libsemigroups_julia
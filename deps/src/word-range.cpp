@@ -18,12 +18,15 @@
 
 #include "libsemigroups_julia.hpp"
 
+#include "packed-words.hpp"
+
 #include <libsemigroups/order.hpp>
 #include <libsemigroups/types.hpp>
 #include <libsemigroups/word-range.hpp>
 
 #include <jlcxx/array.hpp>
 
+#include <cstddef>
 #include <cstdint>
 #include <vector>
 
@@ -62,6 +65,20 @@ namespace libsemigroups_julia {
     type.method("init!",
                 [](WordRange& self) -> WordRange& { return self.init(); });
 
+    //////////////////////////////////////////////////////////////////////////
+    // Bulk enumeration, see packed-words.hpp
+    //////////////////////////////////////////////////////////////////////////
+
+    type.method("take!", [](WordRange& self, size_t n) -> PackedWords {
+      return take_words(self, n);
+    });
+    type.method("fill!",
+                [](WordRange&                   self,
+                   jlcxx::ArrayRef<std::size_t> letters,
+                   jlcxx::ArrayRef<uint64_t>    offsets) -> std::size_t {
+                  return fill_words(self, letters, offsets);
+                });
+
     //////////////////////////////////////////////////////////////////////////
     // Getter/setter pairs — split names to avoid CxxWrap overload issues
     //////////////////////////////////////////////////////////////////////////
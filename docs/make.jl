@@ -33,6 +33,7 @@ makedocs(;
             "Authors" => "package-info/authors.md",
             #= "Bibliography" => "package-info/bibliography.md", =#
             "Exceptions" => "package-info/exceptions.md",
+            "Binding profile" => "package-info/binding-profile.md",
         ],
         "Data Structures" => [
             "Constants" => "data-structures/constants/index.md",
@@ -48,6 +49,8 @@ makedocs(;
                     "Overview" => "data-structures/elements/matrix/index.md",
                     "The BMat8 type" => "data-structures/elements/matrix/bmat8.md",
                 ],
+                "Packed elements" => "data-structures/elements/packed-elements.md",
+                "Element tables" => "data-structures/elements/element-table.md",
             ],
             "Orders" => "data-structures/order.md",
             "Presentations" => [
@@ -60,6 +63,7 @@ makedocs(;
             "Word Graphs" => "data-structures/word-graph.md",
             "Paths" => "data-structures/paths.md",
             "Words" => "data-structures/word-range.md",
+            "Packed words" => "data-structures/packed-words.md",
         ],
         "Main Algorithms" => [
             "Overview" => "main-algorithms/index.md",
@@ -72,6 +76,7 @@ makedocs(;
                 "Overview" => "main-algorithms/froidure-pin/index.md",
                 "The FroidurePin type" => "main-algorithms/froidure-pin/froidure-pin.md",
                 "Helper functions" => "main-algorithms/froidure-pin/helpers.md",
+                "Frozen FroidurePin" => "main-algorithms/froidure-pin/frozen.md",
             ],
             "Knuth-Bendix" => [
                 "Overview" => "main-algorithms/knuth-bendix/index.md",
@@ -82,6 +87,7 @@ makedocs(;
                 "Overview" => "main-algorithms/kambites/index.md",
                 "The Kambites type" => "main-algorithms/kambites/kambites.md",
             ],
+            "Congruence" => "main-algorithms/congruence/congruence.md",
         ],
     ],
     warnonly = [:missing_docs, :linkcheck, :cross_references],
@@ -19,7 +19,8 @@ using CxxWrap
 
 import ..Semigroups: libsemigroups_julia
 
-# Load the C++ module - this creates all the wrapped types and functions
+# Load the C++ module - this creates all the wrapped types and functions,
+# except those of FroidurePins below.
 # The library path is resolved by setup.jl and may be updated in __init__.
 @wrapmodule(libsemigroups_julia, :define_julia_module)
 
@@ -27,4 +28,76 @@ function __init__()
     @initcxx
 end
 
+"""
+    FroidurePins
+
+CxxWrap module for the `FroidurePin<E>` and `FrozenFroidurePin<E>`
+instantiations, which are most of the types and methods bound.
+
+These are wrapped, and so precompiled, with the rest of the bindings, but
+registered with the C++ library only by the first call to `initialize()`,
+so that loading Semigroups.jl does not pay for them unless a `FroidurePin`
+is used. Every function that makes one of these objects calls `initialize`
+first; functions taking an existing object need not.
+
+The methods defined here extend the functions of the same name in
+`LibSemigroups`, and every other name is bound in `LibSemigroups` too, so
+callers use `LibSemigroups.f` whichever module defines `f`.
+"""
+module FroidurePins
+
+using CxxWrap
+
+import ..LibSemigroups
+import ..LibSemigroups: libsemigroups_julia
+
+_is_internal(name::Symbol) =
+    startswith(string(name), "__") ||
+    occursin('#', string(name)) ||
+    name in (:eval, :include)
+
+# Import the functions of LibSemigroups before wrapping, so that the
+# methods wrapped here are added to them rather than to new functions.
+for name in names(LibSemigroups; all = true)
+    if !_is_internal(name) &&
+       isdefined(LibSemigroups, name) &&
+       getfield(LibSemigroups, name) isa Function
+        @eval import ..LibSemigroups: $name
+    end
+end
+
+@wrapmodule(libsemigroups_julia, :define_julia_module_froidure_pin)
+
+const _initialized = Threads.Atomic{Bool}(false)
+const _initialize_lock = ReentrantLock()
+
+"""
+    initialize() -> Nothing
+
+Register the `FroidurePin` types and methods with the C++ library, if this
+has not been done already. Thread-safe.
+"""
+function initialize()
+    _initialized[] && return nothing
+    lock(_initialize_lock) do
+        if !_initialized[]
+            @initcxx
+            _initialized[] = true
+        end
+    end
+    return nothing
+end
+
+end # module FroidurePins
+
+# Bind the types and new functions of FroidurePins here too.
+for name in names(FroidurePins; all = true)
+    if !FroidurePins._is_internal(name) &&
+       !startswith(string(name), "_") &&
+       name !== :initialize &&
+       !isdefined(@__MODULE__, name)
+        @eval const $name = FroidurePins.$name
+    end
+end
+
 end # module LibSemigroups
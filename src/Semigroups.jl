@@ -69,8 +69,10 @@ using .Errors: LibsemigroupsError, @wrap_libsemigroups_call
 # Julia-side wrapper files
 include("constants.jl")
 include("report.jl")
+include("binding-profile.jl")
 include("runner.jl")
 include("order.jl")
+include("packed-words.jl")
 include("word-range.jl")
 include("word-graph.jl")
 include("paths.jl")
@@ -80,13 +82,20 @@ include("cong-common.jl")
 include("knuth-bendix.jl")
 include("todd-coxeter.jl")
 include("kambites.jl")
+include("congruence.jl")
+include("batch-run.jl")
+include("checkpoint.jl")
 
 # High-level element types
 include("bmat8.jl")
 include("transf.jl")
+include("packed-elements.jl")
+include("element-table.jl")
 
 # Algorithm types (must come after element types)
 include("froidure-pin.jl")
+include("frozen-froidure-pin.jl")
+include("async-run.jl")
 
 function _version_string(v::Union{Nothing,VersionNumber})
     return isnothing(v) ? "unknown" : string(v)
@@ -269,6 +278,11 @@ export finished, started, running, timed_out, stopped, dead
 export stopped_by_predicate, running_for, running_until
 export current_state, running_for_how_long
 export report_why_we_stopped, string_why_we_stopped
+export AsyncRun, run_async!, progress, number_of_dropped_events
+export ReportRecord, ReportCollector, record!
+export add_report_sink!, remove_report_sink!, run_reported!
+export BindingProfile, BindingProfileEntry, binding_profile, reset_binding_profile!
+export binding_profile_enabled
 export congruence_kind, onesided, twosided
 export tril, tril_FALSE, tril_TRUE, tril_unknown, tril_to_bool
 export is_undefined, is_positive_infinity, is_negative_infinity, is_limit_max
@@ -285,12 +299,18 @@ export order, set_order!, set_upper_bound!, set_min!, set_max!
 export number_of_words, random_word
 export next!, at_end, valid, init!, size_hint, upper_bound
 
+# Packed words
+export PackedWordVector, PackedWordBuffer, raw_letters
+
 # WordGraph
 export WordGraph, number_of_nodes, out_degree, target, target!, add_nodes!
+export TargetTable, target_table, target_table!, unsafe_target_table
+export number_of_edges, scc_ids, bfs_order, dfs_order, reachable, quotient, csr
 
 # Paths
 export Paths, paths, source, source!, min!, max!, order!
 export current_target, word_graph, throw_if_source_undefined
+export number_of_paths, count_by_length!
 
 # Presentation
 export Presentation, alphabet, set_alphabet!, alphabet_from_rules!
@@ -309,7 +329,7 @@ export throw_if_odd_number_of_rules, throw_if_bad_inverses
 export normalize_alphabet!, change_alphabet!, sort_rules!, sort_each_rule!
 export add_identity_rules!, add_zero_rules!, add_inverse_rules!
 export replace_subword!, replace_word!, replace_word_with_new_generator!
-export remove_duplicate_rules!, remove_trivial_rules!
+export remove_duplicate_rules!, remove_trivial_rules!, remove_redundant_rules
 export to_gap_string
 export InversePresentation, set_inverses!, inverses, inverse_of
 export throw_if_bad_alphabet_rules_or_inverses
@@ -334,7 +354,8 @@ export renner_type_B_monoid, renner_type_D_monoid
 export not_renner_type_B_monoid, not_renner_type_D_monoid
 
 # KnuthBendix
-export KnuthBendix
+export KnuthBendix, KnuthBendixRewriteFromLeft, knuth_bendix, benchmark_knuth_bendix
+export CompiledReducer
 export overlap_ABC, overlap_AB_BC, overlap_MAX_AB_BC
 export max_pending_rules, max_pending_rules!
 export check_confluence_interval, check_confluence_interval!
@@ -344,9 +365,10 @@ export number_of_active_rules, number_of_inactive_rules
 export number_of_pending_rules, total_rules
 export confluent, confluent_known, number_of_classes
 export kind, number_of_generating_pairs, generating_pairs, presentation
-export reduce_no_run, currently_contains
+export reduce_no_run, currently_contains, batch_reduce, batch_contains
+export number_of_query_copies, free_query_copies!
 export add_generating_pair!
-export active_rules, gilman_graph, gilman_graph_node_labels
+export active_rules, rebuild_with_rules!, gilman_graph, gilman_graph_node_labels
 export by_overlap_length!, is_reduced, redundant_rule
 export normal_forms, partition, non_trivial_classes
 
@@ -367,13 +389,26 @@ export use_relations_in_extra, use_relations_in_extra!
 export lower_bound, lower_bound!
 export def_version, def_version!
 export def_policy, def_policy!
+export lookahead_next, lookahead_next!, lookahead_min, lookahead_min!
+export lookahead_growth_factor, lookahead_growth_factor!
+export lookahead_growth_threshold, lookahead_growth_threshold!
+export hlt_defs, hlt_defs!, f_defs, f_defs!, def_max, def_max!
+export large_collapse, large_collapse!, tune_for_size!
 export standardize!, is_standardized, current_word_graph, word_graph
-export current_index_of, word_of, current_word_of
+export current_index_of, batch_index_of, word_of, current_word_of
 export is_non_trivial, tc_redundant_rule
 
 # Kambites
 export Kambites
 export small_overlap_class, current_small_overlap_class, throw_if_not_C4
+export KambitesNormalForms
+
+# Congruence
+export Congruence, CongruenceRace
+export number_of_runners, max_threads, max_threads!, has
+export winner, runner_stats
+export CongruenceJob, BatchResult, run_batch
+export save_checkpoint, load_checkpoint, run_with_checkpoints!
 
 # Transformation types and functions
 export Transf, PPerm, Perm
@@ -385,8 +420,9 @@ export left_one, right_one
 export FroidurePin, current_size, number_of_generators, enumerate!
 export generator, sorted_at
 export sorted_position, to_sorted_position
-export closure!, copy_closure, copy_add_generators, reserve!
+export closure!, copy_closure, copy_add_generators, add_generators!, reserve!
 export batch_size, set_batch_size!
+export save_threads, save_threads!, compact_mode, compact_mode!, memory_usage
 export current_position
 export contains_one, currently_contains_one, is_idempotent
 export prefix, suffix, first_letter, final_letter, fast_product
@@ -395,11 +431,25 @@ export current_number_of_rules, current_max_word_length
 export position_of_generator, current_length, word_length
 export product_by_reduction
 export rules, current_rules, normal_forms, current_normal_forms
-export idempotents, sorted_elements
+export WordChunks, chunk_size, normal_forms_chunks, current_normal_forms_chunks
+export rules_chunks, current_rules_chunks
+export idempotents, sorted_elements, idempotent_positions, sorted_positions
 export minimal_factorisation, current_minimal_factorisation, factorisation
 export right_cayley_graph, current_right_cayley_graph
 export left_cayley_graph, current_left_cayley_graph
+export right_cayley_table, current_right_cayley_table
+export left_cayley_table, current_left_cayley_table
 export to_element, equal_to
+export save_froidure_pin, FrozenFroidurePin
+
+# Packed elements
+export PackedElementVector, batch_multiply!, batch_multiply
+export batch_transpose!, batch_transpose, batch_row_space_basis!, batch_row_space_basis
+export batch_col_space_basis!, batch_col_space_basis, batch_is_regular_element
+export group_by_row_space
+
+# Element tables
+export ElementTable, add_element!, add_elements!, positions, number_of_shards
 
 # BMat8
 export BMat8, to_int, swap!, degree, random, row_space_basis
@@ -0,0 +1,371 @@
+# Copyright (c) 2026, James W. Swent
+#
+# Distributed under the terms of the GPL license version 3.
+
+"""
+async-run.jl - non-blocking runs with progress events
+"""
+
+"""
+    AsyncRun{R}
+
+Handle for a run started with [`run_async!`](@ref Semigroups.run_async!).
+`R` is the type of the object being run.
+
+The handle can be waited on with `wait`, polled with
+[`running`](@ref Semigroups.running(::AsyncRun)), cancelled with
+[`kill!`](@ref Semigroups.kill!(::AsyncRun)), and its progress events read
+from [`progress`](@ref Semigroups.progress).
+"""
+struct AsyncRun{R}
+    runner::R
+    cxx::LibSemigroups.AsyncRun
+    progress::Channel{NamedTuple}
+    task::Task
+end
+
+# The names of the counters sampled for each type, see async-run.cpp.
+_progress_names(::FroidurePin) =
+    (:current_size, :current_number_of_rules, :current_max_word_length)
+_progress_names(::_KnuthBendixAny) = (
+    :number_of_active_rules,
+    :number_of_inactive_rules,
+    :number_of_pending_rules,
+    :total_rules,
+)
+_progress_names(::ToddCoxeter) = (:number_of_nodes, :number_of_edges)
+_progress_names(::Runner) = ()
+
+_algorithm_name(::FroidurePin) = :FroidurePin
+_algorithm_name(::_KnuthBendixAny) = :KnuthBendix
+_algorithm_name(::ToddCoxeter) = :ToddCoxeter
+_algorithm_name(::Kambites) = :Kambites
+_algorithm_name(::Congruence) = :Congruence
+_algorithm_name(::Runner) = :Runner
+
+# Indexed by AsyncRun::phase + 1
+const _ASYNC_RUN_PHASES = (:running, :finished, :killed, :timed_out, :stopped, :failed)
+
+_async_cxx_runner(r::Runner) = r
+_async_cxx_runner(fp::FroidurePin) = fp.cxx_obj
+
+function _forward_progress(ch::Channel{NamedTuple}, cxx, names::Tuple, algorithm, sinks)
+    flat = LibSemigroups.drain!(cxx)
+    width = Int(LibSemigroups.async_run_event_width)
+    for i = 1:width:length(flat)
+        counters = NamedTuple{names}(ntuple(j -> Int(flat[i+2+j]), length(names)))
+        ev = (;
+            elapsed = Nanosecond(flat[i]),
+            cpu_time = Nanosecond(flat[i+1]),
+            phase = _ASYNC_RUN_PHASES[flat[i+2]+1],
+            counters...,
+        )
+        put!(ch, ev)
+        isempty(sinks) && continue
+        rec = ReportRecord(algorithm, ev.phase, counters, ev.elapsed, ev.cpu_time)
+        for sink in sinks
+            try
+                record!(sink, rec)
+            catch err
+                @error "report sink failed" sink exception = (err, catch_backtrace())
+            end
+        end
+    end
+end
+
+"""
+    run_async!(r; interval::TimePeriod = Millisecond(100), timeout = nothing, capacity::Integer = 1024) -> AsyncRun
+
+Start running `r` on a native thread and return an
+[`AsyncRun`](@ref Semigroups.AsyncRun) handle straight away. `r` can be any
+[`Runner`](@ref Semigroups.Runner) (such as a
+[`KnuthBendix`](@ref Semigroups.KnuthBendix) or
+[`ToddCoxeter`](@ref Semigroups.ToddCoxeter)) or a
+[`FroidurePin`](@ref Semigroups.FroidurePin).
+
+Every `interval`, the run records a progress event. This is a `NamedTuple`
+with fields `elapsed::Nanosecond` (wall-clock time since the start),
+`cpu_time::Nanosecond` (CPU time of the thread running `r`) and
+`phase::Symbol`, followed by counters that depend on the type of `r`:
+
+- `FroidurePin`: `current_size`, `current_number_of_rules` and
+  `current_max_word_length`;
+- `KnuthBendix` and `KnuthBendixRewriteFromLeft`: `number_of_active_rules`,
+  `number_of_inactive_rules`, `number_of_pending_rules` and `total_rules`;
+- `ToddCoxeter`: `number_of_nodes` and `number_of_edges` of the current
+  word graph.
+
+The `phase` of every event is `:running`, except the last, which is one of
+`:finished`, `:killed`, `:timed_out`, `:stopped` or `:failed`. Every event
+is also passed to the sinks registered with
+[`add_report_sink!`](@ref Semigroups.add_report_sink!) as a
+[`ReportRecord`](@ref Semigroups.ReportRecord).
+
+Events are sampled by the running algorithm itself, so no Julia code is
+called while it runs. Up to `capacity` events are buffered between
+wake-ups of the Julia task that forwards them; beyond that they are dropped
+(see [`number_of_dropped_events`](@ref Semigroups.number_of_dropped_events)).
+A final event is always recorded when the run stops; it is held apart
+from the buffer and is never dropped.
+
+If `timeout` is a `TimePeriod`, the run stops after that long; it then
+reports [`stopped_by_predicate`](@ref Semigroups.stopped_by_predicate)
+rather than [`timed_out`](@ref Semigroups.timed_out).
+
+!!! warning
+    `r` must not be used in any other way until the run has stopped, for
+    example after `wait` returns.
+
+# Throws
+
+- `ArgumentError` if `interval` or `timeout` is negative, or `capacity` is
+  not positive.
+
+# Example
+
+```julia
+h = run_async!(tc; interval = Second(1))
+for ev in progress(h)
+    println(ev.elapsed, ": ", ev.number_of_nodes, " nodes")
+end
+wait(h)
+```
+"""
+function run_async!(
+    r::Union{Runner,FroidurePin};
+    interval::TimePeriod = Dates.Millisecond(100),
+    timeout::Union{Nothing,TimePeriod} = nothing,
+    capacity::Integer = 1024,
+)
+    interval_ns = Dates.value(convert(Nanosecond, interval))
+    interval_ns >= 0 || throw(ArgumentError("interval must be non-negative, got $interval"))
+    capacity >= 1 || throw(ArgumentError("capacity must be positive, got $capacity"))
+    timeout_ns = _timeout_ns(timeout)
+
+    names = _progress_names(r)
+    algorithm = _algorithm_name(r)
+    sinks = lock(() -> copy(_REPORT_SINKS), _REPORT_SINKS_LOCK)
+    ch = Channel{NamedTuple}(Inf)
+    cond = Base.AsyncCondition()
+    cxx = LibSemigroups.AsyncRun(
+        _async_cxx_runner(r),
+        Int64(interval_ns),
+        timeout_ns,
+        UInt(capacity),
+        cond.handle,
+        cglobal(:uv_async_send),
+    )
+    task = @async GC.@preserve r begin
+        try
+            while true
+                # Check before draining, so the final event is forwarded.
+                finished = LibSemigroups.done(cxx)
+                _forward_progress(ch, cxx, names, algorithm, sinks)
+                finished && break
+                wait(cond)
+            end
+        finally
+            LibSemigroups.join!(cxx)
+            close(cond)
+            close(ch)
+        end
+    end
+    return AsyncRun(r, cxx, ch, task)
+end
+
+"""
+    wait(h::AsyncRun) -> R
+
+Wait, without blocking other Julia tasks, until the run behind `h` has
+stopped, and return the object that was run.
+
+# Throws
+
+- [`LibsemigroupsError`](@ref Semigroups.LibsemigroupsError) if the run
+  threw.
+"""
+function Base.wait(h::AsyncRun)
+    wait(h.task)
+    err = String(LibSemigroups.error(h.cxx))
+    isempty(err) || throw(LibsemigroupsError(Errors.extract_message(err)))
+    return h.runner
+end
+
+"""
+    running(h::AsyncRun) -> Bool
+
+Return `true` if the run behind `h` has not yet stopped.
+"""
+running(h::AsyncRun) = !istaskdone(h.task)
+
+"""
+    kill!(h::AsyncRun) -> AsyncRun
+
+Stop the run behind `h` as soon as possible, using the thread-safe
+[`kill!`](@ref Semigroups.kill!) of the object being run. Returns
+immediately; use `wait` to wait for the run to stop.
+"""
+function kill!(h::AsyncRun)
+    LibSemigroups.kill!(h.cxx)
+    return h
+end
+
+"""
+    progress(h::AsyncRun) -> Channel{NamedTuple}
+
+Return the channel that receives the progress events of `h`; see
+[`run_async!`](@ref Semigroups.run_async!) for their fields. The channel is
+closed once the run has stopped and its final event has been delivered.
+"""
+progress(h::AsyncRun) = h.progress
+
+"""
+    number_of_dropped_events(h::AsyncRun) -> Int
+
+Return the number of progress events of `h` that were dropped because the
+buffer was full.
+"""
+number_of_dropped_events(h::AsyncRun) = Int(LibSemigroups.dropped(h.cxx))
+
+function Base.show(io::IO, h::AsyncRun{R}) where {R}
+    print(io, "<async run of ", R, running(h) ? ", running>" : ", stopped>")
+end
+
+# ============================================================================
+# Structured reporting
+# ============================================================================
+
+"""
+    ReportRecord
+
+A typed progress record passed to report sinks; see
+[`add_report_sink!`](@ref Semigroups.add_report_sink!). The fields are:
+
+- `algorithm::Symbol`: the type of the object being run, for example
+  `:ToddCoxeter`;
+- `phase::Symbol`: `:running` while the run is in progress, and then
+  `:finished`, `:killed`, `:timed_out`, `:stopped` or `:failed` for the last
+  record of a run;
+- `counters::NamedTuple`: the counters sampled for `algorithm`, as listed
+  in [`run_async!`](@ref Semigroups.run_async!);
+- `wall_time::Nanosecond`: wall-clock time since the run started;
+- `cpu_time::Nanosecond`: CPU time used by the thread running the
+  algorithm since the run started (for
+  [`Congruence`](@ref Semigroups.Congruence) this excludes the threads of
+  its race).
+"""
+struct ReportRecord
+    algorithm::Symbol
+    phase::Symbol
+    counters::NamedTuple
+    wall_time::Nanosecond
+    cpu_time::Nanosecond
+end
+
+"""
+    ReportCollector()
+
+A report sink that stores every [`ReportRecord`](@ref Semigroups.ReportRecord)
+it receives in its `records` field, in the order received.
+"""
+struct ReportCollector
+    records::Vector{ReportRecord}
+end
+
+ReportCollector() = ReportCollector(ReportRecord[])
+
+"""
+    record!(sink, rec::ReportRecord)
+
+Deliver `rec` to `sink`. Define a method of this function to use a type of
+your own as a report sink; methods are provided for
+[`ReportCollector`](@ref Semigroups.ReportCollector) and for functions,
+which are called with `rec`.
+
+Records are delivered from a Julia task, never from a native thread, so
+sinks may do anything an ordinary Julia function can. If a sink throws, the
+error is logged and the remaining sinks still receive the record.
+"""
+record!(c::ReportCollector, rec::ReportRecord) = (push!(c.records, rec); c)
+record!(f::Function, rec::ReportRecord) = f(rec)
+
+const _REPORT_SINKS = Any[]
+const _REPORT_SINKS_LOCK = ReentrantLock()
+
+"""
+    add_report_sink!(sink) -> sink
+
+Register `sink` to receive a [`ReportRecord`](@ref Semigroups.ReportRecord)
+for every progress event of every subsequent
+[`run_async!`](@ref Semigroups.run_async!) or
+[`run_reported!`](@ref Semigroups.run_reported!). The sampling interval is
+the `interval` of each run, so sinks never slow down the algorithm's inner
+loops.
+
+Unlike [`ReportGuard`](@ref Semigroups.ReportGuard), which switches
+libsemigroups' own text reporting on stderr on or off, sinks receive
+machine-readable records.
+
+# See also
+
+- [`remove_report_sink!`](@ref Semigroups.remove_report_sink!)
+"""
+function add_report_sink!(sink)
+    lock(_REPORT_SINKS_LOCK) do
+        any(s -> s === sink, _REPORT_SINKS) || push!(_REPORT_SINKS, sink)
+    end
+    return sink
+end
+
+"""
+    remove_report_sink!(sink) -> sink
+
+Stop delivering records to `sink`. Runs that are already in progress keep
+delivering to the sinks registered when they started.
+"""
+function remove_report_sink!(sink)
+    lock(() -> filter!(s -> s !== sink, _REPORT_SINKS), _REPORT_SINKS_LOCK)
+    return sink
+end
+
+"""
+    add_report_sink!(f::Function, sink)
+
+Do-block form: register `sink` for the duration of `f()`, then remove it.
+
+```julia
+c = ReportCollector()
+add_report_sink!(c) do
+    run_reported!(tc; interval = Millisecond(10))
+end
+c.records
+```
+"""
+function add_report_sink!(f::Function, sink)
+    add_report_sink!(sink)
+    try
+        return f()
+    finally
+        remove_report_sink!(sink)
+    end
+end
+
+"""
+    run_reported!(r; interval::TimePeriod = Second(1), timeout = nothing) -> typeof(r)
+
+Run `r` as [`run_async!`](@ref Semigroups.run_async!) does and wait for
+it, so that the registered report sinks receive a record every `interval`.
+Other Julia tasks keep running meanwhile. Returns `r`.
+
+# Throws
+
+- [`LibsemigroupsError`](@ref Semigroups.LibsemigroupsError) if the run
+  threw.
+"""
+function run_reported!(
+    r::Union{Runner,FroidurePin};
+    interval::TimePeriod = Dates.Second(1),
+    timeout::Union{Nothing,TimePeriod} = nothing,
+)
+    return wait(run_async!(r; interval = interval, timeout = timeout))
+end
@@ -0,0 +1,192 @@
+# Copyright (c) 2026, James W. Swent
+#
+# Distributed under the terms of the GPL license version 3.
+
+"""
+batch-run.jl - run many congruence computations on a native thread pool
+"""
+
+# ============================================================================
+# Jobs and results
+# ============================================================================
+
+"""
+    CongruenceJob(::Type{T}, kind::congruence_kind, p::Presentation; timeout = nothing, settings...)
+    CongruenceJob(x::Union{KnuthBendix,KnuthBendixRewriteFromLeft,ToddCoxeter,Congruence}; timeout = nothing)
+
+A single computation of the number of classes of a congruence, to be run by
+[`run_batch`](@ref Semigroups.run_batch).
+
+The first form constructs `T(kind, p)`, where `T` is one of
+[`KnuthBendix`](@ref Semigroups.KnuthBendix),
+[`KnuthBendixRewriteFromLeft`](@ref Semigroups.KnuthBendixRewriteFromLeft),
+[`ToddCoxeter`](@ref Semigroups.ToddCoxeter) or
+[`Congruence`](@ref Semigroups.Congruence), and then applies every keyword
+in `settings` by calling the setter of the same name followed by `!`; for
+example `strategy = strategy_felsch` calls
+[`strategy!`](@ref Semigroups.strategy!). The second form uses an object
+that has already been configured. In both cases the job runs on a copy, so
+later changes to the object do not affect it.
+
+If `timeout` is a `TimePeriod`, the job is run with
+[`run_for!`](@ref Semigroups.run_for!) rather than to completion.
+
+# Throws
+
+- `ArgumentError` if a keyword in `settings` does not name a setter.
+- [`LibsemigroupsError`](@ref Semigroups.LibsemigroupsError) if `p` is not
+  valid, or a setting is rejected.
+"""
+struct CongruenceJob
+    runner::Union{_KnuthBendixAny,ToddCoxeter,Congruence}
+    timeout::Union{Nothing,TimePeriod}
+end
+
+function CongruenceJob(
+    x::Union{_KnuthBendixAny,ToddCoxeter,Congruence};
+    timeout::Union{Nothing,TimePeriod} = nothing,
+)
+    return CongruenceJob(x, timeout)
+end
+
+function CongruenceJob(
+    ::Type{T},
+    kind::congruence_kind,
+    p::Presentation;
+    timeout::Union{Nothing,TimePeriod} = nothing,
+    settings...,
+) where {T<:Union{_KnuthBendixAny,ToddCoxeter,Congruence}}
+    x = T(kind, p)
+    for (name, val) in settings
+        setter = Symbol(name, "!")
+        isdefined(Semigroups, setter) ||
+            throw(ArgumentError("unknown setting $name, there is no function $setter"))
+        getfield(Semigroups, setter)(x, val)
+    end
+    return CongruenceJob(x, timeout)
+end
+
+"""
+    BatchResult
+
+The outcome of one [`CongruenceJob`](@ref Semigroups.CongruenceJob), as
+produced by [`run_batch`](@ref Semigroups.run_batch). The fields are:
+
+- `index::Int`: the position of the job in the vector passed to
+  `run_batch`;
+- `finished::Bool`: whether the job ran to completion;
+- `number_of_classes::Union{UInt64,Nothing}`: the number of classes, or
+  `nothing` if the job did not finish;
+- `elapsed::Nanosecond`: the time the job spent running;
+- `why_stopped::String`: the value of
+  [`string_why_we_stopped`](@ref Semigroups.string_why_we_stopped) when the
+  job stopped;
+- `error::Union{String,Nothing}`: the message of the exception thrown by the
+  job, if any.
+"""
+struct BatchResult
+    index::Int
+    finished::Bool
+    number_of_classes::Union{UInt64,Nothing}
+    elapsed::Nanosecond
+    why_stopped::String
+    error::Union{String,Nothing}
+end
+
+function _batch_result(pool, i::UInt)
+    finished = LibSemigroups.result_finished(pool, i)
+    err = String(LibSemigroups.result_error(pool, i))
+    return BatchResult(
+        Int(i) + 1,
+        finished,
+        finished ? LibSemigroups.result_number_of_classes(pool, i) : nothing,
+        Nanosecond(LibSemigroups.result_elapsed(pool, i)),
+        String(LibSemigroups.result_why_stopped(pool, i)),
+        isempty(err) ? nothing : Errors.extract_message(err),
+    )
+end
+
+_timeout_ns(::Nothing) = Int64(-1)
+
+function _timeout_ns(t::TimePeriod)
+    ns = Dates.value(convert(Nanosecond, t))
+    ns >= 0 || throw(ArgumentError("timeout must be non-negative, got $t"))
+    return Int64(ns)
+end
+
+# ============================================================================
+# Running batches
+# ============================================================================
+
+"""
+    run_batch(jobs::AbstractVector{CongruenceJob}; nthreads::Integer = Sys.CPU_THREADS) -> Channel{BatchResult}
+
+Run every job in `jobs` on a pool of `nthreads` native threads and return a
+`Channel` that receives a [`BatchResult`](@ref Semigroups.BatchResult) as
+each job finishes.
+
+The jobs run outside Julia, so the calling task returns straight away and
+other tasks keep running while the batch is in progress. Results arrive in
+the order the jobs finish; use their `index` field to match them to `jobs`.
+The channel is closed once every result has been delivered, so
+`sort!(collect(run_batch(jobs)); by = r -> r.index)` gives the complete
+results table.
+
+Closing the channel early cancels the jobs that have not yet finished.
+
+# Throws
+
+- `ArgumentError` if `nthreads` is not positive.
+
+# Example
+
+```julia
+jobs = [CongruenceJob(ToddCoxeter, twosided, plactic_monoid(n);
+                      timeout = Second(10)) for n in 2:5]
+for r in run_batch(jobs; nthreads = 4)
+    println(r.index, " => ", r.number_of_classes)
+end
+```
+"""
+function run_batch(jobs::AbstractVector{CongruenceJob}; nthreads::Integer = Sys.CPU_THREADS)
+    nthreads >= 1 || throw(ArgumentError("nthreads must be positive, got $nthreads"))
+    n = length(jobs)
+    ch = Channel{BatchResult}(n)
+    if n == 0
+        close(ch)
+        return ch
+    end
+
+    pool = LibSemigroups.BatchRun()
+    for job in jobs
+        @wrap_libsemigroups_call LibSemigroups.add_job!(
+            pool,
+            job.runner,
+            _timeout_ns(job.timeout),
+        )
+    end
+
+    cond = Base.AsyncCondition()
+    LibSemigroups.start!(pool, UInt(nthreads), cond.handle, cglobal(:uv_async_send))
+
+    task = @async begin
+        received = 0
+        try
+            while received < n
+                i = LibSemigroups.pop_finished!(pool)
+                if i == typemax(UInt)
+                    wait(cond)
+                else
+                    put!(ch, _batch_result(pool, i))
+                    received += 1
+                end
+            end
+        finally
+            received < n && LibSemigroups.cancel!(pool)
+            LibSemigroups.join!(pool)
+            close(cond)
+        end
+    end
+    bind(ch, task)
+    return ch
+end
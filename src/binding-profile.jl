@@ -0,0 +1,137 @@
+# Copyright (c) 2026, James W. Swent
+#
+# Distributed under the terms of the GPL license version 3.
+#
+# The full license is in the file LICENSE, distributed with this software.
+
+"""
+binding-profile.jl - call counts and costs of the C++ bindings
+
+In an instrumented build of the C++ library, the bound methods of the common
+congruence helpers and of `FroidurePin` count their calls, the bytes they
+copy between Julia and libsemigroups, and the time spent in them, so that
+the cost of crossing the boundary can be told from that of libsemigroups.
+This file reads those counters; see `deps/src/binding-profile.hpp`.
+"""
+
+"""
+    BindingProfileEntry
+
+The counters of one bound method in a [`BindingProfile`](@ref
+Semigroups.BindingProfile), with fields:
+
+- `method::String`: the name of the bound method, followed by the type it
+  was bound for in brackets, such as `"cong_common_reduce(ToddCoxeterWord)"`;
+- `calls::Int`: the number of calls;
+- `bytes_copied::Int`: the number of bytes of words and elements copied
+  into libsemigroups from Julia buffers, and of values returned by copy;
+- `time::Nanosecond`: the total time spent in the calls, including
+  libsemigroups itself but not the conversion of the arguments and result.
+"""
+struct BindingProfileEntry
+    method::String
+    calls::Int
+    bytes_copied::Int
+    time::Nanosecond
+end
+
+"""
+    BindingProfile <: AbstractVector{BindingProfileEntry}
+
+The [`BindingProfileEntry`](@ref Semigroups.BindingProfileEntry) of every
+profiled bound method called since the counters were last reset, most
+time first, as returned by [`binding_profile`](@ref
+Semigroups.binding_profile).
+"""
+struct BindingProfile <: AbstractVector{BindingProfileEntry}
+    entries::Vector{BindingProfileEntry}
+end
+
+Base.size(p::BindingProfile) = size(p.entries)
+Base.getindex(p::BindingProfile, i::Int) = p.entries[i]
+
+"""
+    binding_profile_enabled() -> Bool
+
+Check whether the C++ library was built with instrumentation, so that
+[`binding_profile`](@ref Semigroups.binding_profile) counts anything.
+"""
+binding_profile_enabled() = LibSemigroups.binding_profile_enabled()
+
+"""
+    binding_profile() -> BindingProfile
+
+Return the calls, bytes copied and time of every profiled bound method
+called since the counters were last reset by [`reset_binding_profile!`](@ref
+Semigroups.reset_binding_profile!), most time first.
+
+The counters are only kept by an instrumented build of the C++ library,
+which is built from source and used whenever Semigroups.jl is loaded with
+the environment variable `SEMIGROUPS_PROFILE_BINDINGS` set to `1` (`make
+build-profile` builds it ahead of time); otherwise the profile is always
+empty. See [`binding_profile_enabled`](@ref
+Semigroups.binding_profile_enabled).
+
+The profiled methods are those of the common congruence helpers (for all
+congruence types) and of `FroidurePin` and `FrozenFroidurePin`, which
+include both the one-word or one-element methods and their batched
+counterparts, so the two can be compared on a given workload.
+
+# Example
+```julia
+reset_binding_profile!()
+tc = ToddCoxeter(twosided, p)
+batch_reduce(tc, words)
+binding_profile()   # cong_common_reduce_batch(ToddCoxeterWord) ...
+```
+"""
+function binding_profile()
+    counters = Vector{UInt64}(undef, 3)
+    entries = BindingProfileEntry[]
+    for i = 1:Int(LibSemigroups.binding_profile_size())
+        LibSemigroups.binding_profile_counters!(UInt(i - 1), counters)
+        counters[1] == 0 && continue
+        method = String(LibSemigroups.binding_profile_name(UInt(i - 1)))
+        push!(
+            entries,
+            BindingProfileEntry(
+                method,
+                Int(counters[1]),
+                Int(counters[2]),
+                Nanosecond(counters[3]),
+            ),
+        )
+    end
+    sort!(entries; by = e -> e.time, rev = true)
+    return BindingProfile(entries)
+end
+
+"""
+    reset_binding_profile!() -> Nothing
+
+Set the counters of every profiled bound method to zero.
+"""
+function reset_binding_profile!()
+    LibSemigroups.binding_profile_reset!()
+    return nothing
+end
+
+function Base.show(io::IO, ::MIME"text/plain", p::BindingProfile)
+    if isempty(p)
+        print(io, "BindingProfile with no calls")
+        binding_profile_enabled() ||
+            print(io, " (set SEMIGROUPS_PROFILE_BINDINGS=1 to instrument the bindings)")
+        return
+    end
+    println(io, "BindingProfile with $(length(p)) methods:")
+    width = maximum(e -> length(e.method), p)
+    print(io, "  ", rpad("method", width), lpad("calls", 12))
+    print(io, lpad("bytes copied", 16), lpad("time (ms)", 14), lpad("ns/call", 12))
+    for e in p
+        ns = Dates.value(e.time)
+        println(io)
+        print(io, "  ", rpad(e.method, width), lpad(e.calls, 12))
+        print(io, lpad(e.bytes_copied, 16), lpad(round(ns / 1e6; digits = 3), 14))
+        print(io, lpad(round(Int, ns / e.calls), 12))
+    end
+end
@@ -0,0 +1,139 @@
+# Copyright (c) 2026, James W. Swent
+#
+# Distributed under the terms of the GPL license version 3.
+
+"""
+checkpoint.jl - save and resume ToddCoxeter and KnuthBendix runs
+"""
+
+"""
+    save_checkpoint(tc::ToddCoxeter, path::AbstractString) -> String
+    save_checkpoint(kb::Union{KnuthBendix,KnuthBendixRewriteFromLeft}, path::AbstractString) -> String
+
+Write the current state of `tc` or `kb` to the binary checkpoint file
+`path`, and return `path`. The object can be running with
+[`run_for!`](@ref Semigroups.run_for!) in between checkpoints, see
+[`run_with_checkpoints!`](@ref Semigroups.run_with_checkpoints!).
+
+A `ToddCoxeter` checkpoint contains the part of the current word graph
+reachable from node `1`, the relations and generating pairs, whether the
+presentation contains the empty word, and the settings
+[`strategy`](@ref Semigroups.strategy),
+[`lookahead_extent`](@ref Semigroups.lookahead_extent),
+[`lookahead_style`](@ref Semigroups.lookahead_style),
+[`lookahead_next`](@ref Semigroups.lookahead_next),
+[`lookahead_min`](@ref Semigroups.lookahead_min),
+[`lookahead_growth_factor`](@ref Semigroups.lookahead_growth_factor),
+[`lookahead_growth_threshold`](@ref Semigroups.lookahead_growth_threshold),
+[`hlt_defs`](@ref Semigroups.hlt_defs), [`f_defs`](@ref Semigroups.f_defs),
+[`def_max`](@ref Semigroups.def_max),
+[`def_version`](@ref Semigroups.def_version),
+[`def_policy`](@ref Semigroups.def_policy),
+[`large_collapse`](@ref Semigroups.large_collapse),
+[`save`](@ref Semigroups.save),
+[`use_relations_in_extra`](@ref Semigroups.use_relations_in_extra) and
+[`lower_bound`](@ref Semigroups.lower_bound), so that a run tuned with
+[`tune_for_size!`](@ref Semigroups.tune_for_size!) resumes tuned.
+
+A `KnuthBendix` checkpoint, with either rewriter, contains the active
+rules, the original rules and generating pairs, and the settings
+[`max_pending_rules`](@ref Semigroups.max_pending_rules),
+[`check_confluence_interval`](@ref Semigroups.check_confluence_interval),
+[`max_overlap`](@ref Semigroups.max_overlap),
+[`max_rules`](@ref Semigroups.max_rules) and
+[`overlap_policy`](@ref Semigroups.overlap_policy); pending rules are not
+accessible in libsemigroups, and are recovered on resumption by reducing
+the original rules again.
+
+The file is written next to `path` and then renamed over it, so a process
+that dies while checkpointing leaves the previous checkpoint intact.
+
+# Throws
+
+- [`LibsemigroupsError`](@ref Semigroups.LibsemigroupsError) if the
+  congruence is not [`twosided`](@ref Semigroups.twosided), or the file
+  cannot be written.
+
+# See also
+
+- [`load_checkpoint`](@ref Semigroups.load_checkpoint)
+"""
+function save_checkpoint(tc::ToddCoxeter, path::AbstractString)
+    @wrap_libsemigroups_call LibSemigroups.save_checkpoint(tc, String(path))
+    return String(path)
+end
+
+function save_checkpoint(kb::_KnuthBendixAny, path::AbstractString)
+    @wrap_libsemigroups_call LibSemigroups.save_checkpoint(kb, String(path))
+    return String(path)
+end
+
+"""
+    load_checkpoint(path::AbstractString) -> Union{ToddCoxeter,KnuthBendix,KnuthBendixRewriteFromLeft}
+
+Return a new [`ToddCoxeter`](@ref Semigroups.ToddCoxeter) or
+[`KnuthBendix`](@ref Semigroups.KnuthBendix) (or
+[`KnuthBendixRewriteFromLeft`](@ref Semigroups.KnuthBendixRewriteFromLeft),
+whichever was saved) that continues from the checkpoint `path` written by
+[`save_checkpoint`](@ref Semigroups.save_checkpoint) when it is run.
+
+The file is memory-mapped and its word graph or rules are copied directly
+into the new object, without parsing.
+
+!!! note
+    A resumed `ToddCoxeter` is constructed from the saved presentation,
+    including whether it contains the empty word, with the saved word graph
+    attached and the saved generating pairs as rules of the presentation;
+    its letters are the indices `1:n` of the original alphabet. A resumed
+    `KnuthBendix` has a presentation containing the saved active rules as
+    well as the original rules.
+
+# Throws
+
+- [`LibsemigroupsError`](@ref Semigroups.LibsemigroupsError) if `path`
+  cannot be read, is not a checkpoint, was written by an unsupported
+  version, or is corrupt.
+"""
+function load_checkpoint(path::AbstractString)
+    p = String(path)
+    algorithm = @wrap_libsemigroups_call LibSemigroups.checkpoint_algorithm(p)
+    if algorithm == 1
+        return @wrap_libsemigroups_call LibSemigroups.load_todd_coxeter_checkpoint(p)
+    elseif algorithm == 3
+        return @wrap_libsemigroups_call LibSemigroups.load_knuth_bendix_from_left_checkpoint(
+            p,
+        )
+    end
+    return @wrap_libsemigroups_call LibSemigroups.load_knuth_bendix_checkpoint(p)
+end
+
+"""
+    run_with_checkpoints!(x::Union{ToddCoxeter,KnuthBendix,KnuthBendixRewriteFromLeft}, path::AbstractString; every::TimePeriod) -> typeof(x)
+
+Run `x` to completion, writing a checkpoint to `path` after every `every` of
+running and once more at the end. Returns `x`.
+
+If the process is lost, `run_with_checkpoints!(load_checkpoint(path), path;
+every)` continues from the last checkpoint. Running stops early, after a
+final checkpoint, if `x` is killed with [`kill!`](@ref Semigroups.kill!).
+
+# Throws
+
+- `ArgumentError` if `every` is not positive.
+- [`LibsemigroupsError`](@ref Semigroups.LibsemigroupsError) as
+  [`save_checkpoint`](@ref Semigroups.save_checkpoint) does.
+"""
+function run_with_checkpoints!(
+    x::Union{ToddCoxeter,_KnuthBendixAny},
+    path::AbstractString;
+    every::TimePeriod,
+)
+    Dates.value(convert(Nanosecond, every)) > 0 ||
+        throw(ArgumentError("every must be positive, got $every"))
+    while true
+        run_for!(x, every)
+        save_checkpoint(x, path)
+        (finished(x) || dead(x)) && break
+    end
+    return x
+end
@@ -231,8 +231,175 @@ function reduce(cong::CongruenceCommon, w::AbstractVector{<:Integer})
     return _word_from_cpp(result)
 end
 
+# ============================================================================
+# Batched queries
+# ============================================================================
+
+# The copies of a congruence kept between batches split across threads by
+# copying (see QueryCopies in cong-common.hpp), held for as long as the
+# congruence they were made from. Only types that opt in with
+# `_query_copies_args` have them, and only objects owned by Julia, since a
+# borrowed reference cannot be a weak key.
+const _QUERY_COPIES = WeakKeyDict{Any,Any}()
+
+function _query_copies(cong::CongruenceCommon)
+    return get!(() -> LibSemigroups.cong_common_query_copies(cong), _QUERY_COPIES, cong)
+end
+
+_query_copies_args(::CongruenceCommon) = ()
+_query_copies_args_by_copy(cong) = ismutable(cong) ? (_query_copies(cong),) : ()
+
+"""
+    number_of_query_copies(cong::CongruenceCommon) -> Int
+
+Return the number of copies of `cong` kept for batched queries.
+
+A [`Kambites`](@ref Semigroups.Kambites) or
+[`KnuthBendix`](@ref Semigroups.KnuthBendix) writes to scratch space of its
+own while answering a query, so [`batch_reduce`](@ref
+Semigroups.batch_reduce(::CongruenceCommon, ::AbstractVector{<:AbstractVector{<:Integer}}))
+and [`batch_contains`](@ref Semigroups.batch_contains) give every thread
+but one its own copy of `cong`. The copies are kept from one batch to the
+next, and only remade if the presentation or generating pairs of `cong`
+change, so batches on at most `n` threads copy `cong` at most `n - 1`
+times while it is unchanged. Each copy uses as much memory as `cong`, and
+they are freed with `cong` or by [`free_query_copies!`](@ref
+Semigroups.free_query_copies!).
+
+Always `0` for other algorithms, which either share `cong` between threads
+or answer batches on one thread.
+"""
+function number_of_query_copies(cong::CongruenceCommon)
+    args = _query_copies_args(cong)
+    isempty(args) && return 0
+    return Int(LibSemigroups.size(only(args)))
+end
+
+"""
+    free_query_copies!(cong::CongruenceCommon) -> CongruenceCommon
+
+Free the copies of `cong` kept for batched queries (see
+[`number_of_query_copies`](@ref Semigroups.number_of_query_copies)). The
+next batch on several threads makes them again.
+"""
+function free_query_copies!(cong::CongruenceCommon)
+    copies = ismutable(cong) ? get(_QUERY_COPIES, cong, nothing) : nothing
+    copies === nothing || LibSemigroups.clear!(copies)
+    return cong
+end
+
+"""
+    batch_reduce(cong::CongruenceCommon, words::AbstractVector{<:AbstractVector{<:Integer}}; nthreads::Integer = 1) -> PackedWordVector
+
+Reduce every word in `words` to a normal form under `cong`.
+
+This is equivalent to `[Semigroups.reduce(cong, w) for w in words]`, but
+makes a single call across the C++ boundary: the words are packed into one
+buffer, `cong` is run to completion once, and every word is then reduced
+against the finished state without further checks. The result is a
+[`PackedWordVector`](@ref Semigroups.PackedWordVector) in the same order as
+`words`. Passing a `PackedWordVector` as `words` avoids repacking it.
+
+# Arguments
+
+- `cong::CongruenceCommon`: the congruence to reduce in.
+- `words::AbstractVector{<:AbstractVector{<:Integer}}`: the words, each a
+  1-based `Vector{Int}` of letter indices.
+- `nthreads::Integer`: the maximum number of threads used to answer the
+  queries once `cong` is finished.
+
+!!! note
+    `nthreads` is honoured for [`ToddCoxeter`](@ref Semigroups.ToddCoxeter),
+    which is read-only once finished, and for
+    [`KnuthBendix`](@ref Semigroups.KnuthBendix),
+    `KnuthBendixRewriteFromLeft` and [`Kambites`](@ref Semigroups.Kambites),
+    which answer queries using scratch space of their own, so every thread
+    but one queries its own copy, used only for batches of at least 64
+    words per thread and kept for later batches (see
+    [`number_of_query_copies`](@ref Semigroups.number_of_query_copies)).
+    Every other algorithm answers the batch on one thread.
+
+# Throws
+
+- `LibsemigroupsError` if any letter of any word is not in the alphabet of
+  the underlying presentation.
+- `InexactError` if any letter is zero or negative.
+
+!!! warning
+    This function triggers a full enumeration of `cong`, which may never
+    terminate.
+
+# See also
+
+[`reduce`](@ref Semigroups.reduce(::CongruenceCommon, ::AbstractVector{<:Integer})),
+[`batch_contains`](@ref Semigroups.batch_contains)
+"""
+function batch_reduce(
+    cong::CongruenceCommon,
+    words::AbstractVector{<:AbstractVector{<:Integer}};
+    nthreads::Integer = 1,
+)
+    letters, offsets = _pack_words(words)
+    result = @wrap_libsemigroups_call LibSemigroups.cong_common_reduce_batch(
+        cong,
+        _query_copies_args(cong)...,
+        letters,
+        offsets,
+        UInt(nthreads),
+    )
+    return _packed_words(result)
+end
+
+"""
+    batch_contains(cong::CongruenceCommon, us::AbstractVector{<:AbstractVector{<:Integer}}, vs::AbstractVector{<:AbstractVector{<:Integer}}; nthreads::Integer = 1) -> Vector{Bool}
+
+Check, for every `i`, whether `us[i]` and `vs[i]` are equivalent under
+`cong`.
+
+This is equivalent to `[contains(cong, u, v) for (u, v) in zip(us, vs)]`,
+but makes a single call across the C++ boundary, running `cong` to
+completion once. See [`batch_reduce`](@ref Semigroups.batch_reduce) for
+the meaning of `nthreads`.
+
+# Throws
+
+- `LibsemigroupsError` if `us` and `vs` have different lengths, or if any
+  letter of any word is not in the alphabet of the underlying
+  presentation.
+- `InexactError` if any letter is zero or negative.
+
+!!! warning
+    This function triggers a full enumeration of `cong`, which may never
+    terminate.
+
+# See also
+
+[`contains`](@ref Semigroups.contains(::CongruenceCommon, ::AbstractVector{<:Integer}, ::AbstractVector{<:Integer}))
 """
-    normal_forms(cong::CongruenceCommon) -> Vector{Vector{Int}}
+function batch_contains(
+    cong::CongruenceCommon,
+    us::AbstractVector{<:AbstractVector{<:Integer}},
+    vs::AbstractVector{<:AbstractVector{<:Integer}};
+    nthreads::Integer = 1,
+)
+    u_letters, u_offsets = _pack_words(us)
+    v_letters, v_offsets = _pack_words(vs)
+    out = Vector{UInt8}(undef, length(us))
+    @wrap_libsemigroups_call LibSemigroups.cong_common_contains_batch!(
+        cong,
+        _query_copies_args(cong)...,
+        u_letters,
+        u_offsets,
+        v_letters,
+        v_offsets,
+        out,
+        UInt(nthreads),
+    )
+    return Bool[x != 0 for x in out]
+end
+
+"""
+    normal_forms(cong::CongruenceCommon) -> PackedWordVector
 
 Return the normal forms of every congruence class of `cong`.
 
@@ -242,7 +409,8 @@ a full enumeration of `cong`.
 
 # Returns
 
-A `Vector` of 1-based `Vector{Int}` words, one per congruence class.
+A [`PackedWordVector`](@ref Semigroups.PackedWordVector) of 1-based
+`Vector{Int}` words, one per congruence class.
 
 !!! warning
     The Knuth-Bendix algorithm (and several other congruence algorithms)
@@ -256,11 +424,11 @@ A `Vector` of 1-based `Vector{Int}` words, one per congruence class.
 """
 function normal_forms(cong::CongruenceCommon)
     nf = @wrap_libsemigroups_call LibSemigroups.cong_common_normal_forms(cong)
-    return [_word_from_cpp(w) for w in nf]
+    return _packed_words(nf)
 end
 
 """
-    partition(cong::CongruenceCommon, words::AbstractVector{<:AbstractVector{<:Integer}}) -> Vector{Vector{Vector{Int}}}
+    partition(cong::CongruenceCommon, words::AbstractVector{<:AbstractVector{<:Integer}}) -> Vector{PackedWordVector}
 
 Partition `words` into congruence classes induced by `cong`.
 
@@ -276,8 +444,9 @@ same congruence class. This function triggers a full enumeration of
 
 # Returns
 
-A `Vector` of classes; each class is a `Vector` of 1-based `Vector{Int}`
-words.
+A `Vector` of classes; each class is a
+[`PackedWordVector`](@ref Semigroups.PackedWordVector) of 1-based
+`Vector{Int}` words.
 
 # Throws
 
@@ -297,11 +466,11 @@ function partition(
         cong,
         _words_to_cpp(words),
     )
-    return [[_word_from_cpp(word) for word in cls] for cls in classes]
+    return _packed_groups(classes)
 end
 
 """
-    non_trivial_classes(cong1::CongruenceCommon, cong2::CongruenceCommon) -> Vector{Vector{Vector{Int}}}
+    non_trivial_classes(cong1::CongruenceCommon, cong2::CongruenceCommon) -> Vector{PackedWordVector}
 
 Return the classes of size at least 2 in the partition of the normal
 forms of `cong2` induced by `cong1`.
@@ -323,7 +492,8 @@ classes.
 
 # Returns
 
-A `Vector` of non-trivial classes; each class is a `Vector` of 1-based
+A `Vector` of non-trivial classes; each class is a
+[`PackedWordVector`](@ref Semigroups.PackedWordVector) of 1-based
 `Vector{Int}` words.
 
 # Throws
@@ -348,5 +518,5 @@ A `Vector` of non-trivial classes; each class is a `Vector` of 1-based
 function non_trivial_classes(cong1::CongruenceCommon, cong2::CongruenceCommon)
     classes =
         @wrap_libsemigroups_call LibSemigroups.cong_common_non_trivial_classes(cong1, cong2)
-    return [[_word_from_cpp(w) for w in cls] for cls in classes]
+    return _packed_groups(classes)
 end
@@ -0,0 +1,400 @@
+# Copyright (c) 2026, James W. Swent
+#
+# Distributed under the terms of the GPL license version 3.
+
+"""
+congruence.jl - Congruence and CongruenceRace wrappers (Layer 2 + 3)
+"""
+
+# ============================================================================
+# Type alias
+# ============================================================================
+
+"""
+    Congruence
+
+Type that runs a race between [`KnuthBendix`](@ref Semigroups.KnuthBendix),
+[`ToddCoxeter`](@ref Semigroups.ToddCoxeter) and
+[`Kambites`](@ref Semigroups.Kambites) to compute a congruence defined by a
+[`Presentation`](@ref Semigroups.Presentation).
+
+The first algorithm to finish is the winner; the others are killed and
+discarded, so once `c` has [`finished`](@ref Semigroups.finished) exactly
+one runner remains, and [`has`](@ref Semigroups.has) reports which algorithm
+it is. Use [`max_threads!`](@ref Semigroups.max_threads!) to choose how many
+of the runners race concurrently. To race differently configured
+competitors, or to see how every competitor fared, use
+[`CongruenceRace`](@ref Semigroups.CongruenceRace) instead.
+
+`Congruence` is a subtype of
+[`CongruenceCommon`](@ref Semigroups.CongruenceCommon) (and hence of
+[`Runner`](@ref Semigroups.Runner)).
+
+# Constructors
+
+    Congruence() -> Congruence
+    Congruence(kind::congruence_kind, p::Presentation) -> Congruence
+    Congruence(c::Congruence) -> Congruence
+"""
+const Congruence = LibSemigroups.CongruenceWord
+
+# ============================================================================
+# Initialization
+# ============================================================================
+
+"""
+    Congruence(kind::congruence_kind, p::Presentation) -> Congruence
+
+Construct a [`Congruence`](@ref Semigroups.Congruence) of kind `kind` over
+the semigroup or monoid defined by `p`.
+
+This Julia wrapper builds a default `Congruence` and then calls
+[`init!`](@ref Semigroups.init!) so that exceptions raised by libsemigroups
+surface as [`LibsemigroupsError`](@ref Semigroups.LibsemigroupsError).
+
+# Throws
+
+- [`LibsemigroupsError`](@ref Semigroups.LibsemigroupsError) if `p` is not
+  valid.
+"""
+function Congruence(kind::congruence_kind, p::Presentation)
+    c = LibSemigroups.CongruenceWord()
+    init!(c, kind, p)
+    return c
+end
+
+"""
+    init!(c::Congruence) -> Congruence
+    init!(c::Congruence, kind::congruence_kind, p::Presentation) -> Congruence
+
+Re-initialize `c` so that it is in the state it would have been in
+immediately after the corresponding constructor. Returns `c` for chaining.
+
+# Throws
+
+- [`LibsemigroupsError`](@ref Semigroups.LibsemigroupsError) if `p` is not
+  valid (three-argument form only).
+"""
+function init!(c::Congruence)
+    @wrap_libsemigroups_call LibSemigroups.init!(c)
+    return c
+end
+
+function init!(c::Congruence, kind::congruence_kind, p::Presentation)
+    @wrap_libsemigroups_call LibSemigroups.init!(c, kind, p)
+    return c
+end
+
+# ============================================================================
+# Accessors
+# ============================================================================
+
+"""
+    kind(c::Congruence) -> congruence_kind
+
+Return the kind of congruence (one- or two-sided) represented by `c`.
+"""
+kind(c::Congruence) = LibSemigroups.kind(c)
+
+"""
+    number_of_classes(c::Congruence) -> UInt64
+
+Compute the number of congruence classes of `c`, running the race if
+necessary. Infinitely many classes are reported as
+[`POSITIVE_INFINITY`](@ref Semigroups.POSITIVE_INFINITY).
+"""
+number_of_classes(c::Congruence) = @wrap_libsemigroups_call LibSemigroups.number_of_classes(c)
+
+# ============================================================================
+# Race control
+# ============================================================================
+
+"""
+    number_of_runners(c::Congruence) -> Int
+
+Return the number of algorithms still in the race in `c`. After `c` has
+finished this is `1`, since the losing runners are discarded.
+"""
+number_of_runners(c::Congruence) = Int(LibSemigroups.number_of_runners(c))
+
+"""
+    max_threads(c::Congruence) -> Int
+
+Return the maximum number of threads used to run the race in `c`. The
+default is `1`, in which case the runners are tried one after another.
+
+# See also
+
+- [`max_threads!`](@ref Semigroups.max_threads!)
+"""
+max_threads(c::Congruence) = Int(LibSemigroups.max_threads(c))
+
+"""
+    max_threads!(c::Congruence, n::Integer) -> Congruence
+
+Set the maximum number of threads used to run the race in `c` to `n`. Each
+thread runs one algorithm; the first to finish wins and the others are
+killed, so CPU time spent by the losers grows with `n`.
+
+# Throws
+
+- `ArgumentError` if `n` is negative.
+- [`LibsemigroupsError`](@ref Semigroups.LibsemigroupsError) if
+  libsemigroups rejects `n`.
+"""
+function max_threads!(c::Congruence, n::Integer)
+    n >= 0 || throw(ArgumentError("the number of threads must be non-negative, found $n"))
+    @wrap_libsemigroups_call LibSemigroups.max_threads!(c, UInt(n))
+    return c
+end
+
+"""
+    has(c::Congruence, ::Type{T}) -> Bool
+
+Return `true` if `c` contains a runner of type `T`, which must be one of
+[`KnuthBendix`](@ref Semigroups.KnuthBendix),
+[`ToddCoxeter`](@ref Semigroups.ToddCoxeter) or
+[`Kambites`](@ref Semigroups.Kambites).
+
+Once `c` has finished only the winner remains, so this identifies the
+algorithm that won the race.
+"""
+has(c::Congruence, ::Type{KnuthBendix}) = LibSemigroups.cong_has_knuth_bendix(c)
+has(c::Congruence, ::Type{ToddCoxeter}) = LibSemigroups.cong_has_todd_coxeter(c)
+has(c::Congruence, ::Type{Kambites}) = LibSemigroups.cong_has_kambites(c)
+
+"""
+    Base.get(c::Congruence, ::Type{T}) -> T
+
+Return a copy of the first runner of type `T` in `c`; see
+[`has`](@ref Semigroups.has).
+
+# Throws
+
+- `ArgumentError` if `c` has no runner of type `T`.
+"""
+function Base.get(c::Congruence, ::Type{T}) where {T<:Union{KnuthBendix,ToddCoxeter,Kambites}}
+    has(c, T) || throw(ArgumentError("the Congruence has no runner of type $T"))
+    T === KnuthBendix && return LibSemigroups.cong_get_knuth_bendix(c)
+    T === ToddCoxeter && return LibSemigroups.cong_get_todd_coxeter(c)
+    return LibSemigroups.cong_get_kambites(c)
+end
+
+# ============================================================================
+# Display and copying
+# ============================================================================
+
+function Base.show(io::IO, c::Congruence)
+    print(io, LibSemigroups.to_human_readable_repr(c))
+end
+
+Base.copy(c::Congruence) = LibSemigroups.CongruenceWord(c)
+
+Base.deepcopy_internal(c::Congruence, ::IdDict) = LibSemigroups.CongruenceWord(c)
+
+# ============================================================================
+# CongruenceRace
+# ============================================================================
+
+"""
+    CongruenceRace
+
+A race between separately configured [`KnuthBendix`](@ref Semigroups.KnuthBendix),
+[`KnuthBendixRewriteFromLeft`](@ref Semigroups.KnuthBendixRewriteFromLeft),
+[`ToddCoxeter`](@ref Semigroups.ToddCoxeter) and
+[`Kambites`](@ref Semigroups.Kambites) instances that records how every
+competitor fared.
+
+Unlike [`Congruence`](@ref Semigroups.Congruence), whose competitors are
+fixed and whose losers are discarded, any number of competitors can be
+added with `push!` (for example several `ToddCoxeter` instances using
+different strategies, or `KnuthBendix` instances with different overlap
+policies, or rewriters), and after [`run!`](@ref Semigroups.run!) every competitor's
+elapsed time and size can be read with
+[`runner_stats`](@ref Semigroups.runner_stats).
+
+The first [`max_threads`](@ref Semigroups.max_threads) competitors race,
+each on its own thread; the first to finish is the
+[`winner`](@ref Semigroups.winner) and the others are killed. A race can
+only be run once.
+
+# Example
+
+```julia
+race = CongruenceRace()
+for s in (strategy_hlt, strategy_felsch)
+    tc = ToddCoxeter(twosided, p)
+    strategy!(tc, s)
+    push!(race, tc)
+end
+push!(race, KnuthBendix(twosided, p))
+max_threads!(race, 3)
+run!(race)
+winner(race), runner_stats(race)
+```
+"""
+const CongruenceRace = LibSemigroups.CongruenceRace
+
+"""
+    push!(race::CongruenceRace, x) -> CongruenceRace
+
+Add a copy of `x`, a [`KnuthBendix`](@ref Semigroups.KnuthBendix),
+[`KnuthBendixRewriteFromLeft`](@ref Semigroups.KnuthBendixRewriteFromLeft),
+[`ToddCoxeter`](@ref Semigroups.ToddCoxeter) or
+[`Kambites`](@ref Semigroups.Kambites), to `race` as a new competitor.
+Later changes to `x` do not affect the race.
+
+# Throws
+
+- [`LibsemigroupsError`](@ref Semigroups.LibsemigroupsError) if `race` has
+  already been run.
+"""
+function Base.push!(race::CongruenceRace, x::Union{_KnuthBendixAny,ToddCoxeter,Kambites})
+    @wrap_libsemigroups_call LibSemigroups.add_runner!(race, x)
+    return race
+end
+
+"""
+    number_of_runners(race::CongruenceRace) -> Int
+
+Return the number of competitors added to `race`.
+"""
+number_of_runners(race::CongruenceRace) = Int(LibSemigroups.number_of_runners(race))
+
+Base.length(race::CongruenceRace) = number_of_runners(race)
+
+"""
+    max_threads(race::CongruenceRace) -> Int
+
+Return the maximum number of competitors in `race` that run concurrently.
+The default is `1`.
+"""
+max_threads(race::CongruenceRace) = Int(LibSemigroups.max_threads(race))
+
+"""
+    max_threads!(race::CongruenceRace, n::Integer) -> CongruenceRace
+
+Set the maximum number of competitors in `race` that run concurrently.
+Only the first `n` competitors added take part in the race.
+
+# Throws
+
+- `ArgumentError` if `n` is negative.
+- [`LibsemigroupsError`](@ref Semigroups.LibsemigroupsError) if `n` is `0`.
+"""
+function max_threads!(race::CongruenceRace, n::Integer)
+    n >= 0 || throw(ArgumentError("the number of threads must be non-negative, found $n"))
+    @wrap_libsemigroups_call LibSemigroups.max_threads!(race, UInt(n))
+    return race
+end
+
+"""
+    run!(race::CongruenceRace) -> CongruenceRace
+
+Run the competitors in `race` until one of them finishes, then kill the
+others. Does nothing if `race` has already been run.
+
+# Throws
+
+- [`LibsemigroupsError`](@ref Semigroups.LibsemigroupsError) if `race` has
+  no competitors, or if no competitor finished and at least one threw.
+"""
+function run!(race::CongruenceRace)
+    @wrap_libsemigroups_call LibSemigroups.run!(race)
+    return race
+end
+
+"""
+    started(race::CongruenceRace) -> Bool
+
+Return `true` if [`run!`](@ref Semigroups.run!) has been called on `race`.
+"""
+started(race::CongruenceRace) = LibSemigroups.started(race)
+
+"""
+    winner(race::CongruenceRace) -> Union{Int,UndefinedType}
+
+Return the 1-based index of the competitor that won `race`, or
+[`UNDEFINED`](@ref Semigroups.UNDEFINED) if `race` has not been run or no
+competitor finished.
+"""
+winner(race::CongruenceRace) = _index_from_cpp(LibSemigroups.winner(race))
+
+"""
+    running_for_how_long(race::CongruenceRace) -> Nanosecond
+
+Return the wall-clock time taken by the most recent run of `race`.
+"""
+running_for_how_long(race::CongruenceRace) = Nanosecond(LibSemigroups.elapsed(race))
+
+"""
+    runner_stats(race::CongruenceRace) -> Vector{NamedTuple}
+
+Return one `NamedTuple` per competitor in `race`, in the order they were
+added, with fields:
+
+- `algorithm::Symbol`: `:KnuthBendix`, `:KnuthBendixRewriteFromLeft`,
+  `:ToddCoxeter` or `:Kambites`;
+- `ran::Bool`: whether the competitor took part (only the first
+  [`max_threads`](@ref Semigroups.max_threads) do);
+- `finished::Bool`: whether the competitor finished, which is `true` for the
+  winner and may be `true` for others that finished before being killed;
+- `elapsed::Nanosecond`: the time the competitor spent running;
+- `size::Int`: the size of what the competitor built, the number of nodes in
+  the word graph for `ToddCoxeter` and the number of active rules for
+  either `KnuthBendix`; always `0` for `Kambites`.
+
+Summing `elapsed` over the losers gives the CPU time they burned.
+"""
+function runner_stats(race::CongruenceRace)
+    return [
+        (
+            algorithm = Symbol(String(LibSemigroups.runner_name(race, UInt(i - 1)))),
+            ran = LibSemigroups.runner_ran(race, UInt(i - 1)),
+            finished = LibSemigroups.runner_finished(race, UInt(i - 1)),
+            elapsed = Nanosecond(LibSemigroups.runner_elapsed(race, UInt(i - 1))),
+            size = Int(LibSemigroups.runner_size(race, UInt(i - 1))),
+        ) for i = 1:number_of_runners(race)
+    ]
+end
+
+"""
+    Base.getindex(race::CongruenceRace, i::Integer) -> Union{KnuthBendix,KnuthBendixRewriteFromLeft,ToddCoxeter,Kambites}
+
+Return a copy of the `i`-th competitor in `race` (1-based), in the state it
+reached in the race. `race[winner(race)]` is the finished winner.
+
+# Throws
+
+- [`LibsemigroupsError`](@ref Semigroups.LibsemigroupsError) if `i` is out
+  of bounds.
+"""
+function Base.getindex(race::CongruenceRace, i::Integer)
+    n = number_of_runners(race)
+    if !(1 <= i <= n)
+        throw(
+            LibsemigroupsError(
+                "runner index out of bounds, expected value in [1, $n], found $i",
+            ),
+        )
+    end
+    j = UInt(i - 1)
+    name = String(@wrap_libsemigroups_call LibSemigroups.runner_name(race, j))
+    if name == "ToddCoxeter"
+        return @wrap_libsemigroups_call LibSemigroups.race_get_todd_coxeter(race, j)
+    elseif name == "KnuthBendix"
+        return @wrap_libsemigroups_call LibSemigroups.race_get_knuth_bendix(race, j)
+    elseif name == "KnuthBendixRewriteFromLeft"
+        return @wrap_libsemigroups_call LibSemigroups.race_get_knuth_bendix_from_left(
+            race,
+            j,
+        )
+    end
+    return @wrap_libsemigroups_call LibSemigroups.race_get_kambites(race, j)
+end
+
+function Base.show(io::IO, race::CongruenceRace)
+    n = number_of_runners(race)
+    state = started(race) ? "run" : "not run"
+    print(io, "<race of $n runner$(n == 1 ? "" : "s"), $state>")
+end
@@ -0,0 +1,264 @@
+# Copyright (c) 2026, James W. Swent
+#
+# Distributed under the terms of the GPL license version 3.
+#
+# The full license is in the file LICENSE, distributed with this software.
+
+"""
+element-table.jl - native hash tables of transformations and permutations
+
+An `ElementTable{E}` numbers distinct elements of one type and degree in
+the order they are first added, for algorithms such as orbits that need a
+set of elements but not a whole semigroup. The elements are stored in C++
+as raw images in one arena, so adding or looking up an element costs one
+call and no boxed object, and batches of packed elements are added or
+looked up in one call, optionally on several native threads.
+"""
+
+# ============================================================================
+# Type mapping
+# ============================================================================
+
+const _ElementTableCxx = Union{
+    LibSemigroups.ElementTableTransf1,
+    LibSemigroups.ElementTableTransf2,
+    LibSemigroups.ElementTableTransf4,
+    LibSemigroups.ElementTablePPerm1,
+    LibSemigroups.ElementTablePPerm2,
+    LibSemigroups.ElementTablePPerm4,
+    LibSemigroups.ElementTablePerm1,
+    LibSemigroups.ElementTablePerm2,
+    LibSemigroups.ElementTablePerm4,
+}
+
+_element_table_cxx_type(::Type{Transf{UInt8}}) = LibSemigroups.ElementTableTransf1
+_element_table_cxx_type(::Type{Transf{UInt16}}) = LibSemigroups.ElementTableTransf2
+_element_table_cxx_type(::Type{Transf{UInt32}}) = LibSemigroups.ElementTableTransf4
+_element_table_cxx_type(::Type{PPerm{UInt8}}) = LibSemigroups.ElementTablePPerm1
+_element_table_cxx_type(::Type{PPerm{UInt16}}) = LibSemigroups.ElementTablePPerm2
+_element_table_cxx_type(::Type{PPerm{UInt32}}) = LibSemigroups.ElementTablePPerm4
+_element_table_cxx_type(::Type{Perm{UInt8}}) = LibSemigroups.ElementTablePerm1
+_element_table_cxx_type(::Type{Perm{UInt16}}) = LibSemigroups.ElementTablePerm2
+_element_table_cxx_type(::Type{Perm{UInt32}}) = LibSemigroups.ElementTablePerm4
+
+_position_from_cpp(x::Integer) = x == typemax(UInt64) ? UNDEFINED : Int(x) + 1
+
+# ============================================================================
+# ElementTable
+# ============================================================================
+
+"""
+    ElementTable{E} <: AbstractVector{E}
+
+A hash table of distinct elements of type `E`, all of the same degree,
+numbered from `1` in the order they were first added.
+
+`E` is one of [`Transf{T}`](@ref Semigroups.Transf),
+[`PPerm{T}`](@ref Semigroups.PPerm) or [`Perm{T}`](@ref Semigroups.Perm).
+The elements are stored natively as their raw images, one after another,
+rather than as Julia objects, and are hashed on their images.
+
+An `ElementTable` is a read-only vector: `t[i]` is the `i`-th element
+added, and elements are added with [`add_element!`](@ref
+Semigroups.add_element!) or [`add_elements!`](@ref Semigroups.add_elements!).
+
+The table may be split into shards, each a hash table of its own, so that
+[`add_elements!`](@ref Semigroups.add_elements!) can insert into
+different shards on different threads. The positions given to the
+elements do not depend on the number of shards or threads.
+
+An `ElementTable` must not be used from several Julia tasks at once.
+
+# Example
+```julia
+t = ElementTable{Transf{UInt8}}(3)
+add_element!(t, Transf([2, 1, 3]))   # 1
+add_element!(t, Transf([2, 3, 1]))   # 2
+add_element!(t, Transf([2, 1, 3]))   # 1
+Semigroups.position(t, Transf([2, 3, 1]))   # 2
+t[2]                                 # Transf([2, 3, 1])
+```
+"""
+mutable struct ElementTable{E} <: AbstractVector{E}
+    cxx_obj::_ElementTableCxx
+end
+
+"""
+    ElementTable{E}(degree::Integer; shards::Integer = 1) -> ElementTable{E}
+
+Construct an empty table of elements of type `E` and degree `degree`,
+split into `shards` shards, rounded up to a power of two.
+
+# Throws
+- `ArgumentError`: if `degree` or `shards` is negative.
+- [`LibsemigroupsError`](@ref Semigroups.LibsemigroupsError): if `degree`
+  is `0`, or `shards` is not between `1` and `1024`.
+"""
+function ElementTable{E}(degree::Integer; shards::Integer = 1) where {E<:_PTransfElement}
+    degree >= 0 || throw(ArgumentError("expected a non-negative degree, found $degree"))
+    shards >= 0 || throw(ArgumentError("expected a non-negative number of shards"))
+    CxxType = _element_table_cxx_type(E)
+    cxx_obj = @wrap_libsemigroups_call CxxType(UInt(degree), UInt(shards))
+    return ElementTable{E}(cxx_obj)
+end
+
+Base.size(t::ElementTable) = (Int(LibSemigroups.size(t.cxx_obj)),)
+
+Base.IndexStyle(::Type{<:ElementTable}) = IndexLinear()
+
+"""
+    degree(t::ElementTable) -> Int
+
+Return the degree of the elements of `t`.
+"""
+degree(t::ElementTable) = Int(LibSemigroups.degree(t.cxx_obj))
+
+"""
+    number_of_shards(t::ElementTable) -> Int
+
+Return the number of shards of `t`.
+"""
+number_of_shards(t::ElementTable) = Int(LibSemigroups.number_of_shards(t.cxx_obj))
+
+"""
+    memory_usage(t::ElementTable) -> Int
+
+Return the number of bytes used by the elements and hash table of `t`.
+"""
+memory_usage(t::ElementTable) = Int(LibSemigroups.memory_usage(t.cxx_obj))
+
+function Base.getindex(t::ElementTable{E}, i::Int) where {E}
+    @boundscheck checkbounds(t, i)
+    S = _packed_scalar_type(E)
+    images = Vector{S}(undef, degree(t))
+    @wrap_libsemigroups_call LibSemigroups.element_table_images!(
+        t.cxx_obj,
+        UInt(i - 1),
+        images,
+    )
+    raw = @wrap_libsemigroups_call _packed_cxx_type(E)(StdVector{S}(images))
+    return _wrap_element(E, raw)
+end
+
+"""
+    PackedElementVector(t::ElementTable{E}) -> PackedElementVector{E}
+
+Return the elements of `t`, in order, as a
+[`PackedElementVector`](@ref Semigroups.PackedElementVector), copied in
+one call.
+"""
+function PackedElementVector(t::ElementTable{E}) where {E}
+    p = PackedElementVector{E}(undef, degree(t), length(t))
+    @wrap_libsemigroups_call LibSemigroups.element_table_images!(
+        t.cxx_obj,
+        UInt(0),
+        vec(p.images),
+    )
+    return p
+end
+
+# ============================================================================
+# Adding and looking up elements
+# ============================================================================
+
+"""
+    add_element!(t::ElementTable{E}, x::E) -> Int
+
+Return the position of `x` in `t`, adding it at the end of `t` if it is not
+already there.
+
+# Throws
+- [`LibsemigroupsError`](@ref Semigroups.LibsemigroupsError): if the degree
+  of `x` is not that of `t`.
+"""
+function add_element!(t::ElementTable{E}, x::E) where {E<:_PTransfElement}
+    raw = @wrap_libsemigroups_call LibSemigroups.element_table_insert!(
+        t.cxx_obj,
+        x.cxx_obj,
+    )
+    return Int(raw) + 1
+end
+
+"""
+    add_elements!(t::ElementTable{E}, xs::PackedElementVector{E}; nthreads::Integer = 1) -> Vector{Int}
+
+Add every element of `xs` to `t`, as [`add_element!`](@ref
+Semigroups.add_element!) would one at a time, and return the position of
+each, in one call.
+
+The elements are hashed, and if `t` has more than one shard, inserted, on
+at most `nthreads` native threads. The positions do not depend on
+`nthreads`.
+
+# Throws
+- `ArgumentError`: if the degree of `xs` is not that of `t`.
+"""
+function add_elements!(
+    t::ElementTable{E},
+    xs::PackedElementVector{E};
+    nthreads::Integer = 1,
+) where {E<:_PTransfElement}
+    _check_element_table_degree(t, xs)
+    out = Vector{UInt64}(undef, length(xs))
+    @wrap_libsemigroups_call LibSemigroups.element_table_insert!(
+        t.cxx_obj,
+        vec(xs.images),
+        out,
+        UInt(nthreads),
+    )
+    return Int[x + 1 for x in out]
+end
+
+"""
+    position(t::ElementTable{E}, x::E) -> Union{Int, UNDEFINED}
+
+Return the position of `x` in `t`, or [`UNDEFINED`](@ref
+Semigroups.UNDEFINED) if `x` is not in `t`.
+
+# Throws
+- [`LibsemigroupsError`](@ref Semigroups.LibsemigroupsError): if the degree
+  of `x` is not that of `t`.
+"""
+function position(t::ElementTable{E}, x::E) where {E<:_PTransfElement}
+    raw = @wrap_libsemigroups_call LibSemigroups.element_table_find(
+        t.cxx_obj,
+        x.cxx_obj,
+    )
+    return _position_from_cpp(raw)
+end
+
+"""
+    positions(t::ElementTable{E}, xs::PackedElementVector{E}; nthreads::Integer = 1) -> Vector{Union{Int, UndefinedType}}
+
+Return the [`position`](@ref Semigroups.position(::ElementTable{E}, ::E)
+where E) of every element of `xs` in `t`, looked up in one call on at most
+`nthreads` native threads.
+
+# Throws
+- `ArgumentError`: if the degree of `xs` is not that of `t`.
+"""
+function positions(
+    t::ElementTable{E},
+    xs::PackedElementVector{E};
+    nthreads::Integer = 1,
+) where {E<:_PTransfElement}
+    _check_element_table_degree(t, xs)
+    out = Vector{UInt64}(undef, length(xs))
+    @wrap_libsemigroups_call LibSemigroups.element_table_find(
+        t.cxx_obj,
+        vec(xs.images),
+        out,
+        UInt(nthreads),
+    )
+    return Union{Int,UndefinedType}[_position_from_cpp(x) for x in out]
+end
+
+Base.in(x::E, t::ElementTable{E}) where {E<:_PTransfElement} =
+    position(t, x) !== UNDEFINED
+
+function _check_element_table_degree(t::ElementTable, xs::PackedElementVector)
+    degree(xs) == degree(t) || throw(
+        ArgumentError("expected elements of degree $(degree(t)), found $(degree(xs))"),
+    )
+    return nothing
+end
@@ -33,6 +33,21 @@ const FroidurePinPerm4 = LibSemigroups.FroidurePinPerm4
 
 const FroidurePinBMat8 = LibSemigroups.FroidurePinBMat8
 
+# FroidurePin<Transf<N, uint8_t>> etc. for small static degrees N, which take
+# and return Transf1/PPerm1/Perm1 but store fixed-size elements. Entry `n` has
+# degree `n`; the largest degree is `max_static_degree` in
+# deps/src/froidure-pin.hpp.
+const _MAX_STATIC_DEGREE = 16
+
+_static_fp_types(kind::Symbol) = ntuple(
+    n -> getfield(LibSemigroups, Symbol(:FroidurePinStatic, kind, n)),
+    _MAX_STATIC_DEGREE,
+)
+
+const _FroidurePinStaticTransf = _static_fp_types(:Transf)
+const _FroidurePinStaticPPerm = _static_fp_types(:PPerm)
+const _FroidurePinStaticPerm = _static_fp_types(:Perm)
+
 # ============================================================================
 # Union type for cxx_obj field
 # ============================================================================
@@ -48,6 +63,9 @@ const _FroidurePinCxx = Union{
     FroidurePinPerm2,
     FroidurePinPerm4,
     FroidurePinBMat8,
+    _FroidurePinStaticTransf...,
+    _FroidurePinStaticPPerm...,
+    _FroidurePinStaticPerm...,
 }
 
 # ============================================================================
@@ -80,6 +98,27 @@ _cxx_fp_type(::Type{Perm{UInt32}}) = FroidurePinPerm4
 
 _cxx_fp_type(::Type{T}) where {T<:BMat8} = FroidurePinBMat8
 
+"""
+    _cxx_fp_type(::Type{E}, n::Integer) -> Type
+
+Map a high-level Julia element type, and the degree `n` of the generators,
+to the fastest CxxWrap FroidurePin constructor type: one storing elements of
+static degree `n` where there is one, and `_cxx_fp_type(E)` otherwise.
+"""
+_cxx_fp_type(::Type{E}, ::Integer) where {E} = _cxx_fp_type(E)
+
+function _cxx_fp_type(::Type{Transf{UInt8}}, n::Integer)
+    return 1 <= n <= _MAX_STATIC_DEGREE ? _FroidurePinStaticTransf[n] : FroidurePinTransf1
+end
+
+function _cxx_fp_type(::Type{PPerm{UInt8}}, n::Integer)
+    return 1 <= n <= _MAX_STATIC_DEGREE ? _FroidurePinStaticPPerm[n] : FroidurePinPPerm1
+end
+
+function _cxx_fp_type(::Type{Perm{UInt8}}, n::Integer)
+    return 1 <= n <= _MAX_STATIC_DEGREE ? _FroidurePinStaticPerm[n] : FroidurePinPerm1
+end
+
 """
     _wrap_element(::Type{E}, raw) -> E
 
@@ -147,6 +186,13 @@ Supported element types:
 - [`Perm{UInt8}`](@ref Semigroups.Perm), [`Perm{UInt16}`](@ref Semigroups.Perm), [`Perm{UInt32}`](@ref Semigroups.Perm) (permutations)
 - [`BMat8`](@ref Semigroups.BMat8) (boolean matrices up to 8x8)
 
+!!! note
+    For `Transf{UInt8}`, `PPerm{UInt8}` and `Perm{UInt8}` generators of
+    degree at most 16, the elements are stored in the underlying C++ object
+    as fixed-size arrays of that degree, rather than each in its own heap
+    allocated vector. This is chosen automatically, and is not visible
+    except in the memory used and the speed of enumeration.
+
 # Example
 ```julia
 using Semigroups
@@ -161,6 +207,56 @@ length(S)  # 6 (symmetric group S_3)
 """
 mutable struct FroidurePin{E}
     cxx_obj::_FroidurePinCxx
+    save_threads::Int
+    compact_mode::Bool
+    # Computed on first use once fully enumerated, and dropped whenever the
+    # generators change; see `_idempotent_cache!` and `_sorted_cache!`.
+    idempotent_cache::Union{Nothing,Vector{UInt32}}
+    sorted_cache::Union{Nothing,NamedTuple{(:order, :rank),NTuple{2,Vector{UInt32}}}}
+
+    FroidurePin{E}(cxx_obj) where {E} = new{E}(cxx_obj, 1, false, nothing, nothing)
+end
+
+# The positions of the elements change only when generators are added, or
+# when `fp` is re-initialised.
+function _drop_caches!(fp::FroidurePin)
+    fp.idempotent_cache = nothing
+    fp.sorted_cache = nothing
+    return fp
+end
+
+# The 1-based positions of the idempotents of `fp`, in increasing order,
+# found on `nthreads` threads if they are not already cached.
+function _idempotent_cache!(fp::FroidurePin; nthreads::Integer = 1)
+    cache = fp.idempotent_cache
+    cache === nothing || return cache
+    nthreads > 0 ||
+        throw(ArgumentError("the number of threads must be positive, found $nthreads"))
+    flags = Vector{UInt8}(undef, length(fp))
+    @wrap_libsemigroups_call LibSemigroups.idempotent_flags!(
+        fp.cxx_obj,
+        flags,
+        UInt(nthreads),
+    )
+    cache = UInt32[i for i in eachindex(flags) if flags[i] != 0]
+    fp.idempotent_cache = cache
+    return cache
+end
+
+# `order[k]` is the 1-based position of the `k`-th smallest element of `fp`,
+# and `rank` is the inverse permutation.
+function _sorted_cache!(fp::FroidurePin)
+    cache = fp.sorted_cache
+    cache === nothing || return cache
+    n = length(fp)
+    order = Vector{UInt32}(undef, n)
+    rank = Vector{UInt32}(undef, n)
+    @wrap_libsemigroups_call LibSemigroups.sorted_positions!(fp.cxx_obj, order, rank)
+    order .+= 1
+    rank .+= 1
+    cache = (order = order, rank = rank)
+    fp.sorted_cache = cache
+    return cache
 end
 
 # ============================================================================
@@ -200,37 +296,55 @@ length(S)  # 6
 function FroidurePin(gens::Vector{E}) where {E}
     isempty(gens) && error("At least one generator is required")
 
-    # Normalize element type (BMat8Allocated -> BMat8)
-    NE = _fp_element_type(E)
-
-    FPType = _cxx_fp_type(NE)
-    cxx_gens = [_cxx_element(g) for g in gens]
-
-    n = length(cxx_gens)
-    if n == 1
-        cxx_obj = @wrap_libsemigroups_call FPType(cxx_gens[1])
-    elseif n == 2
-        cxx_obj = @wrap_libsemigroups_call FPType(cxx_gens[1], cxx_gens[2])
-    elseif n == 3
-        cxx_obj = @wrap_libsemigroups_call FPType(cxx_gens[1], cxx_gens[2], cxx_gens[3])
-    elseif n == 4
-        cxx_obj = @wrap_libsemigroups_call FPType(
-            cxx_gens[1],
-            cxx_gens[2],
-            cxx_gens[3],
-            cxx_gens[4],
-        )
-    else
-        # >4 generators: construct with first, then add the rest
-        cxx_obj = @wrap_libsemigroups_call FPType(cxx_gens[1])
-        for i = 2:n
-            @wrap_libsemigroups_call LibSemigroups.add_generator!(cxx_obj, cxx_gens[i])
-        end
+    n = degree(first(gens))
+    if all(x -> degree(x) == n, gens)
+        return FroidurePin(PackedElementVector(gens))
     end
 
+    # Generators of different degrees: add them one at a time, so that
+    # libsemigroups reports the mismatch
+    NE = _fp_element_type(E)
+    LibSemigroups.FroidurePins.initialize()
+    cxx_obj = @wrap_libsemigroups_call _cxx_fp_type(NE, n)(_cxx_element(gens[1]))
+    for x in gens[2:end]
+        @wrap_libsemigroups_call LibSemigroups.add_generator!(cxx_obj, _cxx_element(x))
+    end
     return FroidurePin{NE}(cxx_obj)
 end
 
+"""
+    FroidurePin(gens::PackedElementVector{E}) where {E}
+
+Construct a [`FroidurePin{E}`](@ref Semigroups.FroidurePin) from the
+generators in a [`PackedElementVector`](@ref Semigroups.PackedElementVector).
+
+All of the generators are passed to libsemigroups in a single call, so
+constructing a `FroidurePin` with many generators costs no more setup than
+constructing it with one. [`FroidurePin(gens::Vector{E})`](@ref) packs its
+argument and calls this function.
+
+# Throws
+- `ErrorException`: if `gens` is empty.
+- `LibsemigroupsError`: if the images in `gens` do not define elements of
+  type `E`.
+
+# Example
+```julia
+using Semigroups
+
+gens = PackedElementVector([Transf([2, 1, 3]), Transf([2, 3, 1])])
+S = FroidurePin(gens)
+length(S)  # 6
+```
+"""
+function FroidurePin(gens::PackedElementVector{E}) where {E}
+    isempty(gens) && error("At least one generator is required")
+    FPType = _cxx_fp_type(E, degree(gens))
+    LibSemigroups.FroidurePins.initialize()
+    cxx_obj = @wrap_libsemigroups_call FPType(vec(gens.images), UInt(degree(gens)))
+    return FroidurePin{E}(cxx_obj)
+end
+
 """
     FroidurePin(x::E, xs::E...) where {E}
 
@@ -263,6 +377,62 @@ function FroidurePin(x::E, xs::E...) where {E}
     return FroidurePin(E[x, xs...])
 end
 
+"""
+    FroidurePin(p::Presentation) -> FroidurePin{Transf{S}}
+
+Construct a [`FroidurePin`](@ref Semigroups.FroidurePin) of
+transformations isomorphic to the semigroup defined by `p`.
+
+The two-sided congruence defined by `p` is enumerated by
+[`ToddCoxeter`](@ref Semigroups.ToddCoxeter), and the generator for letter
+`a` of `p` is the transformation of the nodes of the resulting word graph
+that follows the edges labelled `a`. These images are written straight
+from the word graph into the generators, in a single call, without copying
+the graph. The degree is the number of nodes of the word graph, and the
+scalar type `S` the smallest that holds it.
+
+The generators are the letters of `p`, in order, so the result is the
+semigroup generated by them. If `p` is a monoid presentation, its identity
+is an element of the result only if it is a product of letters, as it is
+for a group.
+
+This does not return if the semigroup defined by `p` is infinite.
+
+# Throws
+- `LibsemigroupsError`: if `p` is not valid.
+- `ErrorException`: if the alphabet of `p` is empty.
+
+# Example
+```julia
+using Semigroups
+
+p = Presentation()
+set_alphabet!(p, 2)
+add_rule!(p, [1, 1], [1])
+add_rule!(p, [2, 2], [2])
+add_rule!(p, [1, 2, 1], [1])
+S = FroidurePin(p)
+length(S) == number_of_classes(ToddCoxeter(twosided, p))  # true
+```
+
+# See also
+- [`ToddCoxeter(kind::congruence_kind, fp::FroidurePin)`](@ref)
+"""
+function FroidurePin(p::Presentation)
+    tc = ToddCoxeter(twosided, p)
+    wg = word_graph(tc)
+    N = number_of_nodes(wg)
+    S = _scalar_type_from_degree(N)
+    images = Matrix{S}(undef, N, out_degree(wg))
+    GC.@preserve tc begin
+        @wrap_libsemigroups_call LibSemigroups.word_graph_generator_images!(
+            wg,
+            vec(images),
+        )
+    end
+    return FroidurePin(PackedElementVector{Transf{S},S}(N, images))
+end
+
 # ============================================================================
 # Size queries
 # ============================================================================
@@ -517,7 +687,7 @@ default constructed. Returns `fp` for method chaining.
 """
 function init!(fp::FroidurePin)
     LibSemigroups.init!(fp.cxx_obj)
-    return fp
+    return _drop_caches!(fp)
 end
 
 """
@@ -864,6 +1034,11 @@ sorted_at(S, 1)  # first element in sorted order
 """
 function sorted_at(fp::FroidurePin{E}, i::Integer) where {E}
     idx = _to_cpp(i, UInt)
+    order = _sorted_cache!(fp).order
+    if idx < length(order)
+        return fp[order[idx+1]]
+    end
+    # Out of range: libsemigroups reports the error
     raw = @wrap_libsemigroups_call LibSemigroups.sorted_at(fp.cxx_obj, idx)
     return _wrap_element(E, raw)
 end
@@ -946,7 +1121,8 @@ length(T)  # 6, independently computed
 """
 function Base.copy(fp::FroidurePin{E}) where {E}
     gens = [generator(fp, i) for i = 1:number_of_generators(fp)]
-    return FroidurePin(gens)
+    result = save_threads!(FroidurePin(gens), save_threads(fp))
+    return compact_mode!(result, compact_mode(fp))
 end
 
 # ============================================================================
@@ -1068,15 +1244,13 @@ if `x` is not an element of `fp`.
 - [`sorted_at`](@ref)
 """
 function sorted_position(fp::FroidurePin{E}, x::E) where {E}
-    cxx_x = _cxx_element(x)
-    raw = @wrap_libsemigroups_call LibSemigroups.sorted_position(fp.cxx_obj, cxx_x)
-    return _from_cpp(raw)
+    i = position(fp, x)
+    return i === UNDEFINED ? UNDEFINED : Int(_sorted_cache!(fp).rank[i])
 end
 
 function sorted_position(fp::FroidurePin{BMat8}, x::BMat8)
-    cxx_x = _cxx_element(x)
-    raw = @wrap_libsemigroups_call LibSemigroups.sorted_position(fp.cxx_obj, cxx_x)
-    return _from_cpp(raw)
+    i = position(fp, x)
+    return i === UNDEFINED ? UNDEFINED : Int(_sorted_cache!(fp).rank[i])
 end
 
 """
@@ -1101,8 +1275,8 @@ if `i` is greater than [`length`](@ref Base.length)`(fp)`.
 """
 function to_sorted_position(fp::FroidurePin, i::Integer)
     idx = _to_cpp(i, UInt)
-    raw = @wrap_libsemigroups_call LibSemigroups.to_sorted_position(fp.cxx_obj, idx)
-    return _from_cpp(raw)
+    rank = _sorted_cache!(fp).rank
+    return idx < length(rank) ? Int(rank[idx+1]) : UNDEFINED
 end
 
 """
@@ -1195,13 +1369,13 @@ length(S)  # 6
 function Base.push!(fp::FroidurePin{E}, x::E) where {E}
     cxx_x = _cxx_element(x)
     @wrap_libsemigroups_call LibSemigroups.add_generator!(fp.cxx_obj, cxx_x)
-    return fp
+    return _drop_caches!(fp)
 end
 
 function Base.push!(fp::FroidurePin{BMat8}, x::BMat8)
     cxx_x = _cxx_element(x)
     @wrap_libsemigroups_call LibSemigroups.add_generator!(fp.cxx_obj, cxx_x)
-    return fp
+    return _drop_caches!(fp)
 end
 
 """
@@ -1215,13 +1389,13 @@ Returns `fp` for method chaining.
 function closure!(fp::FroidurePin{E}, x::E) where {E}
     cxx_x = _cxx_element(x)
     @wrap_libsemigroups_call LibSemigroups.closure!(fp.cxx_obj, cxx_x)
-    return fp
+    return _drop_caches!(fp)
 end
 
 function closure!(fp::FroidurePin{BMat8}, x::BMat8)
     cxx_x = _cxx_element(x)
     @wrap_libsemigroups_call LibSemigroups.closure!(fp.cxx_obj, cxx_x)
-    return fp
+    return _drop_caches!(fp)
 end
 
 """
@@ -1260,6 +1434,123 @@ function copy_add_generators(fp::FroidurePin{BMat8}, x::BMat8)
     return FroidurePin{BMat8}(new_cxx)
 end
 
+# ----------------------------------------------------------------------------
+# Many elements at once
+# ----------------------------------------------------------------------------
+
+# The elements `xs` packed for a single call into libsemigroups. An empty
+# `xs` is packed with the degree of `fp`, which libsemigroups then ignores.
+_packed_generators(::FroidurePin, xs::PackedElementVector) = xs
+
+function _packed_generators(fp::FroidurePin{E}, xs::AbstractVector) where {E}
+    isempty(xs) && return PackedElementVector{E}(undef, degree(fp), 0)
+    return PackedElementVector(xs)
+end
+
+"""
+    add_generators!(fp::FroidurePin{E}, xs::AbstractVector{E}) where E -> FroidurePin{E}
+
+Add every element of `xs` to `fp` as a generator.
+
+This is equivalent to calling [`push!`](@ref)`(fp, x)` for each `x` in
+`xs`, but passes all of `xs` to libsemigroups in a single call, so that
+`fp` is only re-initialised once. The argument `xs` can also be a
+[`PackedElementVector{E}`](@ref Semigroups.PackedElementVector).
+
+Returns `fp` for method chaining.
+
+# Throws
+- `ArgumentError`: if the elements of `xs` do not all have the same
+  degree.
+- `LibsemigroupsError`: if the degree of the elements of `xs` is not
+  [`degree`](@ref Semigroups.degree(::FroidurePin))`(fp)`.
+
+# Example
+```julia
+S = FroidurePin(Transf([2, 1, 3, 4]))
+add_generators!(S, [Transf([2, 3, 4, 1]), Transf([1, 1, 3, 4])])
+length(S)  # 256
+```
+"""
+function add_generators!(fp::FroidurePin{E}, xs::AbstractVector{<:E}) where {E}
+    p = _packed_generators(fp, xs)
+    @wrap_libsemigroups_call LibSemigroups.add_generators!(
+        fp.cxx_obj,
+        vec(p.images),
+        UInt(degree(p)),
+    )
+    return _drop_caches!(fp)
+end
+
+"""
+    closure!(fp::FroidurePin{E}, xs::AbstractVector{E}) where E -> FroidurePin{E}
+
+Add to `fp` as generators those elements of `xs` that are not already
+contained in it, all in one call to libsemigroups. The argument `xs` can
+also be a [`PackedElementVector{E}`](@ref Semigroups.PackedElementVector).
+
+Returns `fp` for method chaining.
+
+# Throws
+- `ArgumentError`: if the elements of `xs` do not all have the same
+  degree.
+- `LibsemigroupsError`: if the degree of the elements of `xs` is not
+  [`degree`](@ref Semigroups.degree(::FroidurePin))`(fp)`.
+"""
+function closure!(fp::FroidurePin{E}, xs::AbstractVector{<:E}) where {E}
+    p = _packed_generators(fp, xs)
+    @wrap_libsemigroups_call LibSemigroups.closure!(
+        fp.cxx_obj,
+        vec(p.images),
+        UInt(degree(p)),
+    )
+    return _drop_caches!(fp)
+end
+
+"""
+    copy_closure(fp::FroidurePin{E}, xs::AbstractVector{E}) where E -> FroidurePin{E}
+
+Return a copy of `fp` with those elements of `xs` that it does not already
+contain added as generators, as by [`closure!`](@ref)`(fp, xs)`.
+
+# Throws
+- `ArgumentError`: if the elements of `xs` do not all have the same
+  degree.
+- `LibsemigroupsError`: if the degree of the elements of `xs` is not
+  [`degree`](@ref Semigroups.degree(::FroidurePin))`(fp)`.
+"""
+function copy_closure(fp::FroidurePin{E}, xs::AbstractVector{<:E}) where {E}
+    p = _packed_generators(fp, xs)
+    new_cxx = @wrap_libsemigroups_call LibSemigroups.copy_closure(
+        fp.cxx_obj,
+        vec(p.images),
+        UInt(degree(p)),
+    )
+    return FroidurePin{E}(new_cxx)
+end
+
+"""
+    copy_add_generators(fp::FroidurePin{E}, xs::AbstractVector{E}) where E -> FroidurePin{E}
+
+Return a copy of `fp` with every element of `xs` added as a generator, as
+by [`add_generators!`](@ref)`(fp, xs)`.
+
+# Throws
+- `ArgumentError`: if the elements of `xs` do not all have the same
+  degree.
+- `LibsemigroupsError`: if the degree of the elements of `xs` is not
+  [`degree`](@ref Semigroups.degree(::FroidurePin))`(fp)`.
+"""
+function copy_add_generators(fp::FroidurePin{E}, xs::AbstractVector{<:E}) where {E}
+    p = _packed_generators(fp, xs)
+    new_cxx = @wrap_libsemigroups_call LibSemigroups.copy_add_generators(
+        fp.cxx_obj,
+        vec(p.images),
+        UInt(degree(p)),
+    )
+    return FroidurePin{E}(new_cxx)
+end
+
 """
     reserve!(fp::FroidurePin, n::Integer) -> FroidurePin
 
@@ -1274,6 +1565,54 @@ function reserve!(fp::FroidurePin, n::Integer)
     return fp
 end
 
+"""
+    memory_usage(fp::FroidurePin) -> NamedTuple
+
+Return an estimate of the number of bytes used by `fp` for the elements
+enumerated so far, broken down by component:
+
+- `elements`: the element store;
+- `hash_table`: the hash table used to look up elements;
+- `right_cayley_graph` and `left_cayley_graph`: the two Cayley graphs;
+- `reduced`: the table of reduced words from which [`rules`](@ref
+  Semigroups.rules(::FroidurePin)) are read;
+- `words`: the prefix, suffix, first and final letters and length of every
+  element;
+- `total`: the sum of the above.
+
+The estimate is computed from the number of elements and generators and
+the layout of the containers used by libsemigroups, and does not include
+spare capacity, for example after [`reserve!`](@ref
+Semigroups.reserve!(::FroidurePin, ::Integer)). It is most useful to
+compare the components, and to extrapolate from a partial enumeration.
+
+!!! note
+    This function does not trigger any enumeration.
+
+# Example
+```julia
+S = FroidurePin(Transf([2, 1, 3, 4, 5]), Transf([2, 3, 4, 5, 1]), Transf([1, 1, 3, 4, 5]))
+enumerate!(S, 1000)
+m = memory_usage(S)
+m.total / current_size(S)  # bytes per element
+```
+
+# See also
+- [`compact_mode!`](@ref Semigroups.compact_mode!)
+"""
+function memory_usage(fp::FroidurePin)
+    bytes = Int.(LibSemigroups.memory_usage(fp.cxx_obj))
+    return (
+        elements = bytes[1],
+        hash_table = bytes[2],
+        right_cayley_graph = bytes[3],
+        left_cayley_graph = bytes[4],
+        reduced = bytes[5],
+        words = bytes[6],
+        total = sum(bytes),
+    )
+end
+
 # ============================================================================
 # Settings
 # ============================================================================
@@ -1327,6 +1666,121 @@ function set_batch_size!(fp::FroidurePin, n::Integer)
     return fp
 end
 
+"""
+    save_threads(fp::FroidurePin) -> Int
+
+Return the number of threads used by
+[`save_froidure_pin`](@ref Semigroups.save_froidure_pin) to enumerate `fp`.
+
+This setting does not affect [`run!`](@ref), [`enumerate!`](@ref
+Semigroups.enumerate!(::FroidurePin, ::Integer)), or any other function
+that enumerates `fp` itself, which always uses a single thread.
+
+The default value is `1`.
+
+# See also
+- [`save_threads!`](@ref Semigroups.save_threads!(::FroidurePin, ::Integer))
+"""
+save_threads(fp::FroidurePin) = fp.save_threads
+
+"""
+    save_threads!(fp::FroidurePin, n::Integer) -> FroidurePin
+
+Set the number of threads used by
+[`save_froidure_pin`](@ref Semigroups.save_froidure_pin) to enumerate `fp`
+to `n`.
+
+If `n > 1` and `fp` has not started running, then `save_froidure_pin`
+enumerates the semigroup on `n` threads: the products of each word length
+are computed in parallel, and the elements are numbered in the same order,
+with the same Cayley graphs, as by [`run!`](@ref). This is worthwhile when
+the enumerated semigroup is only needed from the file, via
+[`FrozenFroidurePin`](@ref Semigroups.FrozenFroidurePin).
+
+!!! note
+    This setting only affects `save_froidure_pin`. [`run!`](@ref),
+    [`enumerate!`](@ref Semigroups.enumerate!(::FroidurePin, ::Integer)),
+    [`length`](@ref) and every other function that enumerates `fp` itself
+    use a single thread, since the state of a libsemigroups `FroidurePin`
+    cannot be filled in from outside. The parallel enumeration builds
+    tables of its own, computes only what the file stores (the elements,
+    Cayley graphs, prefixes, suffixes, letters, lengths, sorted order and
+    idempotents, but no [`rules`](@ref Semigroups.rules(::FroidurePin))),
+    and leaves `fp` unenumerated.
+
+Returns `fp` for method chaining.
+
+# Throws
+- `ArgumentError`: if `n` is not positive.
+
+# Example
+```julia
+S = FroidurePin(Transf([2, 1, 3, 4, 5]), Transf([2, 3, 4, 5, 1]), Transf([1, 1, 3, 4, 5]))
+save_threads!(S, 8)
+save_froidure_pin(S, "t5.fp")
+length(FrozenFroidurePin("t5.fp"))  # 3125
+```
+
+# See also
+- [`save_threads`](@ref Semigroups.save_threads(::FroidurePin))
+"""
+function save_threads!(fp::FroidurePin, n::Integer)
+    n > 0 || throw(ArgumentError("the number of threads must be positive, found $n"))
+    fp.save_threads = Int(n)
+    return fp
+end
+
+"""
+    compact_mode(fp::FroidurePin) -> Bool
+
+Return whether [`save_froidure_pin`](@ref Semigroups.save_froidure_pin)
+saves `fp` in compact mode.
+
+The default value is `false`.
+
+# See also
+- [`compact_mode!`](@ref Semigroups.compact_mode!)
+"""
+compact_mode(fp::FroidurePin) = fp.compact_mode
+
+"""
+    compact_mode!(fp::FroidurePin, val::Bool) -> FroidurePin
+
+Set whether [`save_froidure_pin`](@ref Semigroups.save_froidure_pin) saves
+`fp` in compact mode.
+
+In compact mode, if `fp` has not started running, `save_froidure_pin`
+enumerates the semigroup (on [`save_threads(fp)`](@ref
+Semigroups.save_threads(::FroidurePin)) threads) without storing the left
+Cayley graph, or the table of reduced words from which the rules are read.
+Each product is then computed by multiplying elements, rather than by
+following these tables, so enumeration takes longer but needs less memory;
+the numbering of the elements is unchanged. The file written has no left
+Cayley graph either, and
+[`FrozenFroidurePin`](@ref Semigroups.FrozenFroidurePin) computes every
+[`fast_product`](@ref Semigroups.fast_product(::FrozenFroidurePin,
+::Integer, ::Integer)) through the right Cayley graph.
+
+Compact mode only affects `save_froidure_pin`. [`run!`](@ref),
+[`enumerate!`](@ref Semigroups.enumerate!(::FroidurePin, ::Integer)) and
+every other function that enumerates `fp` itself store both Cayley graphs
+and the table of reduced words whatever the value of this setting, so a
+`FroidurePin` that has already started running keeps its full in-memory
+representation, and compact mode only makes its file smaller. To enumerate
+in less memory, call `save_froidure_pin` before anything else that runs
+`fp`, and read the result from the file.
+
+Returns `fp` for method chaining.
+
+# See also
+- [`compact_mode`](@ref Semigroups.compact_mode)
+- [`memory_usage`](@ref Semigroups.memory_usage)
+"""
+function compact_mode!(fp::FroidurePin, val::Bool)
+    fp.compact_mode = val
+    return fp
+end
+
 # ============================================================================
 # Predicates
 # ============================================================================
@@ -1373,7 +1827,13 @@ idempotent (i.e., `x * x == x`) and `false` if it is not.
 """
 function is_idempotent(fp::FroidurePin, i::Integer)
     idx = _to_cpp(i, UInt)
-    return @wrap_libsemigroups_call LibSemigroups.is_idempotent(fp.cxx_obj, idx)
+    if idx >= length(fp)
+        # Out of range: libsemigroups reports the error
+        return @wrap_libsemigroups_call LibSemigroups.is_idempotent(fp.cxx_obj, idx)
+    end
+    positions = _idempotent_cache!(fp)
+    k = searchsortedfirst(positions, idx + 1)
+    return k <= length(positions) && positions[k] == idx + 1
 end
 
 # ============================================================================
@@ -1544,14 +2004,15 @@ current_number_of_rules(fp::FroidurePin) =
     Int(LibSemigroups.current_number_of_rules(fp.cxx_obj))
 
 """
-    number_of_idempotents(fp::FroidurePin) -> Int
+    number_of_idempotents(fp::FroidurePin; nthreads::Integer = 1) -> Int
 
-Return the total number of idempotent elements in the semigroup.
+Return the total number of idempotent elements in the semigroup. See
+[`idempotent_positions`](@ref) for `nthreads`.
 
 Triggers full enumeration if not already complete.
 """
-number_of_idempotents(fp::FroidurePin) =
-    Int(LibSemigroups.number_of_idempotents(fp.cxx_obj))
+number_of_idempotents(fp::FroidurePin; nthreads::Integer = 1) =
+    length(_idempotent_cache!(fp; nthreads = nthreads))
 
 """
     currently_contains_one(fp::FroidurePin) -> Bool
@@ -1669,14 +2130,8 @@ end
 ```
 """
 function rules(fp::FroidurePin)
-    lhs_raw = @wrap_libsemigroups_call LibSemigroups.rules_lhs(fp.cxx_obj)
-    rhs_raw = @wrap_libsemigroups_call LibSemigroups.rules_rhs(fp.cxx_obj)
-    n = length(lhs_raw)
-    result = Vector{Pair{Vector{Int},Vector{Int}}}(undef, n)
-    for i = 1:n
-        result[i] = _word_from_cpp(lhs_raw[i]) => _word_from_cpp(rhs_raw[i])
-    end
-    return result
+    flat = @wrap_libsemigroups_call LibSemigroups.rules(fp.cxx_obj)
+    return _packed_rules(Pair, flat)
 end
 
 """
@@ -1686,18 +2141,12 @@ Return all rules discovered so far (without triggering further enumeration)
 as a vector of `lhs => rhs` pairs with 1-based generator indices.
 """
 function current_rules(fp::FroidurePin)
-    lhs_raw = @wrap_libsemigroups_call LibSemigroups.current_rules_lhs(fp.cxx_obj)
-    rhs_raw = @wrap_libsemigroups_call LibSemigroups.current_rules_rhs(fp.cxx_obj)
-    n = length(lhs_raw)
-    result = Vector{Pair{Vector{Int},Vector{Int}}}(undef, n)
-    for i = 1:n
-        result[i] = _word_from_cpp(lhs_raw[i]) => _word_from_cpp(rhs_raw[i])
-    end
-    return result
+    flat = @wrap_libsemigroups_call LibSemigroups.current_rules(fp.cxx_obj)
+    return _packed_rules(Pair, flat)
 end
 
 """
-    normal_forms(fp::FroidurePin) -> Vector{Vector{Int}}
+    normal_forms(fp::FroidurePin) -> PackedWordVector
 
 Return the normal forms (canonical representatives) for all elements,
 as 1-based generator-index words.
@@ -1706,25 +2155,158 @@ Triggers full enumeration if not already complete.
 """
 function normal_forms(fp::FroidurePin)
     raw = @wrap_libsemigroups_call LibSemigroups.normal_forms(fp.cxx_obj)
-    return [_word_from_cpp(w) for w in raw]
+    return _packed_words(raw)
 end
 
 """
-    current_normal_forms(fp::FroidurePin) -> Vector{Vector{Int}}
+    current_normal_forms(fp::FroidurePin) -> PackedWordVector
 
 Return the normal forms discovered so far (without triggering further
 enumeration) as 1-based generator-index words.
 """
 function current_normal_forms(fp::FroidurePin)
     raw = @wrap_libsemigroups_call LibSemigroups.current_normal_forms(fp.cxx_obj)
-    return [_word_from_cpp(w) for w in raw]
+    return _packed_words(raw)
+end
+
+# ============================================================================
+# Chunked streams — rules and normal forms without materialization
+# ============================================================================
+
+const _DEFAULT_CHUNK_SIZE = 4096
+
+"""
+    WordChunks
+
+Stateful stream over the normal forms or rules of a [`FroidurePin`](@ref),
+produced in fixed-size chunks.
+
+Iterating a `WordChunks` yields named tuples `(letters, offsets)` where
+`letters::Vector{UInt}` holds the words of the chunk concatenated, with raw
+**0-based** generator indices, and `offsets::Vector{UInt64}` delimits them:
+word `i` of the chunk is `letters[offsets[i]+1:offsets[i+1]]`. Each chunk is
+a fresh pair of arrays, so it can be kept (or written out) after the stream
+moves on, while only one chunk is ever held on the C++ side.
+
+For streams of rules, the words are interleaved: words `2i - 1` and `2i`
+are the left- and right-hand sides of the `i`-th rule of the chunk.
+
+A `WordChunks` keeps its [`FroidurePin`](@ref) alive. Enumerating the
+semigroup further while a stream is in progress throws a
+`LibsemigroupsError` at the next chunk.
+
+See also [`normal_forms_chunks`](@ref), [`rules_chunks`](@ref).
+"""
+mutable struct WordChunks{C}
+    fp::FroidurePin
+    cxx::C
+end
+
+Base.IteratorSize(::Type{<:WordChunks}) = Base.SizeUnknown()
+Base.eltype(::Type{<:WordChunks}) =
+    NamedTuple{(:letters, :offsets),Tuple{Vector{UInt},Vector{UInt64}}}
+
+function Base.iterate(c::WordChunks, state = nothing)
+    GC.@preserve c begin
+        LibSemigroups.at_end(c.cxx) && return nothing
+        # `get` borrows the chunk held by the cursor, which is copied here
+        # once, before `next!` overwrites it.
+        chunk = _packed_buffers(LibSemigroups.get(c.cxx))
+        @wrap_libsemigroups_call LibSemigroups.next!(c.cxx)
+    end
+    return (chunk, nothing)
+end
+
+"""
+    chunk_size(c::WordChunks) -> Int
+
+Return the number of words (for normal forms) or rules (for rules) in each
+chunk of `c`; the last chunk may be shorter.
+"""
+chunk_size(c::WordChunks) = Int(LibSemigroups.chunk_size(c.cxx))
+
+"""
+    normal_forms_chunks(fp::FroidurePin, chunk_size::Integer = 4096) -> WordChunks
+
+Return a stream over the normal forms of `fp`, in chunks of at most
+`chunk_size` words. The words appear in the same order as in
+[`normal_forms`](@ref).
+
+Triggers full enumeration if not already complete.
+
+# Throws
+- `LibsemigroupsError`: if `chunk_size` is `0`.
+
+# Example
+```julia
+S = FroidurePin(Transf([2, 1, 3]), Transf([2, 3, 1]))
+for (letters, offsets) in normal_forms_chunks(S, 2)
+    # word i of the chunk is letters[offsets[i]+1:offsets[i+1]] .+ 1
+end
+```
+"""
+function normal_forms_chunks(fp::FroidurePin, chunk_size::Integer = _DEFAULT_CHUNK_SIZE)
+    cxx = @wrap_libsemigroups_call LibSemigroups.normal_forms_cursor(
+        fp.cxx_obj,
+        UInt(chunk_size),
+    )
+    return WordChunks(fp, cxx)
+end
+
+"""
+    current_normal_forms_chunks(fp::FroidurePin, chunk_size::Integer = 4096) -> WordChunks
+
+Return a stream over the normal forms discovered so far (without
+triggering further enumeration), in chunks of at most `chunk_size` words.
+"""
+function current_normal_forms_chunks(
+    fp::FroidurePin,
+    chunk_size::Integer = _DEFAULT_CHUNK_SIZE,
+)
+    cxx = @wrap_libsemigroups_call LibSemigroups.current_normal_forms_cursor(
+        fp.cxx_obj,
+        UInt(chunk_size),
+    )
+    return WordChunks(fp, cxx)
+end
+
+"""
+    rules_chunks(fp::FroidurePin, chunk_size::Integer = 4096) -> WordChunks
+
+Return a stream over the rules of `fp`, in chunks of at most `chunk_size`
+rules (so at most `2 * chunk_size` words, interleaved left- then right-hand
+side). The rules appear in the same order as in [`rules`](@ref), and the
+rules are traversed only once.
+
+Triggers full enumeration if not already complete.
+
+# Throws
+- `LibsemigroupsError`: if `chunk_size` is `0`.
+"""
+function rules_chunks(fp::FroidurePin, chunk_size::Integer = _DEFAULT_CHUNK_SIZE)
+    cxx = @wrap_libsemigroups_call LibSemigroups.rules_cursor(fp.cxx_obj, UInt(chunk_size))
+    return WordChunks(fp, cxx)
+end
+
+"""
+    current_rules_chunks(fp::FroidurePin, chunk_size::Integer = 4096) -> WordChunks
+
+Return a stream over the rules discovered so far (without triggering
+further enumeration), in chunks of at most `chunk_size` rules.
+"""
+function current_rules_chunks(fp::FroidurePin, chunk_size::Integer = _DEFAULT_CHUNK_SIZE)
+    cxx = @wrap_libsemigroups_call LibSemigroups.current_rules_cursor(
+        fp.cxx_obj,
+        UInt(chunk_size),
+    )
+    return WordChunks(fp, cxx)
 end
 
 """
-    idempotents(fp::FroidurePin{E}) -> Vector{E}
+    idempotents(fp::FroidurePin{E}; nthreads::Integer = 1) -> Vector{E}
 
 Return all idempotent elements of the semigroup (elements `x` such
-that `x * x == x`).
+that `x * x == x`). See [`idempotent_positions`](@ref) for `nthreads`.
 
 Triggers full enumeration if not already complete.
 
@@ -1734,15 +2316,38 @@ S = FroidurePin(Transf([2, 1, 3]), Transf([2, 3, 1]))
 ids = idempotents(S)  # [Transf([1, 2, 3])]
 ```
 """
-function idempotents(fp::FroidurePin{E}) where {E}
-    raw = @wrap_libsemigroups_call LibSemigroups.idempotents(fp.cxx_obj)
-    # GC.@preserve raw to keep StdVector alive while iterating;
-    # _copy_cxx_element converts Dereferenced refs to Allocated copies.
-    GC.@preserve raw begin
-        return E[_wrap_element(E, _copy_cxx_element(x)) for x in raw]
-    end
+function idempotents(fp::FroidurePin{E}; nthreads::Integer = 1) where {E}
+    return E[fp[i] for i in _idempotent_cache!(fp; nthreads = nthreads)]
 end
 
+"""
+    idempotent_positions(fp::FroidurePin; nthreads::Integer = 1) -> Vector{UInt32}
+
+Return the 1-based positions of the idempotents of `fp`, in increasing
+order.
+
+The idempotents are found once, by a scan of the right Cayley graph on
+`nthreads` threads that multiplies no elements, and the result is kept by
+`fp` until its generators change; `nthreads` is ignored while it is kept. [`number_of_idempotents`](@ref),
+[`is_idempotent`](@ref) and [`idempotents`](@ref) use the same result.
+Returns a copy, which costs 4 bytes per idempotent, rather than the elements
+themselves.
+
+Triggers full enumeration if not already complete.
+
+# Throws
+- `ArgumentError`: if `nthreads` is not positive.
+
+# Example
+```julia
+S = FroidurePin(Transf([2, 1, 3]), Transf([2, 3, 1]))
+idempotent_positions(S)  # only the identity
+S[Int(only(idempotent_positions(S)))] == Transf([1, 2, 3])  # true
+```
+"""
+idempotent_positions(fp::FroidurePin; nthreads::Integer = 1) =
+    copy(_idempotent_cache!(fp; nthreads = nthreads))
+
 """
     sorted_elements(fp::FroidurePin{E}) -> Vector{E}
 
@@ -1757,14 +2362,33 @@ se = sorted_elements(S)
 ```
 """
 function sorted_elements(fp::FroidurePin{E}) where {E}
-    raw = @wrap_libsemigroups_call LibSemigroups.sorted_elements(fp.cxx_obj)
-    # GC.@preserve raw to keep StdVector alive while iterating;
-    # _copy_cxx_element converts Dereferenced refs to Allocated copies.
-    GC.@preserve raw begin
-        return E[_wrap_element(E, _copy_cxx_element(x)) for x in raw]
-    end
+    return E[fp[i] for i in _sorted_cache!(fp).order]
 end
 
+"""
+    sorted_positions(fp::FroidurePin) -> Vector{UInt32}
+
+Return the 1-based positions of the elements of `fp` in sorted order, so
+that the `k`-th entry is the position of
+[`sorted_at`](@ref)`(fp, k)`.
+
+The elements are sorted once, and the permutation and its inverse are kept
+by `fp` until its generators change; [`sorted_at`](@ref),
+[`sorted_position`](@ref), [`to_sorted_position`](@ref) and
+[`sorted_elements`](@ref) all use them. Returns a copy, which costs 4 bytes
+per element, rather than the elements themselves.
+
+Triggers full enumeration if not already complete.
+
+# Example
+```julia
+S = FroidurePin(Transf([2, 1, 3]), Transf([2, 3, 1]))
+order = sorted_positions(S)
+[S[Int(i)] for i in order] == sorted_elements(S)  # true
+```
+"""
+sorted_positions(fp::FroidurePin) = copy(_sorted_cache!(fp).order)
+
 # ============================================================================
 # Factorisations
 # ============================================================================
@@ -1878,6 +2502,132 @@ Return the left Cayley graph for elements enumerated so far.
 current_left_cayley_graph(fp::FroidurePin) =
     LibSemigroups.current_left_cayley_graph(fp.cxx_obj)
 
+"""
+    right_cayley_table(fp::FroidurePin) -> TargetTable
+
+Return the right Cayley graph of the semigroup as a borrowed table.
+
+The result `t` is a [`TargetTable`](@ref) with `t[i, j]` the raw 0-based
+position of the product of element `i` by generator `j` on the right.
+No data is copied; `t` keeps `fp` alive and is invalidated by
+[`push!`](@ref Base.push!) or [`closure!`](@ref).
+
+Triggers full enumeration if not already complete.
+"""
+function right_cayley_table(fp::FroidurePin)
+    g = @wrap_libsemigroups_call LibSemigroups.right_cayley_graph(fp.cxx_obj)
+    return _target_table(fp, g)
+end
+
+"""
+    current_right_cayley_table(fp::FroidurePin) -> Matrix{UInt32}
+
+Return a copy of the right Cayley graph for elements enumerated so far,
+in the layout of [`target_table`](@ref).
+"""
+current_right_cayley_table(fp::FroidurePin) =
+    target_table(LibSemigroups.current_right_cayley_graph(fp.cxx_obj))
+
+"""
+    left_cayley_table(fp::FroidurePin) -> TargetTable
+
+Return the left Cayley graph of the semigroup as a borrowed table.
+
+The result `t` is a [`TargetTable`](@ref) with `t[i, j]` the raw 0-based
+position of the product of generator `j` by element `i` on the left.
+No data is copied; `t` keeps `fp` alive and is invalidated by
+[`push!`](@ref Base.push!) or [`closure!`](@ref).
+
+Triggers full enumeration if not already complete.
+"""
+function left_cayley_table(fp::FroidurePin)
+    g = @wrap_libsemigroups_call LibSemigroups.left_cayley_graph(fp.cxx_obj)
+    return _target_table(fp, g)
+end
+
+"""
+    current_left_cayley_table(fp::FroidurePin) -> Matrix{UInt32}
+
+Return a copy of the left Cayley graph for elements enumerated so far,
+in the layout of [`target_table`](@ref).
+"""
+current_left_cayley_table(fp::FroidurePin) =
+    target_table(LibSemigroups.current_left_cayley_graph(fp.cxx_obj))
+
+# ============================================================================
+# Conversion to ToddCoxeter and KnuthBendix
+# ============================================================================
+
+"""
+    ToddCoxeter(kind::congruence_kind, fp::FroidurePin,
+                wg = right_cayley_graph(fp)) -> ToddCoxeter
+
+Construct a [`ToddCoxeter`](@ref Semigroups.ToddCoxeter) over the
+semigroup `fp`, starting from its Cayley graph `wg`.
+
+Congruences of `fp` are then given by adding generating pairs to the
+result, by [`add_generating_pair!`](@ref Semigroups.add_generating_pair!),
+and running it. The result is a single `ToddCoxeter`: unlike making a
+[`Congruence`](@ref Semigroups.Congruence) from `fp`, no other runners
+are made, and the Cayley graph is copied into it once, with a node added
+for an identity if `fp` does not contain one.
+
+Triggers full enumeration of `fp`.
+
+# Arguments
+- `kind::congruence_kind`: the kind of congruence.
+- `fp::FroidurePin`: the semigroup.
+- `wg`: [`right_cayley_graph`](@ref)`(fp)` (the default) for right or
+  two-sided congruences, or [`left_cayley_graph`](@ref)`(fp)` for left
+  congruences.
+
+# Throws
+- [`LibsemigroupsError`](@ref Semigroups.LibsemigroupsError): if `wg` is
+  not one of the Cayley graphs of `fp`.
+
+# Example
+```julia
+S = FroidurePin(Transf([2, 1, 3]), Transf([1, 1, 3]))
+tc = ToddCoxeter(twosided, S)
+add_generating_pair!(tc, [2], [1, 2])
+number_of_classes(tc)
+```
+"""
+function ToddCoxeter(
+    kind::congruence_kind,
+    fp::FroidurePin,
+    wg = right_cayley_graph(fp),
+)
+    GC.@preserve fp begin
+        return @wrap_libsemigroups_call LibSemigroups.to_todd_coxeter_from_fpb(
+            kind,
+            fp.cxx_obj,
+            wg,
+        )
+    end
+end
+
+"""
+    KnuthBendix(kind::congruence_kind, fp::FroidurePin) -> KnuthBendix
+
+Construct a [`KnuthBendix`](@ref Semigroups.KnuthBendix) over the
+semigroup `fp`, from the presentation given by its [`rules`](@ref).
+
+The presentation is made once and moved into the result, and no other
+runners are made. The rules of a `FroidurePin` are already confluent, so
+running the result with no generating pairs added finds no new rules.
+
+Triggers full enumeration of `fp`.
+"""
+function KnuthBendix(kind::congruence_kind, fp::FroidurePin)
+    GC.@preserve fp begin
+        return @wrap_libsemigroups_call LibSemigroups.to_knuth_bendix_from_fpb(
+            kind,
+            fp.cxx_obj,
+        )
+    end
+end
+
 # ============================================================================
 # Word-element conversion
 # ============================================================================
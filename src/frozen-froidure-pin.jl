@@ -0,0 +1,398 @@
+# Copyright (c) 2026, James W. Swent
+#
+# Distributed under the terms of the GPL license version 3.
+#
+# The full license is in the file LICENSE, distributed with this software.
+
+"""
+frozen-froidure-pin.jl - enumerated FroidurePin results on disk
+
+Provides [`save_froidure_pin`](@ref Semigroups.save_froidure_pin), which
+writes a fully enumerated `FroidurePin{E}` to a file, and the read-only
+`FrozenFroidurePin{E}`, which memory-maps such a file and answers queries
+from it without enumerating again.
+"""
+
+# ============================================================================
+# CxxWrap type aliases — concrete FrozenFroidurePin<E> instantiations
+# ============================================================================
+
+const FrozenFroidurePinTransf1 = LibSemigroups.FrozenFroidurePinTransf1
+const FrozenFroidurePinTransf2 = LibSemigroups.FrozenFroidurePinTransf2
+const FrozenFroidurePinTransf4 = LibSemigroups.FrozenFroidurePinTransf4
+
+const FrozenFroidurePinPPerm1 = LibSemigroups.FrozenFroidurePinPPerm1
+const FrozenFroidurePinPPerm2 = LibSemigroups.FrozenFroidurePinPPerm2
+const FrozenFroidurePinPPerm4 = LibSemigroups.FrozenFroidurePinPPerm4
+
+const FrozenFroidurePinPerm1 = LibSemigroups.FrozenFroidurePinPerm1
+const FrozenFroidurePinPerm2 = LibSemigroups.FrozenFroidurePinPerm2
+const FrozenFroidurePinPerm4 = LibSemigroups.FrozenFroidurePinPerm4
+
+const FrozenFroidurePinBMat8 = LibSemigroups.FrozenFroidurePinBMat8
+
+const _FrozenFroidurePinCxx = Union{
+    FrozenFroidurePinTransf1,
+    FrozenFroidurePinTransf2,
+    FrozenFroidurePinTransf4,
+    FrozenFroidurePinPPerm1,
+    FrozenFroidurePinPPerm2,
+    FrozenFroidurePinPPerm4,
+    FrozenFroidurePinPerm1,
+    FrozenFroidurePinPerm2,
+    FrozenFroidurePinPerm4,
+    FrozenFroidurePinBMat8,
+}
+
+# ============================================================================
+# Type dispatch helpers
+# ============================================================================
+
+_cxx_frozen_fp_type(::Type{Transf{UInt8}}) = FrozenFroidurePinTransf1
+_cxx_frozen_fp_type(::Type{Transf{UInt16}}) = FrozenFroidurePinTransf2
+_cxx_frozen_fp_type(::Type{Transf{UInt32}}) = FrozenFroidurePinTransf4
+
+_cxx_frozen_fp_type(::Type{PPerm{UInt8}}) = FrozenFroidurePinPPerm1
+_cxx_frozen_fp_type(::Type{PPerm{UInt16}}) = FrozenFroidurePinPPerm2
+_cxx_frozen_fp_type(::Type{PPerm{UInt32}}) = FrozenFroidurePinPPerm4
+
+_cxx_frozen_fp_type(::Type{Perm{UInt8}}) = FrozenFroidurePinPerm1
+_cxx_frozen_fp_type(::Type{Perm{UInt16}}) = FrozenFroidurePinPerm2
+_cxx_frozen_fp_type(::Type{Perm{UInt32}}) = FrozenFroidurePinPerm4
+
+_cxx_frozen_fp_type(::Type{T}) where {T<:BMat8} = FrozenFroidurePinBMat8
+
+# Indexed by the element code in the file header, see
+# deps/src/frozen-froidure-pin.hpp.
+const _FROZEN_ELEMENT_TYPES = (
+    Transf{UInt8},
+    Transf{UInt16},
+    Transf{UInt32},
+    PPerm{UInt8},
+    PPerm{UInt16},
+    PPerm{UInt32},
+    Perm{UInt8},
+    Perm{UInt16},
+    Perm{UInt32},
+    BMat8,
+)
+
+# ============================================================================
+# Saving and opening
+# ============================================================================
+
+"""
+    save_froidure_pin(fp::FroidurePin, path::AbstractString) -> String
+
+Fully enumerate `fp` and write it to the file `path`; return `path`.
+
+The file contains the elements, the left and right Cayley graphs, the
+prefix, suffix, first and final letter, and length of every element, the
+sorted order, and the positions of the idempotents. It can be opened with
+[`FrozenFroidurePin`](@ref Semigroups.FrozenFroidurePin) by any later
+process, on a machine with the same endianness.
+
+The file is written next to `path` and then renamed over it, so a process
+that dies while writing leaves any previous file intact.
+
+!!! note
+    This function triggers a full enumeration. If
+    [`save_threads(fp)`](@ref Semigroups.save_threads(::FroidurePin)) is
+    greater than `1` and `fp` has not started running, the enumeration is
+    done on that many threads, without enumerating `fp` itself, and the
+    file is the same as for one thread. If
+    [`compact_mode(fp)`](@ref Semigroups.compact_mode) is `true`, the file
+    has no left Cayley graph, see
+    [`compact_mode!`](@ref Semigroups.compact_mode!).
+
+# Throws
+
+- [`LibsemigroupsError`](@ref Semigroups.LibsemigroupsError) if the file
+  cannot be written.
+
+# Example
+```julia
+S = FroidurePin(Transf([2, 1, 3]), Transf([2, 3, 1]))
+save_froidure_pin(S, "s3.fp")
+F = FrozenFroidurePin("s3.fp")
+length(F)  # 6
+```
+"""
+function save_froidure_pin(fp::FroidurePin, path::AbstractString)
+    @wrap_libsemigroups_call LibSemigroups.save_froidure_pin(
+        fp.cxx_obj,
+        String(path),
+        UInt(save_threads(fp)),
+        compact_mode(fp),
+    )
+    return String(path)
+end
+
+"""
+    FrozenFroidurePin{E}
+
+A read-only, fully enumerated
+[`FroidurePin{E}`](@ref Semigroups.FroidurePin) backed by a file written
+by [`save_froidure_pin`](@ref Semigroups.save_froidure_pin).
+
+The file is memory-mapped when it is opened, and every query reads it in
+place: opening a file takes time independent of its size, no enumeration
+ever happens, and several processes opening the same file share its pages.
+Only the elements that are returned are constructed.
+
+A `FrozenFroidurePin{E}` supports [`length`](@ref Base.length), indexing,
+iteration, `in`, [`degree`](@ref Semigroups.degree),
+[`number_of_generators`](@ref Semigroups.number_of_generators),
+[`generator`](@ref Semigroups.generator),
+[`position`](@ref Semigroups.position(::FrozenFroidurePin{E}, ::E) where E),
+[`sorted_at`](@ref Semigroups.sorted_at),
+[`sorted_position`](@ref Semigroups.sorted_position),
+[`to_sorted_position`](@ref Semigroups.to_sorted_position),
+[`fast_product`](@ref Semigroups.fast_product),
+[`minimal_factorisation`](@ref Semigroups.minimal_factorisation),
+[`prefix`](@ref Semigroups.prefix), [`suffix`](@ref Semigroups.suffix),
+[`first_letter`](@ref Semigroups.first_letter),
+[`final_letter`](@ref Semigroups.final_letter),
+[`word_length`](@ref Semigroups.word_length),
+[`position_of_generator`](@ref Semigroups.position_of_generator),
+[`is_idempotent`](@ref Semigroups.is_idempotent),
+[`number_of_idempotents`](@ref Semigroups.number_of_idempotents) and
+[`idempotents`](@ref Semigroups.idempotents), all with the same meaning
+and 1-based indices as for `FroidurePin{E}`.
+
+# See also
+- [`FrozenFroidurePin(path)`](@ref Semigroups.FrozenFroidurePin(::AbstractString))
+"""
+struct FrozenFroidurePin{E}
+    cxx_obj::_FrozenFroidurePinCxx
+end
+
+"""
+    FrozenFroidurePin(path::AbstractString) -> FrozenFroidurePin{E}
+    FrozenFroidurePin{E}(path::AbstractString) -> FrozenFroidurePin{E}
+
+Open the file `path` written by
+[`save_froidure_pin`](@ref Semigroups.save_froidure_pin). The element type
+`E` is read from the file unless it is given.
+
+# Throws
+
+- [`LibsemigroupsError`](@ref Semigroups.LibsemigroupsError) if `path`
+  cannot be read, is not a FroidurePin file, was written by an unsupported
+  version, holds elements of a type other than `E`, or is truncated.
+"""
+function FrozenFroidurePin(path::AbstractString)
+    p = String(path)
+    LibSemigroups.FroidurePins.initialize()
+    code = @wrap_libsemigroups_call LibSemigroups.frozen_froidure_pin_element_code(p)
+    code in 1:length(_FROZEN_ELEMENT_TYPES) || throw(
+        LibsemigroupsError("FroidurePin $p: unknown element type $code"),
+    )
+    return FrozenFroidurePin{_FROZEN_ELEMENT_TYPES[code]}(p)
+end
+
+function FrozenFroidurePin{E}(path::AbstractString) where {E}
+    T = _cxx_frozen_fp_type(E)
+    LibSemigroups.FroidurePins.initialize()
+    cxx_obj = @wrap_libsemigroups_call T(String(path))
+    return FrozenFroidurePin{E}(cxx_obj)
+end
+
+# ============================================================================
+# Size queries
+# ============================================================================
+
+Base.length(fp::FrozenFroidurePin) = Int(LibSemigroups.size(fp.cxx_obj))
+
+degree(fp::FrozenFroidurePin) = Int(LibSemigroups.degree(fp.cxx_obj))
+
+number_of_generators(fp::FrozenFroidurePin) =
+    Int(LibSemigroups.number_of_generators(fp.cxx_obj))
+
+_has_left_cayley_graph(fp::FrozenFroidurePin) =
+    LibSemigroups.has_left_cayley_graph(fp.cxx_obj)
+
+number_of_idempotents(fp::FrozenFroidurePin) =
+    Int(LibSemigroups.number_of_idempotents(fp.cxx_obj))
+
+# ============================================================================
+# Element access and iteration
+# ============================================================================
+
+function Base.getindex(fp::FrozenFroidurePin{E}, i::Integer) where {E}
+    if i < 1 || i > length(fp)
+        throw(BoundsError(fp, i))
+    end
+    return _wrap_element(E, LibSemigroups.at(fp.cxx_obj, _to_cpp(i, UInt)))
+end
+
+function generator(fp::FrozenFroidurePin{E}, i::Integer) where {E}
+    idx = _to_cpp(i, UInt)
+    raw = @wrap_libsemigroups_call LibSemigroups.generator(fp.cxx_obj, idx)
+    return _wrap_element(E, raw)
+end
+
+function sorted_at(fp::FrozenFroidurePin{E}, i::Integer) where {E}
+    idx = _to_cpp(i, UInt)
+    raw = @wrap_libsemigroups_call LibSemigroups.sorted_at(fp.cxx_obj, idx)
+    return _wrap_element(E, raw)
+end
+
+function idempotents(fp::FrozenFroidurePin{E}) where {E}
+    raw = LibSemigroups.idempotents(fp.cxx_obj)
+    GC.@preserve raw begin
+        return E[_wrap_element(E, _copy_cxx_element(x)) for x in raw]
+    end
+end
+
+function Base.iterate(fp::FrozenFroidurePin, state::Int = 1)
+    state > length(fp) && return nothing
+    return (fp[state], state + 1)
+end
+
+Base.eltype(::Type{FrozenFroidurePin{E}}) where {E} = E
+
+Base.IteratorSize(::Type{<:FrozenFroidurePin}) = Base.HasLength()
+
+# ============================================================================
+# Positions
+# ============================================================================
+
+"""
+    position(fp::FrozenFroidurePin{E}, x::E) -> Union{Int, UNDEFINED}
+    position(fp::FrozenFroidurePin, w::AbstractVector{<:Integer}) -> Union{Int, UNDEFINED}
+
+Return the 1-based position of the element `x`, or of the element
+represented by the 1-based generator-index word `w`, in `fp`; or
+[`UNDEFINED`](@ref Semigroups.UNDEFINED) if there is no such element.
+
+The position of `x` is found by binary search in the sorted elements, in
+``O(d \\log n)`` time where ``d`` is the degree and ``n`` the size of
+`fp`; the position of `w` by following the right Cayley graph.
+
+# Throws
+
+- [`LibsemigroupsError`](@ref Semigroups.LibsemigroupsError) if a letter of
+  `w` is not the index of a generator.
+"""
+function position(fp::FrozenFroidurePin{E}, x::E) where {E}
+    return _from_cpp(LibSemigroups.position(fp.cxx_obj, _cxx_element(x)))
+end
+
+function position(fp::FrozenFroidurePin{BMat8}, x::BMat8)
+    return _from_cpp(LibSemigroups.position(fp.cxx_obj, _cxx_element(x)))
+end
+
+function position(fp::FrozenFroidurePin, w::AbstractVector{<:Integer})
+    cw = _word_to_cpp(w)
+    raw = @wrap_libsemigroups_call LibSemigroups.position(fp.cxx_obj, cw)
+    return _from_cpp(raw)
+end
+
+Base.in(x::E, fp::FrozenFroidurePin{E}) where {E} = position(fp, x) !== UNDEFINED
+Base.in(x::BMat8, fp::FrozenFroidurePin{BMat8}) = position(fp, x) !== UNDEFINED
+
+function sorted_position(fp::FrozenFroidurePin{E}, x::E) where {E}
+    return _from_cpp(LibSemigroups.sorted_position(fp.cxx_obj, _cxx_element(x)))
+end
+
+function sorted_position(fp::FrozenFroidurePin{BMat8}, x::BMat8)
+    return _from_cpp(LibSemigroups.sorted_position(fp.cxx_obj, _cxx_element(x)))
+end
+
+function to_sorted_position(fp::FrozenFroidurePin, i::Integer)
+    idx = _to_cpp(i, UInt)
+    raw = @wrap_libsemigroups_call LibSemigroups.to_sorted_position(fp.cxx_obj, idx)
+    return _from_cpp(raw)
+end
+
+function position_of_generator(fp::FrozenFroidurePin, i::Integer)
+    idx = _to_cpp(i, UInt)
+    raw = @wrap_libsemigroups_call LibSemigroups.position_of_generator(fp.cxx_obj, idx)
+    return _from_cpp(raw)
+end
+
+# ============================================================================
+# Products, factorisations and per-element data
+# ============================================================================
+
+"""
+    fast_product(fp::FrozenFroidurePin, i::Integer, j::Integer) -> Int
+
+Return the 1-based position of the product of the elements at 1-based
+positions `i` and `j`.
+
+The product is found by walking the shorter of the two minimal
+factorisations through the stored Cayley graph on the other side, so no
+elements are multiplied.
+
+# Throws
+
+- [`LibsemigroupsError`](@ref Semigroups.LibsemigroupsError) if `i` or `j`
+  is out of range.
+"""
+function fast_product(fp::FrozenFroidurePin, i::Integer, j::Integer)
+    ci = _to_cpp(i, UInt)
+    cj = _to_cpp(j, UInt)
+    raw = @wrap_libsemigroups_call LibSemigroups.fast_product(fp.cxx_obj, ci, cj)
+    return _from_cpp(raw)
+end
+
+function minimal_factorisation(fp::FrozenFroidurePin, i::Integer)
+    idx = _to_cpp(i, UInt)
+    raw = @wrap_libsemigroups_call LibSemigroups.minimal_factorisation(fp.cxx_obj, idx)
+    return _word_from_cpp(raw)
+end
+
+function prefix(fp::FrozenFroidurePin, i::Integer)
+    idx = _to_cpp(i, UInt)
+    raw = @wrap_libsemigroups_call LibSemigroups.prefix(fp.cxx_obj, idx)
+    return _from_cpp(raw)
+end
+
+function suffix(fp::FrozenFroidurePin, i::Integer)
+    idx = _to_cpp(i, UInt)
+    raw = @wrap_libsemigroups_call LibSemigroups.suffix(fp.cxx_obj, idx)
+    return _from_cpp(raw)
+end
+
+function first_letter(fp::FrozenFroidurePin, i::Integer)
+    idx = _to_cpp(i, UInt)
+    raw = @wrap_libsemigroups_call LibSemigroups.first_letter(fp.cxx_obj, idx)
+    return _from_cpp(raw)
+end
+
+function final_letter(fp::FrozenFroidurePin, i::Integer)
+    idx = _to_cpp(i, UInt)
+    raw = @wrap_libsemigroups_call LibSemigroups.final_letter(fp.cxx_obj, idx)
+    return _from_cpp(raw)
+end
+
+function word_length(fp::FrozenFroidurePin, i::Integer)
+    idx = _to_cpp(i, UInt)
+    return Int(@wrap_libsemigroups_call LibSemigroups.length(fp.cxx_obj, idx))
+end
+
+function is_idempotent(fp::FrozenFroidurePin, i::Integer)
+    idx = _to_cpp(i, UInt)
+    return @wrap_libsemigroups_call LibSemigroups.is_idempotent(fp.cxx_obj, idx)
+end
+
+# ============================================================================
+# Display
+# ============================================================================
+
+function Base.show(io::IO, fp::FrozenFroidurePin{E}) where {E}
+    print(
+        io,
+        "<frozen FroidurePin{",
+        E,
+        "} with ",
+        number_of_generators(fp),
+        " generators, ",
+        length(fp),
+        " elements, from \"",
+        LibSemigroups.path(fp.cxx_obj),
+        "\">",
+    )
+end
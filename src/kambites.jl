@@ -378,6 +378,8 @@ Base.copy(k::Kambites) = LibSemigroups.KambitesWord(k)
 
 Base.deepcopy_internal(k::Kambites, ::IdDict) = LibSemigroups.KambitesWord(k)
 
+_query_copies_args(k::Kambites) = _query_copies_args_by_copy(k)
+
 # ============================================================================
 # non_trivial_classes override (throws)
 # ============================================================================
@@ -409,7 +411,7 @@ end
 # ============================================================================
 
 """
-    normal_forms(k::Kambites, n::Integer) -> Vector{Vector{Int}}
+    normal_forms(k::Kambites, n::Integer) -> PackedWordVector
 
 Return the first `n` short-lex normal forms of the classes of the
 congruence represented by `k`, as 1-based `Vector{Int}` words.
@@ -428,7 +430,7 @@ materializes only the first `n` words and is safe to call.
 function normal_forms(k::Kambites, n::Integer)
     cpp_n = UInt(n)
     nf = @wrap_libsemigroups_call LibSemigroups.kambites_normal_forms_take(k, cpp_n)
-    return [_word_from_cpp(w) for w in nf]
+    return _packed_words(nf)
 end
 
 """
@@ -447,3 +449,118 @@ function normal_forms(k::Kambites)
         ),
     )
 end
+
+# ============================================================================
+# Resumable normal forms
+# ============================================================================
+
+"""
+    KambitesNormalForms(k::Kambites) -> KambitesNormalForms
+
+Return a range over the short-lex normal forms of the classes of `k`,
+positioned at the first.
+
+Unlike [`normal_forms(k, n)`](@ref Semigroups.normal_forms(::Kambites, ::Integer)),
+which starts from the first normal form on every call, the range keeps its
+place, so paging through the (infinite) normal forms with
+[`take!`](@ref Base.take!(::KambitesNormalForms, ::Integer)) or
+[`fill!`](@ref Base.fill!(::PackedWordBuffer, ::KambitesNormalForms))
+costs only the words taken by each page.
+
+The range refers to `k`, which must not be modified while the range is
+in use. Iterating the range advances it, as for
+[`WordRange`](@ref Semigroups.WordRange).
+
+# Throws
+
+- [`LibsemigroupsError`](@ref Semigroups.LibsemigroupsError) if
+  `small_overlap_class(k) < 4`.
+
+# Example
+```julia
+p = Presentation()
+set_alphabet!(p, 7)
+add_rule!(p, [1, 2, 3, 4], [1, 1, 1, 5, 1, 1])
+add_rule!(p, [5, 6], [4, 7])
+k = Kambites(twosided, p)
+r = KambitesNormalForms(k)
+first_page = take!(r, 100)
+second_page = take!(r, 100)   # the next 100, without recomputing the first
+```
+"""
+mutable struct KambitesNormalForms
+    k::Kambites
+    cxx::LibSemigroups.KambitesNormalFormsCxx
+end
+
+function KambitesNormalForms(k::Kambites)
+    @wrap_libsemigroups_call LibSemigroups.throw_if_not_C4(k)
+    cxx = @wrap_libsemigroups_call LibSemigroups.kambites_normal_forms(k)
+    return KambitesNormalForms(k, cxx)
+end
+
+"""
+    Base.get(r::KambitesNormalForms) -> Vector{Int}
+
+Return the current normal form of `r`, without advancing it.
+"""
+Base.get(r::KambitesNormalForms) = _word_from_cpp(LibSemigroups.get(r.cxx))
+
+"""
+    next!(r::KambitesNormalForms) -> KambitesNormalForms
+
+Advance `r` to its next normal form.
+"""
+next!(r::KambitesNormalForms) = (LibSemigroups.next!(r.cxx); r)
+
+"""
+    at_end(r::KambitesNormalForms) -> Bool
+
+Check whether `r` has no more normal forms.
+"""
+at_end(r::KambitesNormalForms) = LibSemigroups.at_end(r.cxx)
+
+"""
+    take!(r::KambitesNormalForms, n::Integer) -> PackedWordVector
+
+Remove the next `n` normal forms from `r` and return them, as a
+[`PackedWordVector`](@ref Semigroups.PackedWordVector) of 1-based words.
+
+# Throws
+- `ArgumentError`: if `n` is negative.
+"""
+function Base.take!(r::KambitesNormalForms, n::Integer)
+    GC.@preserve r begin
+        result = _take_words(r.cxx, n)
+    end
+    return result
+end
+
+"""
+    fill!(buf::PackedWordBuffer, r::KambitesNormalForms) -> PackedWordBuffer
+
+Overwrite `buf` with the next normal forms of `r`, for as long as they
+fit, and advance `r` past them. Unlike
+[`take!`](@ref Base.take!(::KambitesNormalForms, ::Integer)), this
+allocates nothing.
+
+# Throws
+- `ArgumentError`: if the next normal form of `r` is longer than the
+  letter capacity of `buf`.
+"""
+function Base.fill!(buf::PackedWordBuffer, r::KambitesNormalForms)
+    GC.@preserve r begin
+        _fill_buffer!(buf, r.cxx, () -> LibSemigroups.at_end(r.cxx))
+    end
+    return buf
+end
+
+Base.IteratorSize(::Type{KambitesNormalForms}) = Base.SizeUnknown()
+Base.eltype(::Type{KambitesNormalForms}) = Vector{Int}
+
+function Base.iterate(r::KambitesNormalForms, state = nothing)
+    at_end(r) && return nothing
+    w = Base.get(r)
+    next!(r)
+    return (w, nothing)
+end
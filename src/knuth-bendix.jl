@@ -41,8 +41,10 @@ presentation. The second form copies an existing `KnuthBendix`.
 - `LibsemigroupsError` if `p` has more than 256 letters in its alphabet
   (the internal rewriting trie uses 1-byte letter indices).
 
-!!! warning "v1 limitation"
-    v1 of Semigroups.jl binds `KnuthBendix{word_type, RewriteTrie}` only.
+!!! note
+    `KnuthBendix` is `KnuthBendix{word_type, RewriteTrie}` in libsemigroups.
+    See [`KnuthBendixRewriteFromLeft`](@ref
+    Semigroups.KnuthBendixRewriteFromLeft) for the other rewriter.
 
 # Example
 
@@ -70,11 +72,43 @@ run!(kb)
 number_of_active_rules(kb)              # 4
 number_of_pending_rules(kb)             # 0
 confluent(kb)                           # true
-number_of_classes(kb)                   # POSITIVE_INFINITY
+number_of_classes(kb)                        # POSITIVE_INFINITY
 ```
 """
 const KnuthBendix = LibSemigroups.KnuthBendixRewriteTrie
 
+"""
+    KnuthBendixRewriteFromLeft
+
+Type implementing the Knuth-Bendix completion algorithm using the
+`RewriteFromLeft` rewriter of libsemigroups, rather than the rewriting trie
+used by [`KnuthBendix`](@ref Semigroups.KnuthBendix).
+
+`RewriteFromLeft` rewrites a word by scanning it for left-hand sides from
+the left, and has no letter limit. Some presentations complete faster with
+it than with the trie. Every function documented for `KnuthBendix`, as
+well as [`save_checkpoint`](@ref Semigroups.save_checkpoint),
+[`run_async!`](@ref Semigroups.run_async!),
+[`CongruenceJob`](@ref Semigroups.CongruenceJob),
+[`CongruenceRace`](@ref Semigroups.CongruenceRace) and
+[`CompiledReducer`](@ref Semigroups.CompiledReducer), also accepts a
+`KnuthBendixRewriteFromLeft`. Only [`Congruence`](@ref
+Semigroups.Congruence), whose libsemigroups implementation runs the trie
+rewriter, does not. Use
+[`knuth_bendix`](@ref Semigroups.knuth_bendix) to select the rewriter by
+keyword.
+"""
+const KnuthBendixRewriteFromLeft = LibSemigroups.KnuthBendixRewriteFromLeft
+
+const _KnuthBendixAny = Union{KnuthBendix,KnuthBendixRewriteFromLeft}
+
+_query_copies_args(kb::_KnuthBendixAny) = _query_copies_args_by_copy(kb)
+
+const _KNUTH_BENDIX_REWRITERS =
+    (trie = KnuthBendix, from_left = KnuthBendixRewriteFromLeft)
+
+const _KNUTH_BENDIX_ORDERS = (:shortlex,)
+
 """
     overlap_ABC
 
@@ -136,12 +170,12 @@ from `kind` and `p`.
     At present it is only possible to create `KnuthBendix` objects from
     presentations with at most 256 letters in the alphabet.
 """
-function init!(kb::KnuthBendix)
+function init!(kb::_KnuthBendixAny)
     @wrap_libsemigroups_call LibSemigroups.init!(kb)
     return kb
 end
 
-function init!(kb::KnuthBendix, kind::congruence_kind, p::Presentation)
+function init!(kb::_KnuthBendixAny, kind::congruence_kind, p::Presentation)
     @wrap_libsemigroups_call LibSemigroups.init!(kb, kind, p)
     return kb
 end
@@ -163,7 +197,7 @@ default value is `128`. Set to `1` to process each rule immediately.
 
 [`max_pending_rules!`](@ref Semigroups.max_pending_rules!)
 """
-max_pending_rules(kb::KnuthBendix) = Int(LibSemigroups.max_pending_rules(kb))
+max_pending_rules(kb::_KnuthBendixAny) = Int(LibSemigroups.max_pending_rules(kb))
 
 """
     max_pending_rules!(kb::KnuthBendix, n::Integer) -> KnuthBendix
@@ -178,7 +212,7 @@ to `1` to process each new rule immediately as it is created.
 
 [`max_pending_rules`](@ref Semigroups.max_pending_rules)
 """
-function max_pending_rules!(kb::KnuthBendix, n::Integer)
+function max_pending_rules!(kb::_KnuthBendixAny, n::Integer)
     LibSemigroups.set_max_pending_rules!(kb, UInt(n))
     return kb
 end
@@ -197,7 +231,7 @@ checked mid-run.
 [`check_confluence_interval!`](@ref Semigroups.check_confluence_interval!),
 [`run!`](@ref Semigroups.run!)
 """
-check_confluence_interval(kb::KnuthBendix) =
+check_confluence_interval(kb::_KnuthBendixAny) =
     Int(LibSemigroups.check_confluence_interval(kb))
 
 """
@@ -215,7 +249,7 @@ default is `4096`. Set to `LIMIT_MAX` to disable mid-run confluence checks.
 [`check_confluence_interval`](@ref Semigroups.check_confluence_interval),
 [`run!`](@ref Semigroups.run!)
 """
-function check_confluence_interval!(kb::KnuthBendix, n::Integer)
+function check_confluence_interval!(kb::_KnuthBendixAny, n::Integer)
     LibSemigroups.set_check_confluence_interval!(kb, UInt(n))
     return kb
 end
@@ -234,7 +268,7 @@ system being confluent.
 
 [`max_overlap!`](@ref Semigroups.max_overlap!)
 """
-max_overlap(kb::KnuthBendix) = Int(LibSemigroups.max_overlap(kb))
+max_overlap(kb::_KnuthBendixAny) = Int(LibSemigroups.max_overlap(kb))
 
 """
     max_overlap!(kb::KnuthBendix, n::Integer) -> KnuthBendix
@@ -249,7 +283,7 @@ rule, `run!` may terminate without producing a confluent system.
 
 [`max_overlap`](@ref Semigroups.max_overlap), [`run!`](@ref Semigroups.run!)
 """
-function max_overlap!(kb::KnuthBendix, n::Integer)
+function max_overlap!(kb::_KnuthBendixAny, n::Integer)
     LibSemigroups.set_max_overlap!(kb, UInt(n))
     return kb
 end
@@ -268,7 +302,7 @@ default is `POSITIVE_INFINITY`.
 
 [`max_rules!`](@ref Semigroups.max_rules!)
 """
-max_rules(kb::KnuthBendix) = Int(LibSemigroups.max_rules(kb))
+max_rules(kb::_KnuthBendixAny) = Int(LibSemigroups.max_rules(kb))
 
 """
     max_rules!(kb::KnuthBendix, n::Integer) -> KnuthBendix
@@ -284,7 +318,7 @@ terminate early and the system may not be confluent. The default is
 
 [`max_rules`](@ref Semigroups.max_rules), [`run!`](@ref Semigroups.run!)
 """
-function max_rules!(kb::KnuthBendix, n::Integer)
+function max_rules!(kb::_KnuthBendixAny, n::Integer)
     LibSemigroups.set_max_rules!(kb, UInt(n))
     return kb
 end
@@ -303,7 +337,7 @@ Semigroups.overlap_ABC), [`overlap_AB_BC`](@ref Semigroups.overlap_AB_BC), and
 
 [`overlap_policy!`](@ref Semigroups.overlap_policy!)
 """
-overlap_policy(kb::KnuthBendix) = LibSemigroups.overlap_policy(kb)
+overlap_policy(kb::_KnuthBendixAny) = LibSemigroups.overlap_policy(kb)
 
 """
     overlap_policy!(kb::KnuthBendix, val) -> KnuthBendix
@@ -319,7 +353,7 @@ Semigroups.overlap_ABC), [`overlap_AB_BC`](@ref Semigroups.overlap_AB_BC), or
 
 [`overlap_policy`](@ref Semigroups.overlap_policy)
 """
-function overlap_policy!(kb::KnuthBendix, val)
+function overlap_policy!(kb::_KnuthBendixAny, val)
     LibSemigroups.set_overlap_policy!(kb, val)
     return kb
 end
@@ -340,7 +374,7 @@ Knuth-Bendix algorithm runs.
 
 Constant.
 """
-number_of_active_rules(kb::KnuthBendix) = Int(LibSemigroups.number_of_active_rules(kb))
+number_of_active_rules(kb::_KnuthBendixAny) = Int(LibSemigroups.number_of_active_rules(kb))
 
 """
     number_of_inactive_rules(kb::KnuthBendix) -> Int
@@ -354,7 +388,8 @@ used for rewriting.
 
 Constant.
 """
-number_of_inactive_rules(kb::KnuthBendix) = Int(LibSemigroups.number_of_inactive_rules(kb))
+number_of_inactive_rules(kb::_KnuthBendixAny) =
+    Int(LibSemigroups.number_of_inactive_rules(kb))
 
 """
     number_of_pending_rules(kb::KnuthBendix) -> Int
@@ -370,7 +405,8 @@ when a `KnuthBendix` is constructed.
 
 Constant.
 """
-number_of_pending_rules(kb::KnuthBendix) = Int(LibSemigroups.number_of_pending_rules(kb))
+number_of_pending_rules(kb::_KnuthBendixAny) =
+    Int(LibSemigroups.number_of_pending_rules(kb))
 
 """
     total_rules(kb::KnuthBendix) -> Int
@@ -387,7 +423,7 @@ because rules are re-initialized and reused where possible.
 
 Constant.
 """
-total_rules(kb::KnuthBendix) = Int(LibSemigroups.total_rules(kb))
+total_rules(kb::_KnuthBendixAny) = Int(LibSemigroups.total_rules(kb))
 
 """
     confluent(kb::KnuthBendix) -> Bool
@@ -398,7 +434,7 @@ Returns `true` if the current rules are confluent, `false` otherwise. This
 function does not trigger a run; call [`run!`](@ref Semigroups.run!) first to
 ensure the system has been fully processed.
 """
-confluent(kb::KnuthBendix) = LibSemigroups.confluent(kb)
+confluent(kb::_KnuthBendixAny) = LibSemigroups.confluent(kb)
 
 """
     confluent_known(kb::KnuthBendix) -> Bool
@@ -408,7 +444,7 @@ Return `true` if the confluence status of the current rules is already known.
 Reports whether [`confluent`](@ref Semigroups.confluent) would return a
 definitive answer without running further. Does not trigger a run.
 """
-confluent_known(kb::KnuthBendix) = LibSemigroups.confluent_known(kb)
+confluent_known(kb::_KnuthBendixAny) = LibSemigroups.confluent_known(kb)
 
 """
     number_of_classes(kb::KnuthBendix) -> UInt64
@@ -431,7 +467,7 @@ number of nodes in the Gilman graph.
 [`gilman_graph`](@ref Semigroups.gilman_graph),
 [`normal_forms`](@ref Semigroups.normal_forms)
 """
-number_of_classes(kb::KnuthBendix) = LibSemigroups.number_of_classes(kb)
+number_of_classes(kb::_KnuthBendixAny) = LibSemigroups.number_of_classes(kb)
 
 """
     kind(kb::KnuthBendix) -> congruence_kind
@@ -445,7 +481,7 @@ Semigroups.congruence_kind) for details.
 
 Constant.
 """
-kind(kb::KnuthBendix) = LibSemigroups.kind(kb)
+kind(kb::_KnuthBendixAny) = LibSemigroups.kind(kb)
 
 """
     number_of_generating_pairs(kb::KnuthBendix) -> Int
@@ -459,7 +495,7 @@ Semigroups.generating_pairs) divided by 2.
 
 Constant.
 """
-number_of_generating_pairs(kb::KnuthBendix) =
+number_of_generating_pairs(kb::_KnuthBendixAny) =
     Int(LibSemigroups.number_of_generating_pairs(kb))
 
 """
@@ -477,7 +513,7 @@ letter indices.
     alphabet contains one extra letter required by the algorithm. This extra
     letter may appear in the returned words.
 """
-function generating_pairs(kb::KnuthBendix)
+function generating_pairs(kb::_KnuthBendixAny)
     flat = LibSemigroups.generating_pairs(kb)
     result = Tuple{Vector{Int},Vector{Int}}[]
     for i = 1:2:length(flat)
@@ -499,7 +535,7 @@ Return a copy of the presentation used by `kb`.
     required by the algorithm. This extra letter also appears in the output of
     [`active_rules`](@ref Semigroups.active_rules).
 """
-presentation(kb::KnuthBendix) = LibSemigroups.presentation(kb)
+presentation(kb::_KnuthBendixAny) = LibSemigroups.presentation(kb)
 
 # ============================================================================
 # Rules access
@@ -512,13 +548,80 @@ Return all active rules as a vector of `(lhs, rhs)` tuples.
 
 Words are returned as 1-based `Vector{Int}` letter indices.
 """
-function active_rules(kb::KnuthBendix)
+function active_rules(kb::_KnuthBendixAny)
     flat = @wrap_libsemigroups_call LibSemigroups.kb_active_rules(kb)
-    result = Tuple{Vector{Int},Vector{Int}}[]
-    for i = 1:2:length(flat)
-        push!(result, (_word_from_cpp(flat[i]), _word_from_cpp(flat[i+1])))
+    return _packed_rules(tuple, flat)
+end
+
+# ============================================================================
+# Rebuilding with more rules
+# ============================================================================
+
+"""
+    rebuild_with_rules!(kb::KnuthBendix, rules) -> NamedTuple
+
+Add `rules` to the presentation of `kb` and run Knuth-Bendix to completion
+from scratch.
+
+This is a convenience for adding relations a few at a time, not incremental
+completion: libsemigroups cannot add rules to a `KnuthBendix` that has
+started, so `kb` is replaced by one with the same settings and generating
+pairs, whose [`presentation`](@ref Semigroups.presentation) is that of `kb`
+followed by `rules`. Nothing is kept from any previous run of `kb`, so the
+cost is that of completing the enlarged presentation anew, however few rules
+are added. Unlike [`add_generating_pair!`](@ref
+Semigroups.add_generating_pair!), this may be called after `kb` has been
+run, and any number of times.
+
+Each element of `rules` is a pair `(lhs, rhs)` or `lhs => rhs` of words of
+1-based letter indices.
+
+Return a named tuple `(removed, added)` of vectors of `(lhs, rhs)` tuples:
+`removed` holds the [`active_rules`](@ref Semigroups.active_rules) of `kb`
+before the call that are not active after it, and `added` those active after
+it that were not active before. If `kb` was confluent before the call, a
+normal form computed with the previous rules is no longer a normal form if
+and only if it contains the left-hand side of a rule in `added`.
+
+# Throws
+
+- `LibsemigroupsError` if [`kind`](@ref Semigroups.kind)`(kb)` is not
+  `twosided`.
+- `LibsemigroupsError` if a word in `rules` contains a letter not in the
+  alphabet of `kb`.
+
+!!! warning
+    This function will not return until `kb` is confluent, which may never
+    happen.
+
+# Example
+
+```julia
+p = Presentation()
+set_alphabet!(p, 2)
+add_rule!(p, [1, 1, 1], [1])
+add_rule!(p, [2, 2], [2])
+kb = KnuthBendix(twosided, p)
+number_of_classes(kb)                        # POSITIVE_INFINITY
+rebuild_with_rules!(kb, [[1, 2] => [2, 1]])
+# (removed = Tuple{Vector{Int}, Vector{Int}}[], added = [([2, 1], [1, 2])])
+number_of_classes(kb)                        # 5
+```
+"""
+function rebuild_with_rules!(kb::_KnuthBendixAny, rules::AbstractVector)
+    words = Vector{Int}[]
+    for rule in rules
+        push!(words, collect(Int, first(rule)), collect(Int, last(rule)))
     end
-    return result
+    letters, offsets = _pack_words(words)
+    before = active_rules(kb)
+    @wrap_libsemigroups_call LibSemigroups.kb_rebuild_with_rules!(kb, letters, offsets)
+    after = active_rules(kb)
+    before_set, after_set = Set(before), Set(after)
+    return (
+        removed = filter(r -> !(r in after_set), before),
+        added = filter(r -> !(r in before_set), after),
+    )
 end
 
 # ============================================================================
@@ -545,24 +648,24 @@ acyclic.
 [`number_of_classes`](@ref Semigroups.number_of_classes),
 [`normal_forms`](@ref Semigroups.normal_forms)
 """
-@cxxdereference gilman_graph(kb::KnuthBendix) = LibSemigroups.gilman_graph(kb)
+@cxxdereference gilman_graph(kb::_KnuthBendixAny) = LibSemigroups.gilman_graph(kb)
 
 """
-    gilman_graph_node_labels(kb::KnuthBendix) -> Vector{Vector{Int}}
+    gilman_graph_node_labels(kb::KnuthBendix) -> PackedWordVector
 
 Return the node labels of the Gilman graph as 1-based words.
 
 Each label corresponds to a unique prefix of the left-hand sides of the rules
-in the rewriting system. Words are returned as 1-based `Vector{Int}` letter
-indices.
+in the rewriting system. Words are returned as a
+[`PackedWordVector`](@ref Semigroups.PackedWordVector) of 1-based
+`Vector{Int}` letter indices.
 
 # See also
 
 [`gilman_graph`](@ref Semigroups.gilman_graph)
 """
-@cxxdereference function gilman_graph_node_labels(kb::KnuthBendix)
-    labels = LibSemigroups.gilman_graph_node_labels(kb)
-    return [_word_from_cpp(w) for w in labels]
+@cxxdereference function gilman_graph_node_labels(kb::_KnuthBendixAny)
+    return _packed_words(LibSemigroups.gilman_graph_node_labels(kb))
 end
 
 # ============================================================================
@@ -575,14 +678,14 @@ end
 Return the number of congruence classes. Equivalent to
 [`number_of_classes`](@ref Semigroups.number_of_classes).
 """
-Base.length(kb::KnuthBendix) = number_of_classes(kb)
+Base.length(kb::_KnuthBendixAny) = number_of_classes(kb)
 
 """
     Base.show(io::IO, kb::KnuthBendix)
 
 Print a human-readable representation of `kb`.
 """
-function Base.show(io::IO, kb::KnuthBendix)
+function Base.show(io::IO, kb::_KnuthBendixAny)
     print(io, LibSemigroups.to_human_readable_repr(kb))
 end
 
@@ -592,8 +695,9 @@ end
 Create an independent copy of `kb`.
 """
 Base.copy(kb::KnuthBendix) = LibSemigroups.KnuthBendixRewriteTrie(kb)
+Base.copy(kb::KnuthBendixRewriteFromLeft) = LibSemigroups.KnuthBendixRewriteFromLeft(kb)
 
-Base.deepcopy_internal(kb::KnuthBendix, ::IdDict) = LibSemigroups.KnuthBendixRewriteTrie(kb)
+Base.deepcopy_internal(kb::_KnuthBendixAny, ::IdDict) = copy(kb)
 
 # ============================================================================
 # Free functions
@@ -617,7 +721,7 @@ Semigroups.overlap_policy)) before those of length ``n + 1``. Returns `kb`.
 [`run!`](@ref Semigroups.run!),
 [`overlap_policy!`](@ref Semigroups.overlap_policy!)
 """
-function by_overlap_length!(kb::KnuthBendix)
+function by_overlap_length!(kb::_KnuthBendixAny)
     @wrap_libsemigroups_call LibSemigroups.kb_by_overlap_length!(kb)
     return kb
 end
@@ -631,7 +735,111 @@ Returns `true` if for each pair of rules ``(A, B)`` and ``(C, D)`` in `kb`,
 the word ``C`` is neither a subword of ``A`` nor of ``B``. Returns `false`
 otherwise.
 """
-is_reduced(kb::KnuthBendix) = @wrap_libsemigroups_call LibSemigroups.kb_is_reduced(kb)
+is_reduced(kb::_KnuthBendixAny) = @wrap_libsemigroups_call LibSemigroups.kb_is_reduced(kb)
+
+"""
+    knuth_bendix(kind::congruence_kind, p::Presentation;
+                 rewriter::Symbol = :trie, order::Symbol = :shortlex)
+
+Construct a Knuth-Bendix object for `kind` and `p` with the rewriter and
+reduction order selected by keyword.
+
+`rewriter` is `:trie`, which returns a [`KnuthBendix`](@ref
+Semigroups.KnuthBendix), or `:from_left`, which returns a
+[`KnuthBendixRewriteFromLeft`](@ref Semigroups.KnuthBendixRewriteFromLeft).
+`order` must be `:shortlex`.
+
+!!! note
+    The rewriters of libsemigroups orient every new rule by the shortlex
+    order, so no other reduction order is available. To compare words in
+    another order, use [`weighted_shortlex_less`](@ref
+    Semigroups.weighted_shortlex_less) or [`recursive_path_less`](@ref
+    Semigroups.recursive_path_less).
+
+# Throws
+- `ArgumentError`: if `rewriter` or `order` is not one of the values above.
+- `LibsemigroupsError`: if `p` is not valid.
+
+# Example
+```julia
+kb = knuth_bendix(twosided, p; rewriter = :from_left)
+run!(kb)
+```
+"""
+function knuth_bendix(
+    kind::congruence_kind,
+    p::Presentation;
+    rewriter::Symbol = :trie,
+    order::Symbol = :shortlex,
+)
+    haskey(_KNUTH_BENDIX_REWRITERS, rewriter) || throw(
+        ArgumentError(
+            "expected rewriter to be one of $(keys(_KNUTH_BENDIX_REWRITERS)), " *
+            "found :$rewriter",
+        ),
+    )
+    order in _KNUTH_BENDIX_ORDERS || throw(
+        ArgumentError(
+            "expected order to be one of $(_KNUTH_BENDIX_ORDERS), found :$order",
+        ),
+    )
+    T = _KNUTH_BENDIX_REWRITERS[rewriter]
+    return @wrap_libsemigroups_call T(kind, p)
+end
+
+"""
+    benchmark_knuth_bendix(kind::congruence_kind, p::Presentation;
+                           timeout::Union{TimePeriod,Nothing} = nothing)
+        -> Vector{NamedTuple}
+
+Run Knuth-Bendix on `kind` and `p` once for every rewriter and reduction
+order accepted by [`knuth_bendix`](@ref Semigroups.knuth_bendix), and
+report how each one did.
+
+Each entry of the result has the fields `rewriter`, `order`, `seconds`
+(the time spent running), `finished` (whether the run completed within
+`timeout`), and `number_of_active_rules` (the number of active rules when
+the run stopped). If `timeout` is `nothing`, every run is left to
+complete, which may never happen.
+
+# Example
+```julia
+for r in benchmark_knuth_bendix(twosided, p; timeout = Second(1))
+    println(r.rewriter, ": ", r.seconds, "s, ", r.number_of_active_rules, " rules")
+end
+```
+"""
+function benchmark_knuth_bendix(
+    kind::congruence_kind,
+    p::Presentation;
+    timeout::Union{TimePeriod,Nothing} = nothing,
+)
+    results = NamedTuple{
+        (:rewriter, :order, :seconds, :finished, :number_of_active_rules),
+        Tuple{Symbol,Symbol,Float64,Bool,Int},
+    }[]
+    for rewriter in keys(_KNUTH_BENDIX_REWRITERS), order in _KNUTH_BENDIX_ORDERS
+        kb = knuth_bendix(kind, p; rewriter = rewriter, order = order)
+        start = time_ns()
+        if timeout === nothing
+            run!(kb)
+        else
+            run_for!(kb, timeout)
+        end
+        seconds = (time_ns() - start) / 1e9
+        push!(
+            results,
+            (
+                rewriter = rewriter,
+                order = order,
+                seconds = seconds,
+                finished = finished(kb),
+                number_of_active_rules = number_of_active_rules(kb),
+            ),
+        )
+    end
+    return results
+end
 
 """
     redundant_rule(p::Presentation, timeout::TimePeriod) -> Union{Int, Nothing}
@@ -667,3 +875,145 @@ function redundant_rule(p::Presentation, timeout::TimePeriod)
     # Convert from 0-based flat index to 1-based rule-pair index
     return div(Int(idx), 2) + 1
 end
+
+# ============================================================================
+# Compiled reducer
+# ============================================================================
+
+"""
+    CompiledReducer
+
+The rules of a confluent [`KnuthBendix`](@ref Semigroups.KnuthBendix)
+compiled into a flat automaton, for reducing many words against a fixed
+rewriting system.
+
+The automaton is the Aho-Corasick automaton of the left-hand sides of the
+active rules: one transition table with a row per state and a column per
+letter. A word is reduced in a single left-to-right scan, stepping back
+over each left-hand side found and reading its right-hand side in its
+place, with no allocation per step. The result is the same normal form as
+[`reduce`](@ref Semigroups.reduce(::CongruenceCommon, ::AbstractVector{<:Integer}))
+on the `KnuthBendix`.
+
+A `CompiledReducer` does not refer to the `KnuthBendix` it was built from,
+and never changes, so it may be used from several threads at once.
+
+# Constructor
+
+    CompiledReducer(kb::Union{KnuthBendix,KnuthBendixRewriteFromLeft}) -> CompiledReducer
+
+Run `kb` to completion and compile its active rules.
+
+# Throws
+- `LibsemigroupsError`: if `kb` is not a 2-sided congruence, or if it stops
+  without becoming confluent (for example because of
+  [`max_overlap!`](@ref Semigroups.max_overlap!)).
+
+!!! warning
+    This function triggers a full enumeration of `kb`, which may never
+    terminate.
+
+# Example
+```julia
+kb = KnuthBendix(twosided, p)
+r = CompiledReducer(kb)
+Semigroups.reduce(r, [2, 1, 2])
+batch_reduce(r, words; nthreads = 4)
+```
+"""
+const CompiledReducer = LibSemigroups.CompiledReducer
+
+function CompiledReducer(kb::_KnuthBendixAny)
+    return @wrap_libsemigroups_call LibSemigroups.kb_compiled_reducer(kb)
+end
+
+"""
+    number_of_rules(r::CompiledReducer) -> Int
+
+Return the number of rules compiled into `r`.
+"""
+number_of_rules(r::CompiledReducer) = Int(LibSemigroups.number_of_rules(r))
+
+"""
+    memory_usage(r::CompiledReducer) -> Int
+
+Return the number of bytes used by the transition table and the rules of
+`r`.
+"""
+memory_usage(r::CompiledReducer) = Int(LibSemigroups.memory_usage(r))
+
+"""
+    reduce(r::CompiledReducer, w::AbstractVector{<:Integer}) -> Vector{Int}
+
+Return the normal form of the word `w`, a 1-based `Vector{Int}` of letter
+indices, under the rules compiled into `r`.
+
+# Throws
+- `LibsemigroupsError`: if any letter of `w` is not in the alphabet.
+"""
+function reduce(r::CompiledReducer, w::AbstractVector{<:Integer})
+    result = @wrap_libsemigroups_call LibSemigroups.reduce(r, _word_to_cpp(w))
+    return _word_from_cpp(result)
+end
+
+"""
+    contains(r::CompiledReducer, u::AbstractVector{<:Integer},
+             v::AbstractVector{<:Integer}) -> Bool
+
+Check whether the words `u` and `v` have the same normal form under the
+rules compiled into `r`.
+
+# Throws
+- `LibsemigroupsError`: if any letter of `u` or `v` is not in the
+  alphabet.
+"""
+function contains(
+    r::CompiledReducer,
+    u::AbstractVector{<:Integer},
+    v::AbstractVector{<:Integer},
+)
+    return reduce(r, u) == reduce(r, v)
+end
+
+"""
+    batch_reduce(r::CompiledReducer, words; nthreads::Integer = 1) -> PackedWordVector
+
+Reduce every word in `words` under the rules compiled into `r`, in one call
+across the C++ boundary, splitting the words between at most `nthreads`
+threads.
+
+The result is a [`PackedWordVector`](@ref Semigroups.PackedWordVector) in
+the same order as `words`. Passing a `PackedWordVector` as `words` avoids
+repacking it.
+
+# Throws
+- `LibsemigroupsError`: if any letter of any word is not in the alphabet.
+- `InexactError`: if any letter is zero or negative.
+"""
+function batch_reduce(
+    r::CompiledReducer,
+    words::AbstractVector{<:AbstractVector{<:Integer}};
+    nthreads::Integer = 1,
+)
+    letters, offsets = _pack_words(words)
+    result = @wrap_libsemigroups_call LibSemigroups.reduce_batch(
+        r,
+        letters,
+        offsets,
+        UInt(nthreads),
+    )
+    return _packed_words(result)
+end
+
+function Base.show(io::IO, r::CompiledReducer)
+    print(
+        io,
+        "<compiled reducer with ",
+        LibSemigroups.number_of_letters(r),
+        " letters, ",
+        number_of_rules(r),
+        " rules and ",
+        LibSemigroups.number_of_states(r),
+        " states>",
+    )
+end
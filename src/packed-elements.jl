@@ -0,0 +1,430 @@
+# Copyright (c) 2026, James W. Swent
+#
+# Distributed under the terms of the GPL license version 3.
+#
+# The full license is in the file LICENSE, distributed with this software.
+
+"""
+packed-elements.jl - contiguous element buffers and batched products
+
+A `PackedElementVector{E}` stores many elements of one type and degree in a
+single matrix of raw images, one column per element, so that batched
+kernels such as [`batch_multiply!`](@ref Semigroups.batch_multiply!) read
+and write them in place with one call into the C++ library, instead of one
+call and one allocation per product.
+"""
+
+# ============================================================================
+# Storage helpers
+# ============================================================================
+
+const _PTransfElement = Union{Transf,PPerm,Perm}
+
+_packed_scalar_type(::Type{Transf{T}}) where {T} = T
+_packed_scalar_type(::Type{PPerm{T}}) where {T} = T
+_packed_scalar_type(::Type{Perm{T}}) where {T} = T
+_packed_scalar_type(::Type{<:BMat8}) = UInt64
+
+_packed_width(::Type{<:_PTransfElement}, degree::Int) = degree
+_packed_width(::Type{<:BMat8}, ::Int) = 1
+
+_packed_cxx_type(::Type{Transf{T}}) where {T} = _transf_type_from_scalar_type(T)
+_packed_cxx_type(::Type{PPerm{T}}) where {T} = _pperm_type_from_scalar_type(T)
+_packed_cxx_type(::Type{Perm{T}}) where {T} = _perm_type_from_scalar_type(T)
+
+_packed_degree(x::_PTransfElement) = degree(x)
+_packed_degree(::BMat8) = 8
+
+# ============================================================================
+# PackedElementVector
+# ============================================================================
+
+"""
+    PackedElementVector{E} <: AbstractVector{E}
+
+A vector of elements of type `E`, all of the same degree, stored in one
+contiguous matrix.
+
+`E` is one of [`Transf{T}`](@ref Semigroups.Transf),
+[`PPerm{T}`](@ref Semigroups.PPerm), [`Perm{T}`](@ref Semigroups.Perm) or
+[`BMat8`](@ref Semigroups.BMat8). The field `images` holds one column per
+element: the raw images of a transformation, partial permutation or
+permutation (0-based, with `typemax(T)` for an undefined point, as
+libsemigroups stores them), or the [`to_int`](@ref Semigroups.to_int)
+value of a `BMat8`. The field `degree` is the common degree of the
+elements.
+
+Indexing constructs the element in that position; assigning an element
+writes its images into the matrix. Batched kernels such as
+[`batch_multiply!`](@ref Semigroups.batch_multiply!) work on the matrix
+directly.
+
+# Example
+```julia
+xs = PackedElementVector([Transf([2, 1, 3]), Transf([2, 3, 1])])
+xs.images        # 3×2 Matrix{UInt8}: [1 1; 0 2; 2 0]
+xs[2]            # Transf([2, 3, 1])
+```
+"""
+struct PackedElementVector{E,S} <: AbstractVector{E}
+    degree::Int
+    images::Matrix{S}
+
+    function PackedElementVector{E,S}(degree::Integer, images::Matrix{S}) where {E,S}
+        size(images, 1) == _packed_width(E, Int(degree)) || throw(
+            ArgumentError(
+                "expected $(_packed_width(E, Int(degree))) rows of images, " *
+                "found $(size(images, 1))",
+            ),
+        )
+        return new{E,S}(Int(degree), images)
+    end
+end
+
+"""
+    PackedElementVector(xs::AbstractVector{E}) -> PackedElementVector{E}
+    PackedElementVector{E}(undef, degree::Integer, n::Integer) -> PackedElementVector{E}
+
+Pack the elements `xs`, or allocate room for `n` elements of type `E`
+and degree `degree` whose images are not initialised.
+
+# Throws
+- `ArgumentError`: if `xs` is empty, or its elements do not all have the
+  same degree.
+"""
+function PackedElementVector(xs::AbstractVector{E}) where {E}
+    isempty(xs) && throw(ArgumentError("cannot infer the degree of no elements"))
+    NE = _fp_element_type(E)
+    p = PackedElementVector{NE}(undef, _packed_degree(first(xs)), length(xs))
+    for (j, x) in enumerate(xs)
+        p[j] = x
+    end
+    return p
+end
+
+function PackedElementVector{E}(::UndefInitializer, degree::Integer, n::Integer) where {E}
+    S = _packed_scalar_type(E)
+    images = Matrix{S}(undef, _packed_width(E, Int(degree)), n)
+    return PackedElementVector{E,S}(degree, images)
+end
+
+Base.size(p::PackedElementVector) = (size(p.images, 2),)
+
+Base.IndexStyle(::Type{<:PackedElementVector}) = IndexLinear()
+
+degree(p::PackedElementVector) = p.degree
+
+function Base.similar(p::PackedElementVector{E,S}) where {E,S}
+    return PackedElementVector{E,S}(p.degree, similar(p.images))
+end
+
+function Base.similar(p::PackedElementVector{E,S}, n::Integer) where {E,S}
+    return PackedElementVector{E,S}(p.degree, similar(p.images, size(p.images, 1), n))
+end
+
+function Base.getindex(p::PackedElementVector{E,S}, j::Int) where {E<:_PTransfElement,S}
+    @boundscheck checkbounds(p, j)
+    raw = @wrap_libsemigroups_call _packed_cxx_type(E)(StdVector{S}(p.images[:, j]))
+    return _wrap_element(E, raw)
+end
+
+function Base.getindex(p::PackedElementVector{BMat8}, j::Int)
+    @boundscheck checkbounds(p, j)
+    return BMat8(p.images[1, j])
+end
+
+function Base.setindex!(p::PackedElementVector{E}, x::E, j::Int) where {E<:_PTransfElement}
+    @boundscheck checkbounds(p, j)
+    degree(x) == p.degree || throw(
+        ArgumentError("expected an element of degree $(p.degree), found $(degree(x))"),
+    )
+    raw = LibSemigroups.images_vector(x.cxx_obj)
+    GC.@preserve raw begin
+        copyto!(view(p.images, :, j), raw)
+    end
+    return p
+end
+
+function Base.setindex!(p::PackedElementVector{BMat8}, x::BMat8, j::Int)
+    @boundscheck checkbounds(p, j)
+    p.images[1, j] = to_int(x)
+    return p
+end
+
+# ============================================================================
+# Batched products
+# ============================================================================
+
+_as_packed(p::PackedElementVector{E}, ::Type{E}) where {E} = p
+_as_packed(x, ::Type{E}) where {E} = PackedElementVector(E[x])
+
+function _batch_multiply_cxx!(
+    out::PackedElementVector{E},
+    xs,
+    ys,
+) where {E<:_PTransfElement}
+    xs.degree == ys.degree == out.degree || throw(
+        ArgumentError(
+            "expected elements of equal degree, found " *
+            "$(out.degree), $(xs.degree) and $(ys.degree)",
+        ),
+    )
+    @wrap_libsemigroups_call LibSemigroups.batch_multiply!(
+        vec(out.images),
+        vec(xs.images),
+        vec(ys.images),
+        UInt(out.degree),
+    )
+    return out
+end
+
+function _batch_multiply_cxx!(out::PackedElementVector{BMat8}, xs, ys)
+    @wrap_libsemigroups_call LibSemigroups.batch_multiply!(
+        vec(out.images),
+        vec(xs.images),
+        vec(ys.images),
+    )
+    return out
+end
+
+"""
+    batch_multiply!(out::PackedElementVector{E}, xs, ys) -> out
+
+Store in `out[k]` the product `xs[k] * ys[k]` for every `k`, where each of
+`xs` and `ys` is either a [`PackedElementVector{E}`](@ref
+Semigroups.PackedElementVector) of the same length as `out`, or a single
+element of type `E` that is multiplied by every element of the other.
+
+The products are computed in one call on the packed images, with no
+allocation. For [`Transf{UInt8}`](@ref Semigroups.Transf),
+[`PPerm{UInt8}`](@ref Semigroups.PPerm) and
+[`Perm{UInt8}`](@ref Semigroups.Perm) of degree at most 16, each product is
+a single byte shuffle, on processors that have one (SSSE3 on x86, or
+AArch64). `out` may be the same vector as `xs` or `ys`.
+
+# Throws
+- `ArgumentError`: if the elements do not all have the same degree.
+- [`LibsemigroupsError`](@ref Semigroups.LibsemigroupsError): if the
+  lengths of `out`, `xs` and `ys` do not match.
+
+# Example
+```julia
+gens = [Transf([2, 1, 3, 4]), Transf([2, 3, 4, 1])]
+orbit = PackedElementVector([Transf([1, 2, 3, 4])])
+next = similar(orbit)
+batch_multiply!(next, orbit, gens[2])   # right multiply every element
+```
+
+# See also
+- [`batch_multiply`](@ref Semigroups.batch_multiply)
+"""
+function batch_multiply!(
+    out::PackedElementVector{E},
+    xs::Union{E,PackedElementVector{E}},
+    ys::Union{E,PackedElementVector{E}},
+) where {E}
+    return _batch_multiply_cxx!(out, _as_packed(xs, E), _as_packed(ys, E))
+end
+
+function batch_multiply!(
+    out::PackedElementVector{BMat8},
+    xs::Union{BMat8,PackedElementVector{BMat8}},
+    ys::Union{BMat8,PackedElementVector{BMat8}},
+)
+    return _batch_multiply_cxx!(out, _as_packed(xs, BMat8), _as_packed(ys, BMat8))
+end
+
+"""
+    batch_multiply(xs, ys) -> PackedElementVector{E}
+
+Return a new [`PackedElementVector`](@ref Semigroups.PackedElementVector)
+of the products of `xs` and `ys`, as computed by
+[`batch_multiply!`](@ref Semigroups.batch_multiply!). At least one of
+`xs` and `ys` must be a `PackedElementVector`.
+"""
+function batch_multiply(xs::PackedElementVector, ys)
+    n = ys isa PackedElementVector && length(xs) == 1 ? length(ys) : length(xs)
+    out = similar(xs, n)
+    return batch_multiply!(out, xs, ys)
+end
+
+function batch_multiply(x, ys::PackedElementVector)
+    return batch_multiply!(similar(ys), x, ys)
+end
+
+# ============================================================================
+# Batched BMat8 helpers
+# ============================================================================
+
+"""
+    PackedElementVector{BMat8}(values::Vector{UInt64}) -> PackedElementVector{BMat8}
+
+Return the [`BMat8`](@ref Semigroups.BMat8)s whose
+[`to_int`](@ref Semigroups.to_int) values are `values`, without copying:
+the result shares its memory with `values`.
+
+# Example
+```julia
+xs = PackedElementVector{BMat8}(rand(UInt64, 1000))
+batch_row_space_basis(xs)
+```
+"""
+function PackedElementVector{BMat8}(values::Vector{UInt64})
+    return PackedElementVector{BMat8,UInt64}(8, reshape(values, 1, :))
+end
+
+function _bmat8_batch!(f, out::AbstractVector, xs::PackedElementVector{BMat8}, nthreads)
+    @wrap_libsemigroups_call f(out, vec(xs.images), UInt(nthreads))
+    return out
+end
+
+"""
+    batch_transpose!(out::PackedElementVector{BMat8}, xs::PackedElementVector{BMat8}; nthreads::Integer = 1) -> out
+
+Store in `out[k]` the transpose of `xs[k]` for every `k`.
+
+The transposes are computed in one call on the packed values, with no
+allocation, splitting `xs` between at most `nthreads` native threads. `out`
+may be the same vector as `xs`.
+
+# Throws
+- [`LibsemigroupsError`](@ref Semigroups.LibsemigroupsError): if the
+  lengths of `out` and `xs` do not match.
+
+# See also
+- [`batch_transpose`](@ref Semigroups.batch_transpose)
+"""
+function batch_transpose!(
+    out::PackedElementVector{BMat8},
+    xs::PackedElementVector{BMat8};
+    nthreads::Integer = 1,
+)
+    _bmat8_batch!(LibSemigroups.bmat8_batch_transpose!, vec(out.images), xs, nthreads)
+    return out
+end
+
+"""
+    batch_row_space_basis!(out::PackedElementVector{BMat8}, xs::PackedElementVector{BMat8}; nthreads::Integer = 1) -> out
+
+Store in `out[k]` the [`row_space_basis`](@ref Semigroups.row_space_basis)
+of `xs[k]` for every `k`, in the same way as
+[`batch_transpose!`](@ref Semigroups.batch_transpose!).
+"""
+function batch_row_space_basis!(
+    out::PackedElementVector{BMat8},
+    xs::PackedElementVector{BMat8};
+    nthreads::Integer = 1,
+)
+    _bmat8_batch!(
+        LibSemigroups.bmat8_batch_row_space_basis!,
+        vec(out.images),
+        xs,
+        nthreads,
+    )
+    return out
+end
+
+"""
+    batch_col_space_basis!(out::PackedElementVector{BMat8}, xs::PackedElementVector{BMat8}; nthreads::Integer = 1) -> out
+
+Store in `out[k]` the [`col_space_basis`](@ref Semigroups.col_space_basis)
+of `xs[k]` for every `k`, in the same way as
+[`batch_transpose!`](@ref Semigroups.batch_transpose!).
+"""
+function batch_col_space_basis!(
+    out::PackedElementVector{BMat8},
+    xs::PackedElementVector{BMat8};
+    nthreads::Integer = 1,
+)
+    _bmat8_batch!(
+        LibSemigroups.bmat8_batch_col_space_basis!,
+        vec(out.images),
+        xs,
+        nthreads,
+    )
+    return out
+end
+
+"""
+    batch_transpose(xs::PackedElementVector{BMat8}; nthreads::Integer = 1) -> PackedElementVector{BMat8}
+
+Return a new [`PackedElementVector`](@ref Semigroups.PackedElementVector)
+of the transposes of `xs`, as computed by
+[`batch_transpose!`](@ref Semigroups.batch_transpose!).
+"""
+function batch_transpose(xs::PackedElementVector{BMat8}; nthreads::Integer = 1)
+    return batch_transpose!(similar(xs), xs; nthreads = nthreads)
+end
+
+"""
+    batch_row_space_basis(xs::PackedElementVector{BMat8}; nthreads::Integer = 1) -> PackedElementVector{BMat8}
+
+Return a new [`PackedElementVector`](@ref Semigroups.PackedElementVector)
+of the row space bases of `xs`, as computed by
+[`batch_row_space_basis!`](@ref Semigroups.batch_row_space_basis!).
+"""
+function batch_row_space_basis(xs::PackedElementVector{BMat8}; nthreads::Integer = 1)
+    return batch_row_space_basis!(similar(xs), xs; nthreads = nthreads)
+end
+
+"""
+    batch_col_space_basis(xs::PackedElementVector{BMat8}; nthreads::Integer = 1) -> PackedElementVector{BMat8}
+
+Return a new [`PackedElementVector`](@ref Semigroups.PackedElementVector)
+of the column space bases of `xs`, as computed by
+[`batch_col_space_basis!`](@ref Semigroups.batch_col_space_basis!).
+"""
+function batch_col_space_basis(xs::PackedElementVector{BMat8}; nthreads::Integer = 1)
+    return batch_col_space_basis!(similar(xs), xs; nthreads = nthreads)
+end
+
+"""
+    batch_is_regular_element(xs::PackedElementVector{BMat8}; nthreads::Integer = 1) -> Vector{Bool}
+
+Return whether each matrix in `xs` is a regular element of the full boolean
+matrix monoid, as [`is_regular_element`](@ref Semigroups.is_regular_element)
+does, computed in one call on at most `nthreads` native threads.
+"""
+function batch_is_regular_element(xs::PackedElementVector{BMat8}; nthreads::Integer = 1)
+    out = Vector{UInt8}(undef, length(xs))
+    _bmat8_batch!(LibSemigroups.bmat8_batch_is_regular_element!, out, xs, nthreads)
+    return Bool[x != 0 for x in out]
+end
+
+"""
+    group_by_row_space(xs::PackedElementVector{BMat8}; nthreads::Integer = 1) -> Tuple{Vector{Int}, PackedElementVector{BMat8}}
+
+Bucket the matrices in `xs` by row space in one pass.
+
+Returns `(groups, bases)`, where `groups[k]` is the number of the group of
+`xs[k]`, and `bases[j]` is the [`row_space_basis`](@ref
+Semigroups.row_space_basis) shared by every matrix in group `j`. Two
+matrices are in the same group exactly when they have the same row space,
+and groups are numbered from `1` in order of first appearance in `xs`.
+
+The bases are computed on at most `nthreads` native threads, and grouped
+with a hash table, all in one call.
+
+# Example
+```julia
+xs = PackedElementVector([
+    BMat8([[1, 0], [0, 1]]),
+    BMat8([[0, 1], [1, 0]]),
+    BMat8([[1, 1], [0, 0]]),
+])
+groups, bases = group_by_row_space(xs)
+groups           # [1, 1, 2]
+bases[2]         # BMat8([[1, 1], [0, 0]])
+```
+"""
+function group_by_row_space(xs::PackedElementVector{BMat8}; nthreads::Integer = 1)
+    groups = Vector{UInt64}(undef, length(xs))
+    bases = Vector{UInt64}(undef, length(xs))
+    n = @wrap_libsemigroups_call LibSemigroups.bmat8_group_by_row_space!(
+        groups,
+        bases,
+        vec(xs.images),
+        UInt(nthreads),
+    )
+    return Int[g + 1 for g in groups], PackedElementVector{BMat8}(resize!(bases, n))
+end
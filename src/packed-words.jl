@@ -0,0 +1,236 @@
+# Copyright (c) 2026, James W. Swent
+#
+# Distributed under the terms of the GPL license version 3.
+#
+# The full license is in the file LICENSE, distributed with this software.
+
+"""
+packed-words.jl - flat word buffers
+
+Word-heavy bindings return a single `LibSemigroups.PackedWords` instead of a
+vector of separately boxed words. Its two buffers are `letters`, every word
+concatenated (raw 0-based letters), and `offsets`, where word `i` occupies
+`letters[offsets[i]+1:offsets[i+1]]`; `offsets` therefore has one more entry
+than there are words, and starts at `0`.
+"""
+
+# Copy the buffers of a `LibSemigroups.PackedWords` into Julia-owned arrays,
+# so the result stays valid after the C++ object is reused or collected.
+function _packed_buffers(pw)
+    GC.@preserve pw begin
+        n = Int(LibSemigroups.number_of_letters(pw))
+        letters = n == 0 ? UInt[] : copy(LibSemigroups.letters(pw))
+        offsets = copy(LibSemigroups.offsets(pw))
+    end
+    return (letters = letters, offsets = offsets)
+end
+
+"""
+    PackedWordVector <: AbstractVector{Vector{Int}}
+
+Lazy, read-only vector of words stored in two flat buffers.
+
+Word-returning functions such as
+[`normal_forms`](@ref Semigroups.normal_forms(::CongruenceCommon)) return a
+`PackedWordVector` rather than a `Vector{Vector{Int}}`: all the letters of all
+the words live in one contiguous buffer, delimited by a vector of offsets, so
+that a list of ``n`` words costs two allocations instead of ``n``. Indexing
+builds the requested word as a fresh 1-based `Vector{Int}`; nothing is
+converted until it is accessed. Use `collect` to obtain an ordinary
+`Vector{Vector{Int}}`.
+
+A `PackedWordVector` can also be built from the raw buffers of a chunk of
+[`WordChunks`](@ref):
+```julia
+for chunk in normal_forms_chunks(S)
+    words = PackedWordVector(chunk.letters, chunk.offsets)
+end
+```
+
+See also [`raw_letters`](@ref).
+"""
+struct PackedWordVector <: AbstractVector{Vector{Int}}
+    owner::Any               # keeps the C++ buffers alive, or `nothing`
+    letters::Vector{UInt}    # raw 0-based letters, every word concatenated
+    offsets::Vector{UInt64}  # word i is letters[offsets[i]+1:offsets[i+1]]
+    first::Int               # index in `offsets` of the first word
+    length::Int
+end
+
+"""
+    PackedWordVector(letters::Vector{UInt}, offsets::Vector{UInt64}) -> PackedWordVector
+
+Construct a [`PackedWordVector`](@ref) over the given buffers, where word `i`
+is `letters[offsets[i]+1:offsets[i+1]]` with raw 0-based letters.
+
+# Throws
+- `ArgumentError`: if `offsets` is empty, does not start at `0`, or does
+  not end at `length(letters)`.
+"""
+function PackedWordVector(letters::Vector{UInt}, offsets::Vector{UInt64})
+    if isempty(offsets) || first(offsets) != 0 || last(offsets) != length(letters)
+        throw(
+            ArgumentError(
+                "expected offsets starting at 0 and ending at $(length(letters))",
+            ),
+        )
+    end
+    return PackedWordVector(nothing, letters, offsets, 1, length(offsets) - 1)
+end
+
+Base.size(v::PackedWordVector) = (v.length,)
+Base.IndexStyle(::Type{PackedWordVector}) = IndexLinear()
+
+@inline function _letter_range(v::PackedWordVector, i::Int)
+    j = v.first + i - 1
+    return (Int(v.offsets[j]) + 1):Int(v.offsets[j+1])
+end
+
+Base.@propagate_inbounds function Base.getindex(v::PackedWordVector, i::Int)
+    @boundscheck checkbounds(v, i)
+    r = @inbounds _letter_range(v, i)
+    w = Vector{Int}(undef, length(r))
+    @inbounds for (k, x) in enumerate(r)
+        w[k] = Int(v.letters[x]) + 1
+    end
+    return w
+end
+
+"""
+    raw_letters(v::PackedWordVector, i::Integer) -> AbstractVector{UInt}
+
+Return a view of the letters of word `i` of `v` without copying or
+converting them; letters are raw **0-based** values.
+"""
+Base.@propagate_inbounds function raw_letters(v::PackedWordVector, i::Integer)
+    @boundscheck checkbounds(v, i)
+    return view(v.letters, @inbounds _letter_range(v, Int(i)))
+end
+
+# Borrow the buffers of a `LibSemigroups.PackedWords` without copying. The
+# result holds `pw`, which keeps the C++ buffers alive.
+function _packed_words(pw)
+    n = Int(LibSemigroups.number_of_words(pw))
+    letters = LibSemigroups.number_of_letters(pw) == 0 ? UInt[] : LibSemigroups.letters(pw)
+    return PackedWordVector(pw, letters, LibSemigroups.offsets(pw), 1, n)
+end
+
+# As `_packed_words`, for a `LibSemigroups.PackedWords` holding a list of
+# lists of words (partitions, non-trivial classes); one view per group, all
+# sharing the same buffers.
+function _packed_groups(pw)
+    words = _packed_words(pw)
+    groups = LibSemigroups.groups(pw)
+    result = Vector{PackedWordVector}(undef, Int(LibSemigroups.number_of_groups(pw)))
+    for j in eachindex(result)
+        lo, hi = Int(groups[j]), Int(groups[j+1])
+        result[j] = PackedWordVector(pw, words.letters, words.offsets, lo + 1, hi - lo)
+    end
+    return result
+end
+
+# Interleaved (lhs, rhs, ...) packed rules as a vector of 1-based pairs,
+# built with `make(lhs, rhs)`.
+function _packed_rules(make, pw)
+    words = _packed_words(pw)
+    return [make(words[2i-1], words[2i]) for i = 1:(length(words)÷2)]
+end
+
+# Pack 1-based words into raw (letters, offsets) buffers for a batched
+# binding. A `PackedWordVector` is already raw, so its buffers are reused
+# whenever it covers them entirely.
+function _pack_words(words::AbstractVector{<:AbstractVector{<:Integer}})
+    offsets = Vector{UInt64}(undef, length(words) + 1)
+    offsets[1] = 0
+    for (i, w) in enumerate(words)
+        offsets[i+1] = offsets[i] + length(w)
+    end
+    letters = Vector{UInt}(undef, last(offsets))
+    k = 0
+    for w in words, x in w
+        letters[k+=1] = _letter_to_cpp(x)
+    end
+    return letters, offsets
+end
+
+function _pack_words(v::PackedWordVector)
+    if v.first == 1 && v.length == length(v.offsets) - 1
+        return v.letters, v.offsets
+    end
+    lo = v.offsets[v.first]
+    hi = v.offsets[v.first+v.length]
+    return v.letters[lo+1:hi], v.offsets[v.first:v.first+v.length] .- lo
+end
+
+"""
+    PackedWordBuffer
+
+Reusable storage for a batch of words, filled in place from a
+[`WordRange`](@ref) or [`Paths`](@ref) by
+[`fill!`](@ref Base.fill!(::PackedWordBuffer, ::WordRange)).
+
+A buffer holds at most `max_words` words with at most `max_letters` letters
+between them, and `length(buf)` is the number of words written by the last
+`fill!`. `PackedWordVector(buf)` views those words without copying; the view
+is overwritten by the next `fill!`, so enumerating a long range allocates
+only once:
+```julia
+buf = PackedWordBuffer(10_000, 100_000)
+while !at_end(r)
+    for w in PackedWordVector(fill!(buf, r))
+        # ...
+    end
+end
+```
+
+See also [`take!`](@ref Base.take!(::WordRange, ::Integer)).
+"""
+mutable struct PackedWordBuffer
+    letters::Vector{UInt}
+    offsets::Vector{UInt64}
+    length::Int
+end
+
+"""
+    PackedWordBuffer(max_words::Integer, max_letters::Integer) -> PackedWordBuffer
+
+Construct an empty [`PackedWordBuffer`](@ref) with room for `max_words`
+words of `max_letters` letters in total.
+
+# Throws
+- `ArgumentError`: if `max_words` or `max_letters` is negative.
+"""
+function PackedWordBuffer(max_words::Integer, max_letters::Integer)
+    if max_words < 0 || max_letters < 0
+        throw(ArgumentError("expected non-negative capacities"))
+    end
+    offsets = zeros(UInt64, max_words + 1)
+    return PackedWordBuffer(Vector{UInt}(undef, max_letters), offsets, 0)
+end
+
+Base.length(buf::PackedWordBuffer) = buf.length
+Base.isempty(buf::PackedWordBuffer) = buf.length == 0
+
+PackedWordVector(buf::PackedWordBuffer) =
+    PackedWordVector(buf, buf.letters, buf.offsets, 1, buf.length)
+
+# Fill `buf` from a bound range with `take!` / `fill!` methods (see
+# `packed-words.hpp`), throwing if its next word can never fit.
+function _fill_buffer!(buf::PackedWordBuffer, range, at_end)
+    n = Int(@wrap_libsemigroups_call LibSemigroups.fill!(range, buf.letters, buf.offsets))
+    buf.length = n
+    if n == 0 && length(buf.offsets) > 1 && !at_end()
+        throw(
+            ArgumentError(
+                "the next word is longer than the buffer capacity " *
+                "of $(length(buf.letters)) letters",
+            ),
+        )
+    end
+    return buf
+end
+
+function _take_words(range, n::Integer)
+    n < 0 && throw(ArgumentError("expected a non-negative number of words, found $n"))
+    return _packed_words(@wrap_libsemigroups_call LibSemigroups.take!(range, UInt(n)))
+end
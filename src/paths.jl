@@ -481,6 +481,110 @@ function Base.count(p::Paths)
     return _length_from_cpp(c)
 end
 
+"""
+    number_of_paths(p::Paths; nthreads::Integer = 1) -> Union{Int, PositiveInfinityType}
+
+Return the number of paths described by the settings of `p`.
+
+Unlike [`Base.count`](@ref Base.count(::Paths)), this counts the whole range
+from its first path, however far `p` has been advanced, and does not advance
+`p`. If the maximum length is finite and `nthreads > 1`, the paths of each
+length are counted by repeated sparse matrix-vector products, see
+[`count_by_length!`](@ref), with the nodes split between at most `nthreads`
+threads. Otherwise libsemigroups chooses the algorithm.
+
+# Throws
+- `LibsemigroupsError`: if [`source`](@ref)`(p)` is
+  [`UNDEFINED`](@ref Semigroups.UNDEFINED).
+"""
+function number_of_paths(p::Paths; nthreads::Integer = 1)
+    GC.@preserve p begin
+        c = @wrap_libsemigroups_call LibSemigroups.number_of_paths(p.cxx, UInt(nthreads))
+    end
+    return _length_from_cpp(c)
+end
+
+"""
+    count_by_length!(out::Vector{UInt64}, p::Paths; nthreads::Integer = 1) -> Vector{UInt64}
+
+Overwrite `out` with the number of paths of each length in the range of `p`.
+
+`out[k]` is the number of paths from [`source`](@ref)`(p)` to
+[`target`](@ref)`(p)` (to any node, if the target is
+[`UNDEFINED`](@ref Semigroups.UNDEFINED)) of length
+`Semigroups.min(p) + k - 1`, for every index `k` of `out`; the maximum
+length of `p` is ignored, as is how far `p` has been advanced. Counts are
+computed modulo ``2^{64}``, and nothing is allocated on the Julia side.
+
+The counts for successive lengths are the entries of successive powers of
+the adjacency matrix of the word graph, obtained by one sparse
+matrix-vector product per length, with the nodes split between at most
+`nthreads` threads.
+
+# Throws
+- `LibsemigroupsError`: if [`source`](@ref)`(p)` is
+  [`UNDEFINED`](@ref Semigroups.UNDEFINED).
+
+# Complexity
+``O((v + e)(m + n))`` where ``v`` and ``e`` are the numbers of nodes and
+edges of the word graph,
+``m = `` `Semigroups.min(p)` and ``n = `` `length(out)`.
+"""
+function count_by_length!(out::Vector{UInt64}, p::Paths; nthreads::Integer = 1)
+    GC.@preserve p begin
+        @wrap_libsemigroups_call LibSemigroups.count_by_length!(p.cxx, out, UInt(nthreads))
+    end
+    return out
+end
+
+"""
+    take!(p::Paths, n::Integer) -> PackedWordVector
+
+Remove the next (at most) `n` paths from `p` and return them.
+
+The range is advanced in C++ and the paths are returned as a
+[`PackedWordVector`](@ref) of edge labels, so no path is converted until it
+is accessed. Fewer than `n` paths are returned only if `p` is exhausted.
+
+# Throws
+- `ArgumentError`: if `n` is negative.
+- `LibsemigroupsError`: if [`source`](@ref)`(p)` is
+  [`UNDEFINED`](@ref Semigroups.UNDEFINED).
+
+See also [`fill!`](@ref Base.fill!(::PackedWordBuffer, ::Paths)).
+"""
+function Base.take!(p::Paths, n::Integer)
+    GC.@preserve p begin
+        @wrap_libsemigroups_call LibSemigroups.throw_if_source_undefined(p.cxx)
+        result = _take_words(p.cxx, n)
+    end
+    return result
+end
+
+"""
+    fill!(buf::PackedWordBuffer, p::Paths) -> PackedWordBuffer
+
+Overwrite `buf` with the next paths of `p`, for as long as they fit, and
+advance `p` past them.
+
+Afterwards `length(buf)` is the number of paths written, which is `0` only
+if `p` is exhausted or `buf` has room for no paths. Unlike
+[`take!`](@ref Base.take!(::Paths, ::Integer)), this allocates nothing.
+
+# Throws
+- `ArgumentError`: if the next path of `p` is longer than the letter
+  capacity of `buf`.
+- `LibsemigroupsError`: if [`source`](@ref)`(p)` is
+  [`UNDEFINED`](@ref Semigroups.UNDEFINED).
+"""
+function Base.fill!(buf::PackedWordBuffer, p::Paths)
+    GC.@preserve p begin
+        @wrap_libsemigroups_call LibSemigroups.throw_if_source_undefined(p.cxx)
+        _fill_buffer!(buf, p.cxx, () -> LibSemigroups.at_end(p.cxx))
+    end
+    return buf
+end
+
 # ============================================================================
 # Julia iteration protocol
 # ============================================================================
@@ -443,9 +443,7 @@ appreciably faster than iterating [`rule_lhs`](@ref) / [`rule_rhs`](@ref)
 for large presentations.
 """
 function rules(p::Presentation)
-    flat = LibSemigroups.rules_vector(p)
-    n = length(flat)
-    return [(_word_from_cpp(flat[i]), _word_from_cpp(flat[i+1])) for i = 1:2:n]
+    return _packed_rules(tuple, LibSemigroups.rules_vector(p))
 end
 
 """
@@ -800,6 +798,101 @@ Linear in the number of rules.
 """
 remove_trivial_rules!(p::Presentation) = (LibSemigroups.remove_trivial_rules!(p); p)
 
+# Reasons recorded by `remove_redundant_rules`, indexed by the 0-based codes
+# written by `LibSemigroups.remove_redundant_rules!`.
+const _REMOVAL_REASONS = (:trivial, :duplicate, :redundant)
+
+"""
+    remove_redundant_rules(p::Presentation;
+                           method::Symbol = :knuth_bendix,
+                           timeout::TimePeriod = Dates.Millisecond(100),
+                           budget::Union{TimePeriod,Nothing} = nothing,
+                           nthreads::Integer = 1) -> NamedTuple
+
+Return a copy of `p` without its trivial, duplicate and redundant rules,
+together with a log of the rules removed.
+
+Trivial rules ``u = u`` and duplicates of earlier rules are removed first,
+as by [`remove_trivial_rules!`](@ref) and [`remove_duplicate_rules!`](@ref)
+but without reordering the remaining rules. Then every rule is tested for
+redundancy, by running Knuth-Bendix (`method = :knuth_bendix`) or
+Todd-Coxeter (`method = :todd_coxeter`) on the other rules for at most
+`timeout`, as in [`redundant_rule`](@ref Semigroups.redundant_rule) and
+[`tc_redundant_rule`](@ref). The tests run in C++ on at most `nthreads`
+threads at once. If more than one rule is shown to be redundant, the last is
+removed and the others are tested again, since removing one rule may make
+another necessary; this repeats until no rule is shown to be redundant. No
+test is started once `budget` (if any) has elapsed.
+
+The result has fields:
+- `presentation`: the simplified copy of `p`, whose rules are those of `p`
+  that were kept, in their original order;
+- `removed`: a vector with one `NamedTuple` per rule removed, in removal
+  order, with fields `index` (the 1-based rule index in `p`), `lhs`, `rhs`,
+  and `reason` (`:trivial`, `:duplicate` or `:redundant`).
+
+Every rule removed follows from the rules kept, so the presentation defines
+the same semigroup or monoid; a redundant rule may be kept if it cannot be
+shown redundant within `timeout`.
+
+!!! warning
+    This function is non-deterministic: which redundant rules are found may
+    differ between calls with identical parameters.
+
+# Throws
+- `ArgumentError`: if `method` is not `:knuth_bendix` or `:todd_coxeter`,
+  or `nthreads < 1`.
+- `LibsemigroupsError`: if `p` has an odd number of rule words, or its
+  rules contain letters not in its alphabet.
+
+# Example
+```julia
+result = remove_redundant_rules(p; timeout = Millisecond(50), nthreads = 4)
+tc = ToddCoxeter(twosided, result.presentation)
+```
+"""
+function remove_redundant_rules(
+    p::Presentation;
+    method::Symbol = :knuth_bendix,
+    timeout::TimePeriod = Dates.Millisecond(100),
+    budget::Union{TimePeriod,Nothing} = nothing,
+    nthreads::Integer = 1,
+)
+    if method !== :knuth_bendix && method !== :todd_coxeter
+        throw(
+            ArgumentError(
+                "expected method to be :knuth_bendix or :todd_coxeter, found :$method",
+            ),
+        )
+    end
+    nthreads >= 1 || throw(ArgumentError("expected nthreads >= 1, found $nthreads"))
+    t = Int64(Dates.value(convert(Nanosecond, timeout)))
+    b = budget === nothing ? Int64(-1) : Int64(Dates.value(convert(Nanosecond, budget)))
+    q = Presentation(p)
+    n = number_of_rules(p)
+    removed = Vector{UInt64}(undef, n)
+    reasons = Vector{UInt8}(undef, n)
+    k = @wrap_libsemigroups_call LibSemigroups.remove_redundant_rules!(
+        q,
+        removed,
+        reasons,
+        UInt(nthreads),
+        t,
+        b,
+        method === :todd_coxeter,
+    )
+    log = map(1:Int(k)) do j
+        i = Int(removed[j]) + 1
+        return (
+            index = i,
+            lhs = rule_lhs(p, i),
+            rhs = rule_rhs(p, i),
+            reason = _REMOVAL_REASONS[reasons[j]+1],
+        )
+    end
+    return (presentation = q, removed = log)
+end
+
 """
     add_rules!(p::Presentation, q::Presentation) -> Presentation
 
@@ -1142,7 +1235,7 @@ function Base.hash(p::Presentation, h::UInt)
     return hash(
         (
             alphabet(p),
-            [_word_from_cpp(w) for w in LibSemigroups.rules_vector(p)],
+            _packed_words(LibSemigroups.rules_vector(p)),
             contains_empty_word(p),
         ),
         h,
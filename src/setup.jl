@@ -45,12 +45,22 @@ function library_path()
     end
 end
 
+# Whether to build the instrumented library of `binding_profile()`, selected
+# by setting the environment variable SEMIGROUPS_PROFILE_BINDINGS to 1. An
+# instrumented library is always built from source.
+function profile_bindings()
+    return get(ENV, "SEMIGROUPS_PROFILE_BINDINGS", "0") == "1"
+end
+
 function local_treehash_path()
     return joinpath(build_dir(), "libsemigroups_julia.treehash")
 end
 
+# The hash of the sources, and of whether the build is instrumented, so that
+# switching between the two rebuilds the library.
 function source_tree_hash()
-    return bytes2hex(Pkg.GitTools.tree_hash(src_dir()))
+    hash = bytes2hex(Pkg.GitTools.tree_hash(src_dir()))
+    return profile_bindings() ? hash * "-profile" : hash
 end
 
 function jll_tree_hashes()
@@ -69,6 +79,7 @@ function package_is_from_registry()
 end
 
 function use_jll_library(src_hash::AbstractString)
+    profile_bindings() && return false
     return src_hash in jll_tree_hashes() || package_is_from_registry()
 end
 
@@ -101,6 +112,7 @@ function build_library(src_hash::AbstractString = source_tree_hash())
         "-DJlCxx_DIR=$(joinpath(jlcxx_dir, "lib", "cmake", "JlCxx"))",
         "-DLIBSEMIGROUPS_INCLUDE_DIR=$libsemigroups_incdir",
         "-DLIBSEMIGROUPS_LIBRARY_DIR=$libsemigroups_libdir",
+        "-DLIBSEMIGROUPS_JULIA_PROFILE=$(profile_bindings() ? "ON" : "OFF")",
     ]
 
     # Add macOS-specific flags if needed
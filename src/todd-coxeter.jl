@@ -554,6 +554,295 @@ function def_policy!(tc::ToddCoxeter, val)
     return tc
 end
 
+# ============================================================================
+# Settings — sizing of large enumerations
+# ============================================================================
+
+"""
+    lookahead_next(tc::ToddCoxeter) -> Int
+
+Return the number of active nodes at which the next lookahead of `tc` is
+triggered. The default is `5_000_000`.
+
+# See also
+
+[`lookahead_next!`](@ref Semigroups.lookahead_next!)
+"""
+lookahead_next(tc::ToddCoxeter) = Int(LibSemigroups.lookahead_next(tc))
+
+"""
+    lookahead_next!(tc::ToddCoxeter, val::Integer) -> ToddCoxeter
+
+Set the number of active nodes at which the next lookahead of `tc` is
+triggered to `val`. Returns `tc` for chaining.
+
+After each lookahead, `lookahead_next` is recomputed from
+[`lookahead_min`](@ref Semigroups.lookahead_min),
+[`lookahead_growth_factor`](@ref Semigroups.lookahead_growth_factor) and
+[`lookahead_growth_threshold`](@ref Semigroups.lookahead_growth_threshold).
+
+# See also
+
+[`lookahead_next`](@ref Semigroups.lookahead_next)
+"""
+function lookahead_next!(tc::ToddCoxeter, val::Integer)
+    LibSemigroups.set_lookahead_next!(tc, UInt(val))
+    return tc
+end
+
+"""
+    lookahead_min(tc::ToddCoxeter) -> Int
+
+Return the smallest value that [`lookahead_next`](@ref Semigroups.lookahead_next)
+is given after a lookahead of `tc`. The default is `10_000`.
+
+# See also
+
+[`lookahead_min!`](@ref Semigroups.lookahead_min!)
+"""
+lookahead_min(tc::ToddCoxeter) = Int(LibSemigroups.lookahead_min(tc))
+
+"""
+    lookahead_min!(tc::ToddCoxeter, val::Integer) -> ToddCoxeter
+
+Set the smallest value that [`lookahead_next`](@ref Semigroups.lookahead_next)
+is given after a lookahead of `tc` to `val`. Returns `tc` for chaining.
+
+# See also
+
+[`lookahead_min`](@ref Semigroups.lookahead_min)
+"""
+function lookahead_min!(tc::ToddCoxeter, val::Integer)
+    LibSemigroups.set_lookahead_min!(tc, UInt(val))
+    return tc
+end
+
+"""
+    lookahead_growth_factor(tc::ToddCoxeter) -> Float64
+
+Return the factor by which [`lookahead_next`](@ref Semigroups.lookahead_next) is
+increased when a lookahead of `tc` kills too few nodes. The default is
+`2.0`.
+
+# See also
+
+[`lookahead_growth_factor!`](@ref Semigroups.lookahead_growth_factor!)
+"""
+lookahead_growth_factor(tc::ToddCoxeter) =
+    Float64(LibSemigroups.lookahead_growth_factor(tc))
+
+"""
+    lookahead_growth_factor!(tc::ToddCoxeter, val::Real) -> ToddCoxeter
+
+Set the factor by which [`lookahead_next`](@ref Semigroups.lookahead_next) is
+increased when a lookahead of `tc` kills too few nodes to `val`. Returns
+`tc` for chaining.
+
+# Throws
+
+- `LibsemigroupsError` if `val` is less than `1.0`.
+
+# See also
+
+[`lookahead_growth_factor`](@ref Semigroups.lookahead_growth_factor)
+"""
+function lookahead_growth_factor!(tc::ToddCoxeter, val::Real)
+    @wrap_libsemigroups_call LibSemigroups.set_lookahead_growth_factor!(tc, Float32(val))
+    return tc
+end
+
+"""
+    lookahead_growth_threshold(tc::ToddCoxeter) -> Int
+
+Return the threshold used to decide whether a lookahead of `tc` killed too few
+nodes: it did if it killed fewer than the number of active nodes divided
+by this value. The default is `4`.
+
+# See also
+
+[`lookahead_growth_threshold!`](@ref Semigroups.lookahead_growth_threshold!)
+"""
+lookahead_growth_threshold(tc::ToddCoxeter) =
+    Int(LibSemigroups.lookahead_growth_threshold(tc))
+
+"""
+    lookahead_growth_threshold!(tc::ToddCoxeter, val::Integer) -> ToddCoxeter
+
+Set the threshold used to decide whether a lookahead of `tc` killed too few
+nodes to `val`. Returns `tc` for chaining.
+
+# See also
+
+[`lookahead_growth_threshold`](@ref Semigroups.lookahead_growth_threshold)
+"""
+function lookahead_growth_threshold!(tc::ToddCoxeter, val::Integer)
+    LibSemigroups.set_lookahead_growth_threshold!(tc, UInt(val))
+    return tc
+end
+
+"""
+    hlt_defs(tc::ToddCoxeter) -> Int
+
+Return the number of HLT-style definitions made in each HLT phase of the
+`strategy_CR`, `strategy_R_over_C`, `strategy_Cr` and `strategy_Rc`
+strategies of `tc`. The default is `200_000`.
+
+# See also
+
+[`hlt_defs!`](@ref Semigroups.hlt_defs!)
+"""
+hlt_defs(tc::ToddCoxeter) = Int(LibSemigroups.hlt_defs(tc))
+
+"""
+    hlt_defs!(tc::ToddCoxeter, val::Integer) -> ToddCoxeter
+
+Set the number of HLT-style definitions made in each HLT phase of the mixed
+strategies of `tc` to `val`. Returns `tc` for chaining.
+
+# Throws
+
+- `LibsemigroupsError` if `val` is less than the length of the longest
+  relation of the presentation of `tc`.
+
+# See also
+
+[`hlt_defs`](@ref Semigroups.hlt_defs)
+"""
+function hlt_defs!(tc::ToddCoxeter, val::Integer)
+    @wrap_libsemigroups_call LibSemigroups.set_hlt_defs!(tc, UInt(val))
+    return tc
+end
+
+"""
+    f_defs(tc::ToddCoxeter) -> Int
+
+Return the number of Felsch-style definitions made in each Felsch phase of the
+`strategy_CR`, `strategy_R_over_C`, `strategy_Cr` and `strategy_Rc`
+strategies of `tc`. The default is `100_000`.
+
+# See also
+
+[`f_defs!`](@ref Semigroups.f_defs!)
+"""
+f_defs(tc::ToddCoxeter) = Int(LibSemigroups.f_defs(tc))
+
+"""
+    f_defs!(tc::ToddCoxeter, val::Integer) -> ToddCoxeter
+
+Set the number of Felsch-style definitions made in each Felsch phase of the
+mixed strategies of `tc` to `val`. Returns `tc` for chaining.
+
+# Throws
+
+- `LibsemigroupsError` if `val` is `0`.
+
+# See also
+
+[`f_defs`](@ref Semigroups.f_defs)
+"""
+function f_defs!(tc::ToddCoxeter, val::Integer)
+    @wrap_libsemigroups_call LibSemigroups.set_f_defs!(tc, UInt(val))
+    return tc
+end
+
+"""
+    def_max(tc::ToddCoxeter) -> Int
+
+Return the maximum number of definitions that `tc` keeps on its definition
+stack, see [`def_policy`](@ref Semigroups.def_policy). The default is
+`2_000`.
+
+# See also
+
+[`def_max!`](@ref Semigroups.def_max!)
+"""
+def_max(tc::ToddCoxeter) = Int(LibSemigroups.def_max(tc))
+
+"""
+    def_max!(tc::ToddCoxeter, val::Integer) -> ToddCoxeter
+
+Set the maximum number of definitions that `tc` keeps on its definition
+stack to `val`. Returns `tc` for chaining.
+
+# See also
+
+[`def_max`](@ref Semigroups.def_max)
+"""
+function def_max!(tc::ToddCoxeter, val::Integer)
+    LibSemigroups.set_def_max!(tc, UInt(val))
+    return tc
+end
+
+"""
+    large_collapse(tc::ToddCoxeter) -> Int
+
+Return the number of coincidences above which `tc` processes a collapse in bulk,
+rebuilding the sources of the nodes of its word graph once instead of
+updating them for every coincidence. The default is `100_000`.
+
+# See also
+
+[`large_collapse!`](@ref Semigroups.large_collapse!)
+"""
+large_collapse(tc::ToddCoxeter) = Int(LibSemigroups.large_collapse(tc))
+
+"""
+    large_collapse!(tc::ToddCoxeter, val::Integer) -> ToddCoxeter
+
+Set the number of coincidences above which `tc` processes a collapse in bulk
+to `val`. Returns `tc` for chaining.
+
+# See also
+
+[`large_collapse`](@ref Semigroups.large_collapse)
+"""
+function large_collapse!(tc::ToddCoxeter, val::Integer)
+    LibSemigroups.set_large_collapse!(tc, UInt(val))
+    return tc
+end
+
+"""
+    tune_for_size!(tc::ToddCoxeter, n::Integer) -> ToddCoxeter
+
+Change the enumeration settings of `tc` for an enumeration expected to
+reach about `n` nodes. Returns `tc` for chaining.
+
+This is a preset of three settings, each only ever raised:
+
+- [`lookahead_next`](@ref Semigroups.lookahead_next) is set to at least
+  `n`, so that the first lookahead is not made before the word graph has
+  about `n` nodes;
+- [`lookahead_min`](@ref Semigroups.lookahead_min) is set to at least `n`,
+  which also applies to every later lookahead, and to every later call to
+  [`run!`](@ref) and friends, until it is set again;
+- [`large_collapse`](@ref Semigroups.large_collapse) is set to at least
+  `n ÷ 100`, so that a collapse in a word graph of that size is processed
+  in bulk.
+
+All three are kept by [`save_checkpoint`](@ref Semigroups.save_checkpoint),
+so a tuned run that is checkpointed resumes tuned.
+
+It allocates nothing: libsemigroups owns the word graph of `tc` and has no
+way to reserve space for it, and grows it geometrically, so the number of
+reallocations is logarithmic in `n` regardless.
+
+!!! note
+    libsemigroups enumerates on a single thread, and lookaheads and HLT
+    relator tracing cannot be split across threads. To use several threads
+    on one presentation, race differently configured `ToddCoxeter`
+    instances in a [`CongruenceRace`](@ref Semigroups.CongruenceRace).
+
+# Throws
+- `ArgumentError`: if `n` is negative.
+"""
+function tune_for_size!(tc::ToddCoxeter, n::Integer)
+    n >= 0 || throw(ArgumentError("expected a non-negative size, found $n"))
+    lookahead_next!(tc, max(lookahead_next(tc), n))
+    lookahead_min!(tc, max(lookahead_min(tc), n))
+    large_collapse!(tc, max(large_collapse(tc), n ÷ 100))
+    return tc
+end
+
 # ============================================================================
 # Standardize / word-graph access
 # ============================================================================
@@ -693,6 +982,49 @@ function index_of(tc::ToddCoxeter, w::AbstractVector{<:Integer})
     return _index_from_cpp(cpp_i)
 end
 
+"""
+    batch_index_of(tc::ToddCoxeter, words::AbstractVector{<:AbstractVector{<:Integer}}; nthreads::Integer = 1) -> Vector{Int}
+
+Return the 1-based index of the congruence class of every word in `words`.
+
+This is equivalent to `[index_of(tc, w) for w in words]`, but makes a single
+call across the C++ boundary: `tc` is run (and standardized, as in
+[`index_of`](@ref Semigroups.index_of)) once, and every word is then looked
+up in the finished word graph, using up to `nthreads` threads. Passing a
+[`PackedWordVector`](@ref Semigroups.PackedWordVector) as `words` avoids
+repacking it.
+
+# Throws
+
+- `LibsemigroupsError` if any letter of any word is not in the alphabet of
+  the underlying presentation.
+- `InexactError` if any letter is zero or negative.
+
+!!! warning
+    This function may never terminate if the congruence is undecidable.
+
+# See also
+
+[`index_of`](@ref Semigroups.index_of),
+[`batch_reduce`](@ref Semigroups.batch_reduce)
+"""
+function batch_index_of(
+    tc::ToddCoxeter,
+    words::AbstractVector{<:AbstractVector{<:Integer}};
+    nthreads::Integer = 1,
+)
+    letters, offsets = _pack_words(words)
+    out = Vector{UInt}(undef, length(words))
+    @wrap_libsemigroups_call LibSemigroups.tc_index_of_batch!(
+        tc,
+        letters,
+        offsets,
+        out,
+        UInt(nthreads),
+    )
+    return Int[Int(i) + 1 for i in out]
+end
+
 """
     current_index_of(tc::ToddCoxeter, w::AbstractVector{<:Integer}) -> Union{Int, UndefinedType}
 
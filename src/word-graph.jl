@@ -237,6 +237,348 @@ function add_nodes!(g::WordGraph, n::Integer)
     return g
 end
 
+# ============================================================================
+# Bulk target tables
+# ============================================================================
+# Whole tables cross the C++ boundary in a single call. Entries are the raw
+# C++ values: 0-based node indices, with typemax(UInt32) for a missing edge.
+# Use `_from_cpp` (or add 1) to convert an entry to the 1-based Julia API.
+
+"""
+    TargetTable <: AbstractMatrix{UInt32}
+
+Borrowed, read-only view of the targets of a [`WordGraph`](@ref).
+
+A `TargetTable` `t` is a `number_of_nodes × out_degree` matrix, and
+`t[s, a]` is the target of the edge with source `s` and label `a`.
+Entries are **raw** values in the C++ convention: a node `v` is stored
+as `v - 1`, and a missing edge is stored as `typemax(UInt32)`. This
+keeps element access a single memory load with no conversion.
+
+No data is copied: the table reads the memory of the underlying C++
+word graph directly, and holds a reference to its owner so that the
+memory is not freed while the view is alive. Any operation that
+changes the shape of the word graph (such as [`add_nodes!`](@ref), or
+enumerating or adding generators to the [`FroidurePin`](@ref) that owns
+a Cayley graph) invalidates the view. Use [`target_table`](@ref) for an
+independent copy.
+
+See also [`unsafe_target_table`](@ref), [`target_table`](@ref),
+[`right_cayley_table`](@ref).
+"""
+struct TargetTable <: AbstractMatrix{UInt32}
+    owner::Any
+    data::Matrix{UInt32}   # stride × number_of_nodes, row padding ignored
+    number_of_nodes::Int
+    out_degree::Int
+end
+
+Base.size(t::TargetTable) = (t.number_of_nodes, t.out_degree)
+Base.IndexStyle(::Type{TargetTable}) = IndexCartesian()
+
+Base.@propagate_inbounds function Base.getindex(t::TargetTable, s::Int, a::Int)
+    @boundscheck checkbounds(t, s, a)
+    return @inbounds t.data[a, s]
+end
+
+@cxxdereference function _target_table(owner, g::WordGraph)
+    n = number_of_nodes(g)
+    d = out_degree(g)
+    if n == 0 || d == 0
+        return TargetTable(owner, Matrix{UInt32}(undef, d, n), n, d)
+    end
+    return TargetTable(owner, LibSemigroups.targets_view(g), n, d)
+end
+
+"""
+    unsafe_target_table(g::WordGraph) -> TargetTable
+
+Returns a borrowed view of the targets of `g`.
+
+This function returns a [`TargetTable`](@ref) reading the memory of `g`
+directly, so that no data is copied. Entries are raw 0-based values, with
+`typemax(UInt32)` for a missing edge.
+
+!!! note
+    The view is invalidated by any operation that changes the number of
+    nodes of `g`. Edges set with [`target!`](@ref) after the view is
+    created are visible through it.
+
+# Complexity
+Constant.
+
+See also [`target_table`](@ref).
+"""
+unsafe_target_table(g::WordGraph) = _target_table(g, g)
+
+"""
+    target_table(g::WordGraph) -> Matrix{UInt32}
+
+Returns a copy of the targets of `g`.
+
+This function returns a `number_of_nodes × out_degree` matrix `t` where
+`t[s, a]` is the target of the edge with source `s` and label `a`, in one
+call across the C++ boundary. Entries are raw 0-based values, with
+`typemax(UInt32)` for a missing edge, as in [`TargetTable`](@ref). The
+result can be passed back to [`WordGraph`](@ref) or
+[`target_table!`](@ref).
+
+# Complexity
+``O(mn)`` where ``m`` is the number of nodes and ``n`` is the out-degree.
+
+See also [`unsafe_target_table`](@ref), [`target_table!`](@ref).
+"""
+@cxxdereference function target_table(g::WordGraph)
+    out = Matrix{UInt32}(undef, number_of_nodes(g), out_degree(g))
+    GC.@preserve out begin
+        @wrap_libsemigroups_call LibSemigroups.copy_targets!(g, vec(out))
+    end
+    return out
+end
+
+"""
+    target_table!(g::WordGraph, table::AbstractMatrix{<:Integer}) -> WordGraph
+
+Set every edge of `g` from a table.
+
+This function overwrites all edges of `g` in a single call across the C++
+boundary. The table must have the same layout as the one returned by
+[`target_table`](@ref): it is `number_of_nodes × out_degree`, and
+`table[s, a]` is the raw 0-based target of the edge with source `s` and
+label `a`, or `typemax(UInt32)` if the edge is missing.
+
+# Arguments
+ - `table::AbstractMatrix{<:Integer}`: the raw targets.
+
+# Throws
+ - `DimensionMismatch`: if `size(table)` is not
+   `(number_of_nodes(g), out_degree(g))`.
+ - `InexactError`: if an entry does not fit in a `UInt32`.
+ - `LibsemigroupsError`: if an entry is neither a node of `g` nor
+   `typemax(UInt32)`. In this case `g` is not modified.
+
+# Complexity
+``O(mn)`` where ``m`` is the number of nodes and ``n`` is the out-degree.
+
+See also [`target_table`](@ref), [`target!`](@ref).
+"""
+function target_table!(g::WordGraph, table::AbstractMatrix{<:Integer})
+    if size(table) != (number_of_nodes(g), out_degree(g))
+        throw(
+            DimensionMismatch(
+                "expected a $(number_of_nodes(g)) × $(out_degree(g)) table, " *
+                "found $(size(table, 1)) × $(size(table, 2))",
+            ),
+        )
+    end
+    data = vec(convert(Matrix{UInt32}, table))
+    GC.@preserve g data begin
+        @wrap_libsemigroups_call LibSemigroups.set_targets!(g, data)
+    end
+    return g
+end
+
+"""
+    WordGraph(table::AbstractMatrix{<:Integer}) -> WordGraph
+
+Construct a word graph from a table of raw targets.
+
+This function constructs a word graph with `size(table, 1)` nodes and
+out-degree `size(table, 2)`, whose edges are given by `table` in the
+layout used by [`target_table`](@ref) and [`target_table!`](@ref). In
+particular `WordGraph(target_table(g))` is equal to `g`.
+
+# Throws
+ - `InexactError`: if an entry does not fit in a `UInt32`.
+ - `LibsemigroupsError`: if an entry is neither a valid 0-based node nor
+   `typemax(UInt32)`.
+
+See also [`target_table!`](@ref).
+"""
+function WordGraph(table::AbstractMatrix{<:Integer})
+    return target_table!(WordGraph(size(table, 1), size(table, 2)), table)
+end
+
+# ============================================================================
+# Algorithms
+# ============================================================================
+# Each function below is a single call across the C++ boundary, however many
+# edges the word graph has. Nodes and labels are 1-based, as in the rest of
+# the Julia API.
+
+"""
+    number_of_edges(g::WordGraph) -> Int
+
+Returns the number of defined edges of `g`.
+
+# Complexity
+``O(mn)`` where ``m`` is the number of nodes and ``n`` is the out-degree.
+"""
+@cxxdereference number_of_edges(g::WordGraph) = Int(LibSemigroups.number_of_edges(g))
+
+"""
+    scc_ids(g::WordGraph) -> Vector{Int}
+
+Returns the strongly connected component of every node of `g`.
+
+Entry `s` of the result is the component containing node `s`. Components
+are numbered ``1, 2, \\ldots, k`` in the order Tarjan's algorithm completes
+them, so that every edge between two different components goes from a
+larger number to a smaller one; in particular component `1` has no edges
+leaving it.
+
+For the right (or left) Cayley graph of a finite semigroup, the components
+are the ``\\mathscr{R}``-classes (or ``\\mathscr{L}``-classes).
+
+# Complexity
+``O(mn)`` where ``m`` is the number of nodes and ``n`` is the out-degree.
+
+# Example
+```julia
+g = WordGraph([1 0; 0 2; 2 2])   # raw targets: 1 <-> 2, 2 -> 3, 3 -> 3
+scc_ids(g)                       # [2, 2, 1]
+```
+"""
+@cxxdereference function scc_ids(g::WordGraph)
+    ids = Vector{UInt32}(undef, number_of_nodes(g))
+    @wrap_libsemigroups_call LibSemigroups.wg_scc_ids!(g, ids)
+    return Int[x + 1 for x in ids]
+end
+
+"""
+    bfs_order(g::WordGraph, source::Integer) -> Vector{Int}
+
+Returns the nodes of `g` reachable from `source`, in breadth-first order.
+
+The edges of each node are followed in label order, starting from
+`source`, which is the first entry of the result.
+
+# Throws
+ - `LibsemigroupsError`: if `source` is not a node of `g`.
+
+# Complexity
+``O(mn)`` where ``m`` is the number of nodes and ``n`` is the out-degree.
+
+See also [`dfs_order`](@ref), [`reachable`](@ref).
+"""
+@cxxdereference function bfs_order(g::WordGraph, source::Integer)
+    s = _to_cpp(source)
+    return Int[x + 1 for x in @wrap_libsemigroups_call LibSemigroups.wg_bfs_order(g, s)]
+end
+
+"""
+    dfs_order(g::WordGraph, source::Integer) -> Vector{Int}
+
+Returns the nodes of `g` reachable from `source`, in depth-first preorder.
+
+The edges of each node are followed in label order, starting from
+`source`, which is the first entry of the result.
+
+# Throws
+ - `LibsemigroupsError`: if `source` is not a node of `g`.
+
+# Complexity
+``O(mn)`` where ``m`` is the number of nodes and ``n`` is the out-degree.
+
+See also [`bfs_order`](@ref).
+"""
+@cxxdereference function dfs_order(g::WordGraph, source::Integer)
+    s = _to_cpp(source)
+    return Int[x + 1 for x in @wrap_libsemigroups_call LibSemigroups.wg_dfs_order(g, s)]
+end
+
+"""
+    reachable(g::WordGraph, source::Integer) -> BitVector
+
+Returns which nodes of `g` are reachable from `source`.
+
+Entry `t` of the result is `true` if there is a path (possibly empty) from
+`source` to `t`.
+
+# Throws
+ - `LibsemigroupsError`: if `source` is not a node of `g`.
+
+See also [`bfs_order`](@ref).
+"""
+@cxxdereference function reachable(g::WordGraph, source::Integer)
+    result = falses(number_of_nodes(g))
+    result[bfs_order(g, source)] .= true
+    return result
+end
+
+"""
+    quotient(g::WordGraph, blocks::AbstractVector{<:Integer}) -> WordGraph
+
+Returns the quotient of `g` by a partition of its nodes.
+
+`blocks[s]` is the block containing node `s`, a number from `1` to the
+number of blocks, `maximum(blocks)`. The quotient has one node per block,
+and an edge labelled `a` from the block of `s` to the block of `t`
+whenever `g` has an edge labelled `a` from `s` to `t`.
+
+# Throws
+ - `LibsemigroupsError`: if `length(blocks)` is not the number of nodes of
+   `g`, or if two nodes in the same block have edges with the same label
+   into different blocks, since a word graph has at most one edge with
+   each label from every node.
+ - `InexactError`: if a block is zero or negative.
+
+# Complexity
+``O(mn)`` where ``m`` is the number of nodes and ``n`` is the out-degree.
+"""
+@cxxdereference function quotient(g::WordGraph, blocks::AbstractVector{<:Integer})
+    raw = UInt32[_to_cpp(b) for b in blocks]
+    k = isempty(blocks) ? 0 : Int(maximum(blocks))
+    return @wrap_libsemigroups_call LibSemigroups.wg_quotient(g, raw, UInt(k))
+end
+
+"""
+    csr(g::WordGraph; nthreads::Integer = 1) -> NamedTuple
+
+Returns the edges of `g` in compressed sparse row form.
+
+The result has fields `offsets`, `targets` and `labels`, all
+`Vector{Int}` and 1-based: the edges with source `s` are
+`targets[k]` with label `labels[k]` for `k` in
+`offsets[s]:offsets[s + 1] - 1`, in label order. Missing edges are
+omitted, so `length(targets) == number_of_edges(g)`. The nodes are split
+between at most `nthreads` threads.
+
+This is the adjacency-list layout used by most graph libraries. For
+example, with Graphs.jl:
+
+```julia
+using Graphs
+c = csr(g)
+h = SimpleDiGraph(number_of_nodes(g))
+for s in 1:number_of_nodes(g), k in c.offsets[s]:c.offsets[s+1]-1
+    add_edge!(h, s, c.targets[k])
+end
+```
+
+# Complexity
+``O(mn)`` where ``m`` is the number of nodes and ``n`` is the out-degree.
+"""
+@cxxdereference function csr(g::WordGraph; nthreads::Integer = 1)
+    n = number_of_nodes(g)
+    e = number_of_edges(g)
+    offsets = Vector{UInt64}(undef, n + 1)
+    targets = Vector{UInt32}(undef, e)
+    labels = Vector{UInt32}(undef, e)
+    @wrap_libsemigroups_call LibSemigroups.wg_csr!(
+        g,
+        offsets,
+        targets,
+        labels,
+        UInt(nthreads),
+    )
+    return (
+        offsets = Int[x + 1 for x in offsets],
+        targets = Int[x + 1 for x in targets],
+        labels = Int[x + 1 for x in labels],
+    )
+end
+
 # ============================================================================
 # Display
 # ============================================================================
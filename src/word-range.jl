@@ -294,6 +294,44 @@ function Base.iterate(r::WordRange, state = nothing)
     return (w, nothing)
 end
 
+# ============================================================================
+# Bulk enumeration
+# ============================================================================
+# Each `get` copies one word across the C++/Julia boundary; these advance the
+# range in C++ and hand back many words at once in packed form.
+
+"""
+    take!(r::WordRange, n::Integer) -> PackedWordVector
+
+Remove the next (at most) `n` words from `r` and return them.
+
+The range is advanced in C++ and the words are returned as a
+[`PackedWordVector`](@ref), so no word is converted until it is accessed.
+Fewer than `n` words are returned only if `r` is exhausted.
+
+# Throws
+- `ArgumentError`: if `n` is negative.
+
+See also [`fill!`](@ref Base.fill!(::PackedWordBuffer, ::WordRange)).
+"""
+Base.take!(r::WordRange, n::Integer) = _take_words(r, n)
+
+"""
+    fill!(buf::PackedWordBuffer, r::WordRange) -> PackedWordBuffer
+
+Overwrite `buf` with the next words of `r`, for as long as they fit, and
+advance `r` past them.
+
+Afterwards `length(buf)` is the number of words written, which is `0` only
+if `r` is exhausted or `buf` has room for no words. Unlike [`take!`](@ref Base.take!(::WordRange, ::Integer)),
+this allocates nothing.
+
+# Throws
+- `ArgumentError`: if the next word of `r` is longer than the letter
+  capacity of `buf`.
+"""
+Base.fill!(buf::PackedWordBuffer, r::WordRange) = _fill_buffer!(buf, r, () -> at_end(r))
+
 # ============================================================================
 # Free functions
 # ============================================================================
@@ -15,6 +15,7 @@ using Semigroups
     include("test_bmat8.jl")
     include("test_constants.jl")
     include("test_errors.jl")
+    include("test_binding_profile.jl")
     include("test_order.jl")
     include("test_runner.jl")
     include("test_transf.jl")
@@ -28,4 +29,5 @@ using Semigroups
     include("test_knuth_bendix_6.jl")
     include("test_todd_coxeter.jl")
     include("test_kambites.jl")
+    include("test_congruence.jl")
 end
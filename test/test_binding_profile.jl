@@ -0,0 +1,55 @@
+# Copyright (c) 2026, James W. Swent
+#
+# Distributed under the terms of the GPL license version 3.
+#
+# The full license is in the file LICENSE, distributed with this software.
+
+"""
+test_binding_profile.jl - Tests for the counters of instrumented bindings
+"""
+
+@testset "Binding profile" begin
+    p = Presentation()
+    set_alphabet!(p, 2)
+    add_rule!(p, [1, 1, 1], [1])
+    add_rule!(p, [2, 2], [2])
+    add_rule!(p, [1, 2, 1, 2], [1])
+    tc = ToddCoxeter(twosided, p)
+    words = [[1, 2, 2, 1], [2, 1, 1, 1], [1, 2, 1, 2, 1]]
+
+    reset_binding_profile!()
+    for w in words
+        Semigroups.reduce(tc, w)
+    end
+    batch_reduce(tc, words)
+    profile = binding_profile()
+
+    if binding_profile_enabled()
+        entry(name) = only(e for e in profile if e.method == name)
+        single = entry("cong_common_reduce(ToddCoxeterWord)")
+        batch = entry("cong_common_reduce_batch(ToddCoxeterWord)")
+        @test single.calls == length(words)
+        @test batch.calls == 1
+        @test single.bytes_copied >= sum(length, words) * sizeof(UInt)
+        @test batch.bytes_copied >= sum(length, words) * sizeof(UInt)
+        @test issorted(profile; by = e -> e.time, rev = true)
+
+        # An element returned by copy counts its bytes, including a BMat8
+        S = FroidurePin(BMat8([[0, 1], [1, 0]]), BMat8([[1, 0], [1, 1]]))
+        n = length(S)
+        reset_binding_profile!()
+        for i = 1:n
+            S[i]
+        end
+        at = only(e for e in binding_profile() if e.method == "at(FroidurePinBMat8)")
+        @test at.calls == n
+        @test at.bytes_copied == 8n  # one UInt64 per matrix
+
+        reset_binding_profile!()
+        @test isempty(binding_profile())
+    else
+        @test isempty(profile)
+        shown = sprint(show, MIME"text/plain"(), profile)
+        @test occursin("SEMIGROUPS_PROFILE_BINDINGS", shown)
+    end
+end
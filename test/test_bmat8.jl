@@ -150,4 +150,65 @@ using Semigroups
             [0, 0, 0, 0, 0, 0, 0, 0],
         ]
     end
+
+    @testset "PackedElementVector and batch_multiply!" begin
+        xs = [random(BMat8, 8) for _ = 1:20]
+        ys = [random(BMat8, 8) for _ = 1:20]
+        px = PackedElementVector(xs)
+        py = PackedElementVector(ys)
+        @test px isa PackedElementVector{BMat8}
+        @test px.images == reshape(to_int.(xs), 1, :)
+        @test collect(px) == xs
+
+        @test collect(batch_multiply(px, py)) == xs .* ys
+        @test collect(batch_multiply(px, ys[1])) == xs .* Ref(ys[1])
+        @test collect(batch_multiply(xs[1], py)) == Ref(xs[1]) .* ys
+
+        batch_multiply!(px, px, py)
+        @test collect(px) == xs .* ys
+
+        @test_throws LibsemigroupsError batch_multiply!(similar(px, 3), px, py)
+    end
+
+    @testset "batched BMat8 helpers" begin
+        values = [to_int(random(BMat8, 4)) for _ = 1:200]
+        xs = PackedElementVector{BMat8}(values)
+        ms = BMat8.(values)
+        @test collect(xs) == ms
+        xs[1] = BMat8(0)
+        @test values[1] == 0
+        ms[1] = BMat8(0)
+
+        @test collect(batch_transpose(xs)) == transpose.(ms)
+        @test collect(batch_transpose(xs; nthreads = 4)) == transpose.(ms)
+        @test collect(batch_row_space_basis(xs; nthreads = 3)) == row_space_basis.(ms)
+        @test collect(batch_col_space_basis(xs)) == col_space_basis.(ms)
+        @test batch_is_regular_element(xs; nthreads = 2) == is_regular_element.(ms)
+
+        ys = PackedElementVector{BMat8}(copy(values))
+        batch_transpose!(ys, ys)
+        batch_transpose!(ys, ys; nthreads = 4)
+        @test collect(ys) == ms
+        @test_throws LibsemigroupsError batch_transpose!(similar(xs, 3), xs)
+
+        groups, bases = group_by_row_space(xs; nthreads = 4)
+        @test length(groups) == length(xs)
+        @test length(bases) == maximum(groups)
+        @test length(bases) == length(unique(row_space_basis.(ms)))
+        @test groups[1] == 1
+        @test unique(groups) == 1:length(bases)
+        for k in eachindex(ms)
+            @test bases[groups[k]] == row_space_basis(ms[k])
+        end
+
+        zs = PackedElementVector([
+            BMat8([[1, 0], [0, 1]]),
+            BMat8([[0, 1], [1, 0]]),
+            BMat8([[1, 1], [0, 0]]),
+        ])
+        groups, bases = group_by_row_space(zs)
+        @test groups == [1, 1, 2]
+        @test bases[2] == BMat8([[1, 1], [0, 0]])
+        @test group_by_row_space(similar(zs, 0)) == (Int[], similar(zs, 0))
+    end
 end
@@ -0,0 +1,127 @@
+# Copyright (c) 2026, James W. Swent
+#
+# Distributed under the terms of the GPL license version 3.
+
+"""
+test_congruence.jl - Tests for the Congruence and CongruenceRace Julia API.
+"""
+
+using Test
+using Semigroups
+using Dates: Nanosecond
+
+function _cong_test_presentation()
+    # a^3 = a, a = b^2
+    p = Presentation()
+    set_alphabet!(p, 2)
+    add_rule_no_checks!(p, [1, 1, 1], [1])
+    add_rule_no_checks!(p, [1], [2, 2])
+    return p
+end
+
+@testset "Congruence - max_threads and the winner" begin
+    p = _cong_test_presentation()
+    expected = number_of_classes(ToddCoxeter(twosided, p))
+
+    c = Congruence(twosided, p)
+    @test max_threads(c) == 1
+    @test max_threads!(c, 2) === c
+    @test max_threads(c) == 2
+    @test_throws ArgumentError max_threads!(c, -1)
+    @test max_threads(c) == 2
+    @test number_of_runners(c) > 1
+
+    @test number_of_classes(c) == expected
+    @test finished(c)
+    @test number_of_runners(c) == 1
+    @test count(T -> has(c, T), (KnuthBendix, ToddCoxeter, Kambites)) == 1
+
+    T = only(filter(T -> has(c, T), (KnuthBendix, ToddCoxeter, Kambites)))
+    @test finished(get(c, T))
+    @test_throws ArgumentError get(c, T === ToddCoxeter ? KnuthBendix : ToddCoxeter)
+end
+
+@testset "CongruenceRace - extra competitors and per-runner stats" begin
+    p = _cong_test_presentation()
+    expected = number_of_classes(ToddCoxeter(twosided, p))
+
+    race = CongruenceRace()
+    @test number_of_runners(race) == 0
+    @test winner(race) === UNDEFINED
+    @test_throws LibsemigroupsError run!(race)
+    @test_throws LibsemigroupsError max_threads!(race, 0)
+    @test_throws ArgumentError max_threads!(race, -1)
+
+    for s in (strategy_hlt, strategy_felsch)
+        tc = ToddCoxeter(twosided, p)
+        strategy!(tc, s)
+        push!(race, tc)
+    end
+    kb = KnuthBendix(twosided, p)
+    push!(race, kb)
+    @test !finished(kb)  # competitors are copies
+    @test length(race) == 3
+
+    @test max_threads!(race, 3) === race
+    @test max_threads(race) == 3
+    @test run!(race) === race
+    @test started(race)
+    @test_throws LibsemigroupsError push!(race, kb)
+
+    w = winner(race)
+    @test w in 1:3
+    stats = runner_stats(race)
+    @test length(stats) == 3
+    @test [s.algorithm for s in stats] == [:ToddCoxeter, :ToddCoxeter, :KnuthBendix]
+    @test all(s -> s.ran, stats)
+    @test stats[w].finished
+    @test stats[w].size > 0
+    @test all(s -> s.elapsed <= running_for_how_long(race), stats)
+
+    winner_copy = race[w]
+    @test finished(winner_copy)
+    @test number_of_classes(winner_copy) == expected
+    @test_throws LibsemigroupsError race[4]
+    @test_throws LibsemigroupsError race[0]
+    @test_throws LibsemigroupsError race[-1]
+
+    # Only the first max_threads competitors take part
+    race = CongruenceRace()
+    push!(race, ToddCoxeter(twosided, p))
+    push!(race, KnuthBendix(twosided, p))
+    run!(race)
+    @test winner(race) == 1
+    stats = runner_stats(race)
+    @test stats[1].ran && stats[1].finished
+    @test !stats[2].ran && !stats[2].finished
+end
+
+@testset "run_batch - many presentations on a thread pool" begin
+    ps = [monogenic_semigroup(m, r) for m = 1:4 for r = 1:3]
+    jobs = CongruenceJob[]
+    for p in ps
+        push!(jobs, CongruenceJob(ToddCoxeter, twosided, p; strategy = strategy_felsch))
+        push!(jobs, CongruenceJob(KnuthBendix(twosided, p)))
+    end
+    ch = run_batch(jobs; nthreads = 3)
+    @test ch isa Channel{BatchResult}
+    results = sort!(collect(ch); by = r -> r.index)
+    @test [r.index for r in results] == 1:length(jobs)
+    @test all(r -> r.finished && r.error === nothing, results)
+    for (i, p) in enumerate(ps)
+        expected = number_of_classes(ToddCoxeter(twosided, p))
+        @test results[2i-1].number_of_classes == expected
+        @test results[2i].number_of_classes == expected
+    end
+
+    # A timeout that cannot be met leaves the job unfinished
+    p = full_transformation_monoid(5)
+    r = only(collect(run_batch([CongruenceJob(ToddCoxeter, twosided, p; timeout = Nanosecond(1))])))
+    @test !r.finished
+    @test r.number_of_classes === nothing
+    @test !isempty(r.why_stopped)
+
+    @test isempty(collect(run_batch(CongruenceJob[])))
+    @test_throws ArgumentError run_batch(jobs; nthreads = 0)
+    @test_throws ArgumentError CongruenceJob(ToddCoxeter, twosided, ps[1]; no_such_setting = 1)
+end
@@ -874,6 +874,16 @@ ReportGuard(false) do
                     @test Semigroups.position(S, generator(S, g) * x) == target(lcg, i, g)
                 end
             end
+
+            # Bulk tables agree with the graphs (raw 0-based entries)
+            rt = right_cayley_table(S)
+            lt = left_cayley_table(S)
+            @test size(rt) == (length(S), 5)
+            @test rt == target_table(rcg)
+            @test lt == target_table(lcg)
+            @test current_right_cayley_table(S) == rt
+            @test current_left_cayley_table(S) == lt
+            @test all(Int(rt[i, g]) + 1 == target(rcg, i, g) for i = 1:length(S), g = 1:5)
         end
 
         # -----------------------------------------------------------------------
@@ -1157,6 +1167,61 @@ ReportGuard(false) do
             test_current_rules_iterator(S)
         end
 
+        @testset "rules and normal forms in chunks" begin
+            S = FroidurePin(
+                Transf([1, 2, 3, 4, 5, 6]),
+                Transf([2, 1, 3, 4, 5, 6]),
+                Transf([5, 1, 2, 3, 4, 6]),
+                Transf([6, 2, 3, 4, 5, 6]),
+                Transf([2, 2, 3, 4, 5, 6]),
+            )
+            unpack(c) = [
+                Int.(c.letters[c.offsets[i]+1:c.offsets[i+1]]) .+ 1 for
+                i = 1:length(c.offsets)-1
+            ]
+
+            # Nothing discovered yet
+            @test isempty(collect(current_rules_chunks(S)))
+
+            # Normal forms: chunk boundaries, order and contents
+            chunks = collect(normal_forms_chunks(S, 1000))
+            @test length(chunks) == cld(length(S), 1000)
+            @test all(c -> c.offsets[1] == 0, chunks)
+            @test all(c -> length(c.offsets) - 1 <= 1000, chunks)
+            @test reduce(vcat, unpack.(chunks)) == normal_forms(S)
+            @test chunk_size(normal_forms_chunks(S, 7)) == 7
+
+            # Rules: interleaved lhs, rhs
+            words = reduce(vcat, unpack.(rules_chunks(S, 100)))
+            @test length(words) == 2 * number_of_rules(S)
+            @test [words[2i-1] => words[2i] for i = 1:number_of_rules(S)] == rules(S)
+            @test reduce(vcat, unpack.(current_rules_chunks(S, 100))) == words
+            @test reduce(vcat, unpack.(current_normal_forms_chunks(S))) ==
+                  normal_forms(S)
+
+            @test_throws LibsemigroupsError normal_forms_chunks(S, 0)
+
+            # Packed words: lazy views over chunks and materialized results
+            nf = normal_forms(S)
+            @test nf isa PackedWordVector
+            @test length(nf) == length(S)
+            c = first(normal_forms_chunks(S, 10))
+            v = PackedWordVector(c.letters, c.offsets)
+            @test length(v) == 10
+            @test v == nf[1:10]
+            @test raw_letters(v, 2) == UInt.(nf[2] .- 1)
+            @test_throws BoundsError v[11]
+            @test_throws ArgumentError PackedWordVector(UInt[0], UInt64[0])
+
+            # A stream is invalidated by further enumeration
+            T = FroidurePin(Transf([2, 1, 3, 4, 5, 6]), Transf([5, 1, 2, 3, 4, 6]))
+            set_batch_size!(T, 10)
+            enumerate!(T, 10)
+            c = current_normal_forms_chunks(T, 1)
+            run!(T)
+            @test_throws LibsemigroupsError collect(c)
+        end
+
         # -----------------------------------------------------------------------
         # Test 094: "rules [copy_closure, duplicate gens]" [quick]
         # -----------------------------------------------------------------------
@@ -1474,6 +1539,352 @@ ReportGuard(false) do
             @test_throws LibsemigroupsError push!(S, Transf([1, 2, 3, 4, 4, 4, 4]))  # degree 7
         end
 
+        @testset "save_froidure_pin and FrozenFroidurePin" begin
+            S = FroidurePin(
+                Transf([2, 1, 3, 4, 5]),
+                Transf([2, 3, 4, 5, 1]),
+                Transf([1, 1, 3, 4, 5]),
+            )
+            mktempdir() do dir
+                path = joinpath(dir, "t5.fp")
+                @test save_froidure_pin(S, path) == path
+                @test finished(S)
+
+                F = FrozenFroidurePin(path)
+                @test F isa FrozenFroidurePin{Transf{UInt8}}
+                @test length(F) == length(S) == 3125
+                @test degree(F) == 5
+                @test number_of_generators(F) == 3
+                @test collect(F) == collect(S)
+                @test F[17] == S[17]
+                @test_throws BoundsError F[length(F) + 1]
+                @test generator(F, 2) == generator(S, 2)
+
+                for i in (1, 2, 100, 3125), j in (1, 3, 999, 3125)
+                    @test fast_product(F, i, j) == fast_product(S, i, j)
+                end
+                for i in (1, 4, 500, 3125)
+                    @test minimal_factorisation(F, i) == minimal_factorisation(S, i)
+                    @test sorted_at(F, i) == sorted_at(S, i)
+                    @test to_sorted_position(F, i) == to_sorted_position(S, i)
+                    @test prefix(F, i) == prefix(S, i)
+                    @test suffix(F, i) == suffix(S, i)
+                    @test word_length(F, i) == word_length(S, i)
+                    @test position(F, S[i]) == i
+                    @test sorted_position(F, S[i]) == sorted_position(S, S[i])
+                end
+                @test position(F, [2, 3, 1]) == position(S, [2, 3, 1])
+                @test_throws LibsemigroupsError position(F, [4])
+                @test Transf([5, 5, 5, 5, 5]) in F
+                @test position(F, Transf([1, 2, 3])) === UNDEFINED
+
+                @test number_of_idempotents(F) == number_of_idempotents(S)
+                @test idempotents(F) == idempotents(S)
+                @test count(i -> is_idempotent(F, i), 1:length(F)) == number_of_idempotents(S)
+                @test_throws LibsemigroupsError fast_product(F, 0, 1)
+
+                # Wrong element type, corrupt and missing files
+                @test_throws LibsemigroupsError FrozenFroidurePin{Perm{UInt8}}(path)
+                bytes = read(path)
+                write(path, bytes[1:end-8])
+                err = try
+                    FrozenFroidurePin(path)
+                catch e
+                    e
+                end
+                @test err isa LibsemigroupsError
+                @test occursin("expected $(length(bytes)) bytes", err.msg)
+                @test occursin("found $(length(bytes) - 8) bytes", err.msg)
+                write(path, vcat(bytes, zeros(UInt8, 8)))
+                @test_throws LibsemigroupsError FrozenFroidurePin(path)
+                write(path, "not a FroidurePin")
+                @test_throws LibsemigroupsError FrozenFroidurePin(path)
+                @test_throws LibsemigroupsError FrozenFroidurePin(joinpath(dir, "missing"))
+            end
+        end
+
+        @testset "enumerating on several threads when saving" begin
+            gens = [
+                Transf([2, 1, 3, 4, 5]),
+                Transf([2, 3, 4, 5, 1]),
+                Transf([2, 1, 3, 4, 5]),  # repeated generator
+                Transf([1, 1, 3, 4, 5]),
+            ]
+            S = FroidurePin(gens)
+            @test save_threads(S) == 1
+            @test save_threads!(S, 4) === S
+            @test save_threads(S) == 4
+            @test save_threads(copy(S)) == 4
+            @test_throws ArgumentError save_threads!(S, 0)
+
+            mktempdir() do dir
+                # The same file as for one thread, without enumerating S
+                save_froidure_pin(S, joinpath(dir, "parallel.fp"))
+                @test !started(S)
+                save_froidure_pin(FroidurePin(gens), joinpath(dir, "serial.fp"))
+                @test read(joinpath(dir, "parallel.fp")) == read(joinpath(dir, "serial.fp"))
+
+                # Wider scalars and dynamic degree
+                T = FroidurePin([Transf(x, UInt16) for x in ([2, 3, 1, 4], [1, 1, 3, 4])])
+                save_threads!(T, 3)
+                save_froidure_pin(T, joinpath(dir, "parallel.fp"))
+                save_froidure_pin(copy(save_threads!(T, 1)), joinpath(dir, "serial.fp"))
+                @test read(joinpath(dir, "parallel.fp")) == read(joinpath(dir, "serial.fp"))
+
+                # A FroidurePin already running is saved as it is
+                U = save_threads!(FroidurePin(gens), 2)
+                enumerate!(U, 10)
+                save_froidure_pin(U, joinpath(dir, "u.fp"))
+                @test finished(U)
+                @test collect(FrozenFroidurePin(joinpath(dir, "u.fp"))) == collect(U)
+            end
+        end
+
+        @testset "memory usage and compact mode" begin
+            gens =
+                [Transf([2, 1, 3, 4, 5]), Transf([2, 3, 4, 5, 1]), Transf([1, 1, 3, 4, 5])]
+            S = FroidurePin(gens)
+            m = memory_usage(S)
+            @test m.left_cayley_graph == 0
+            enumerate!(S, 1000)
+            m = memory_usage(S)
+            @test m.total == sum(values(m)) - m.total
+            @test m.right_cayley_graph == m.left_cayley_graph
+            @test m.right_cayley_graph == 4 * 3 * current_size(S)
+            @test all(>(0), values(m))
+
+            C = FroidurePin(gens)
+            @test compact_mode(C) == false
+            @test compact_mode!(C, true) === C
+            @test compact_mode(copy(C))
+            mktempdir() do dir
+                save_froidure_pin(FroidurePin(gens), joinpath(dir, "full.fp"))
+                save_froidure_pin(C, joinpath(dir, "compact.fp"))
+                @test !started(C)
+                save_threads!(compact_mode!(S, true), 2)
+                save_froidure_pin(S, joinpath(dir, "started.fp"))
+
+                F = FrozenFroidurePin(joinpath(dir, "full.fp"))
+                @test Semigroups._has_left_cayley_graph(F)
+                @test filesize(joinpath(dir, "compact.fp")) <
+                      filesize(joinpath(dir, "full.fp"))
+                for name in ("compact.fp", "started.fp")
+                    G = FrozenFroidurePin(joinpath(dir, name))
+                    @test !Semigroups._has_left_cayley_graph(G)
+                    @test collect(G) == collect(F)
+                    @test sorted_at(G, 17) == sorted_at(F, 17)
+                    @test idempotents(G) == idempotents(F)
+                    for i in (1, 2, 100, 3125), j in (1, 3, 999, 3125)
+                        @test fast_product(G, i, j) == fast_product(F, i, j)
+                    end
+                end
+
+                # Whether a file is compact is read from its header, so a
+                # full file cut to the size of a compact one is rejected
+                full = read(joinpath(dir, "full.fp"))
+                cut = joinpath(dir, "cut.fp")
+                write(cut, full[1:filesize(joinpath(dir, "compact.fp"))])
+                @test_throws LibsemigroupsError FrozenFroidurePin(cut)
+            end
+        end
+
+        # -----------------------------------------------------------------------
+        # Static degree FroidurePin instantiations
+        # -----------------------------------------------------------------------
+        @testset "static degree storage" begin
+            gens = [
+                Transf([2, 1, 3, 4, 5]),
+                Transf([2, 3, 4, 5, 1]),
+                Transf([1, 1, 3, 4, 5]),
+            ]
+            S = FroidurePin(gens)
+            @test S.cxx_obj isa Semigroups._FroidurePinStaticTransf[5]
+
+            # The same semigroup stored with dynamic degree
+            D = FroidurePin{Transf{UInt8}}(
+                Semigroups.FroidurePinTransf1(gens[1].cxx_obj, gens[2].cxx_obj),
+            )
+            push!(D, gens[3])
+            @test length(S) == length(D) == 3125
+            @test collect(S) == collect(D)
+            @test sorted_elements(S) == sorted_elements(D)
+            @test idempotents(S) == idempotents(D)
+            @test S[100] isa Transf{UInt8}
+            @test position(S, D[100]) == 100
+            @test minimal_factorisation(S, 100) == minimal_factorisation(D, 100)
+
+            # Elements of another degree are in neither
+            x = Transf([1, 2, 3, 4, 5, 6])
+            @test !(x in S)
+            @test position(S, x) === UNDEFINED
+            @test current_position(S, x) === UNDEFINED
+            @test sorted_position(S, x) === UNDEFINED
+            @test_throws LibsemigroupsError push!(S, x)
+            @test_throws LibsemigroupsError copy_closure(S, x)
+            @test_throws LibsemigroupsError FroidurePin(gens[1], x)
+
+            # Static and dynamic degree FroidurePins save the same file
+            mktempdir() do dir
+                save_froidure_pin(S, joinpath(dir, "s.fp"))
+                save_froidure_pin(D, joinpath(dir, "d.fp"))
+                @test read(joinpath(dir, "s.fp")) == read(joinpath(dir, "d.fp"))
+                F = FrozenFroidurePin(joinpath(dir, "s.fp"))
+                @test F isa FrozenFroidurePin{Transf{UInt8}}
+                @test collect(F) == collect(S)
+            end
+
+            # Partial permutations and permutations
+            P = FroidurePin(PPerm([2, 3, UNDEFINED, 1]), PPerm([2, 1, 3, 4]))
+            @test P.cxx_obj isa Semigroups._FroidurePinStaticPPerm[4]
+            @test PPerm([2, 3, UNDEFINED, 1]) in P
+            G = FroidurePin(Perm([2, 3, 4, 5, 6, 7, 1]), Perm([2, 1, 3, 4, 5, 6, 7]))
+            @test G.cxx_obj isa Semigroups._FroidurePinStaticPerm[7]
+            @test length(G) == 5040
+
+            # Too large a degree, or a wider scalar type, is stored dynamically
+            T = FroidurePin(Transf(collect(1:17)))
+            @test T.cxx_obj isa Semigroups.FroidurePinTransf1
+            @test FroidurePin(Transf([2, 1, 3], UInt16)).cxx_obj isa
+                  Semigroups.FroidurePinTransf2
+        end
+
+        # -----------------------------------------------------------------------
+        # Many generators in one call
+        # -----------------------------------------------------------------------
+        @testset "bulk generators" begin
+            gens = [Transf([2, 1, 3, 4]), Transf([2, 3, 4, 1]), Transf([1, 1, 3, 4])]
+            for S in (
+                FroidurePin(gens),
+                FroidurePin(PackedElementVector(gens)),
+                add_generators!(FroidurePin(gens[1]), gens[2:3]),
+                add_generators!(FroidurePin(gens[1]), PackedElementVector(gens[2:3])),
+            )
+                @test number_of_generators(S) == 3
+                @test [generator(S, i) for i = 1:3] == gens
+                @test length(S) == 256
+            end
+
+            # closure! skips elements that are already contained
+            S = FroidurePin(gens[1])
+            T = copy_closure(S, [gens[1], gens[2], gens[1] * gens[2]])
+            @test number_of_generators(S) == 1
+            @test length(T) == 24
+            closure!(S, [gens[1], gens[2], gens[1] * gens[2]])
+            @test number_of_generators(S) == number_of_generators(T)
+            @test length(S) == 24
+
+            U = copy_add_generators(S, [gens[3], gens[3]])
+            @test number_of_generators(U) == number_of_generators(S) + 2
+            @test length(U) == 256
+            @test length(S) == 24
+
+            # No elements
+            @test number_of_generators(add_generators!(S, Transf{UInt8}[])) ==
+                  number_of_generators(T)
+            @test length(copy_closure(S, Transf{UInt8}[])) == 24
+
+            # Many generators, more than the 4 positional constructors take
+            n = 17
+            gens = [Transf([j == i ? mod1(i + 1, n) : j for j = 1:n]) for i = 1:n]
+            S = FroidurePin(gens)
+            @test number_of_generators(S) == n
+            @test all(generator(S, i) == gens[i] for i = 1:n)
+
+            # Errors
+            S = FroidurePin(Transf([2, 1, 3]))
+            empty = PackedElementVector{Transf{UInt8}}(undef, 3, 0)
+            @test_throws ErrorException FroidurePin(empty)
+            mixed = [Transf([1, 2]), Transf([1, 2, 3])]
+            @test_throws ArgumentError add_generators!(S, mixed)
+            @test_throws LibsemigroupsError add_generators!(S, [Transf([1, 2, 3, 4])])
+            @test_throws LibsemigroupsError closure!(S, [Transf([1, 2, 3, 4])])
+            @test_throws LibsemigroupsError FroidurePin(mixed)
+        end
+
+        @testset "cached idempotent and sorted positions" begin
+            S = FroidurePin(Transf([2, 3, 4, 5, 1]), Transf([2, 1, 3, 4, 5]))
+            push!(S, Transf([1, 1, 3, 4, 5]))
+            n = length(S)
+            @test n == 3125
+
+            positions = idempotent_positions(S)
+            @test positions isa Vector{UInt32}
+            @test issorted(positions)
+            @test positions == findall(i -> S[i] * S[i] == S[i], 1:n)
+            @test length(positions) == number_of_idempotents(S)
+            @test idempotents(S) == [S[Int(i)] for i in positions]
+            @test all(is_idempotent(S, i) == (i in positions) for i = 1:n)
+            @test_throws LibsemigroupsError is_idempotent(S, n + 1)
+
+            # The scan gives the same result on several threads
+            @test idempotent_positions(copy(S); nthreads = 4) == positions
+            @test number_of_idempotents(copy(S); nthreads = 4) == length(positions)
+            @test_throws ArgumentError idempotent_positions(copy(S); nthreads = 0)
+
+            order = sorted_positions(S)
+            @test order isa Vector{UInt32}
+            @test sort(order) == 1:n
+            @test [S[Int(i)] for i in order] == sorted_elements(S)
+            @test issorted(sorted_elements(S))
+            @test all(sorted_at(S, k) == S[Int(order[k])] for k = 1:n)
+            @test all(to_sorted_position(S, order[k]) == k for k = 1:n)
+            @test all(sorted_position(S, S[i]) == to_sorted_position(S, i) for i = 1:n)
+            @test to_sorted_position(S, n + 1) === UNDEFINED
+            @test_throws LibsemigroupsError sorted_at(S, n + 1)
+
+            # The caches are dropped when the generators change
+            S = FroidurePin(Transf([2, 1, 3]))
+            @test idempotent_positions(S) == [UInt32(2)]
+            @test sorted_positions(S) == [UInt32(2), UInt32(1)]
+            push!(S, Transf([1, 1, 3]))
+            @test length(idempotent_positions(S)) == number_of_idempotents(S) == 3
+            @test length(sorted_positions(S)) == length(S) == 4
+        end
+
+        @testset "ToddCoxeter, KnuthBendix and Presentation conversions" begin
+            S = FroidurePin(Transf([2, 1, 3]), Transf([1, 1, 3]))
+            @test length(S) == 4
+
+            tc = ToddCoxeter(twosided, S)
+            @test tc isa ToddCoxeter
+            @test number_of_classes(tc) == 4
+            tc = ToddCoxeter(onesided, S, left_cayley_graph(S))
+            @test number_of_classes(tc) == 4
+            tc = ToddCoxeter(twosided, S)
+            add_generating_pair!(tc, [1], [2])
+            @test number_of_classes(tc) == 1
+            T = FroidurePin(Transf([2, 1, 3]))
+            @test_throws LibsemigroupsError ToddCoxeter(twosided, S, right_cayley_graph(T))
+
+            kb = KnuthBendix(twosided, S)
+            @test kb isa KnuthBendix
+            @test number_of_classes(kb) == 4
+
+            p = Presentation()
+            set_alphabet!(p, 2)
+            add_rule!(p, [1, 1], [1])
+            add_rule!(p, [2, 2], [2])
+            add_rule!(p, [1, 2, 1], [1])
+            U = FroidurePin(p)
+            @test U isa FroidurePin{Transf{UInt8}}
+            @test number_of_generators(U) == 2
+            @test length(U) == number_of_classes(ToddCoxeter(twosided, p)) == 5
+            @test factorisation(U, 1) == [1]
+        end
+
+        @testset "FroidurePin bindings are registered on first use" begin
+            script = """
+            using Semigroups
+            fps = Semigroups.LibSemigroups.FroidurePins
+            print(fps._initialized[], " ")
+            print(length(FroidurePin(Transf([2, 1, 3]), Transf([2, 3, 1]))), " ")
+            print(fps._initialized[])
+            """
+            project = Base.active_project()
+            cmd = `$(Base.julia_cmd()) --startup-file=no --project=$project -e $script`
+            @test readchomp(cmd) == "false 6 true"
+        end
+
     end  # @testset "FroidurePin<Transf>"
 
 end  # ReportGuard(false)
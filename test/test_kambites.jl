@@ -130,6 +130,61 @@ end
     @test_throws ArgumentError normal_forms(k)
 end
 
+@testset "Kambites - resumable normal forms" begin
+    p = Presentation()
+    set_alphabet!(p, 7)
+    add_rule_no_checks!(p, [1, 2, 3, 4], [1, 1, 1, 5, 1, 1])
+    add_rule_no_checks!(p, [5, 6], [4, 7])
+
+    k = Kambites(twosided, p)
+    expected = collect(normal_forms(k, 60))
+
+    r = KambitesNormalForms(k)
+    @test collect(take!(r, 20)) == expected[1:20]
+    @test collect(take!(r, 20)) == expected[21:40]
+    @test Base.get(r) == expected[41]
+    next!(r)
+    @test !at_end(r)
+    buf = PackedWordBuffer(9, 1000)
+    @test collect(PackedWordVector(fill!(buf, r))) == expected[42:50]
+    @test collect(Iterators.take(r, 10)) == expected[51:60]
+    @test_throws ArgumentError take!(r, -1)
+
+    p_low = Presentation()
+    set_alphabet!(p_low, 2)
+    add_rule_no_checks!(p_low, [1, 1], [2])
+    @test_throws LibsemigroupsError KambitesNormalForms(Kambites(twosided, p_low))
+end
+
+@testset "Kambites - batched queries on several threads" begin
+    p = Presentation()
+    set_alphabet!(p, 7)
+    add_rule_no_checks!(p, [1, 2, 3, 4], [1, 1, 1, 5, 1, 1])
+    add_rule_no_checks!(p, [5, 6], [4, 7])
+
+    k = Kambites(twosided, p)
+    words = [rand(1:7, rand(0:30)) for _ = 1:1000]
+    expected = [Semigroups.reduce(k, w) for w in words]
+    for nthreads in (1, 4)
+        @test collect(batch_reduce(k, words; nthreads = nthreads)) == expected
+    end
+
+    us = [vcat(w, [1, 2, 3, 4]) for w in words]
+    vs = [vcat(w, [1, 1, 1, 5, 1, 1]) for w in words]
+    @test all(batch_contains(k, us, vs; nthreads = 4))
+    @test batch_contains(k, words, expected; nthreads = 4) == fill(true, length(words))
+    @test batch_contains(k, words, reverse(words); nthreads = 4) ==
+          [Semigroups.contains(k, u, v) for (u, v) in zip(words, reverse(words))]
+
+    # Every batch above reused the same three copies of k
+    @test number_of_query_copies(k) == 3
+    @test Semigroups.LibSemigroups.number_made(Semigroups._query_copies(k)) == 3
+    @test free_query_copies!(k) === k
+    @test number_of_query_copies(k) == 0
+    @test collect(batch_reduce(k, words; nthreads = 4)) == expected
+    @test Semigroups.LibSemigroups.number_made(Semigroups._query_copies(k)) == 6
+end
+
 @testset "Kambites - copy round-trip" begin
     p = Presentation()
     set_alphabet!(p, 7)
@@ -1318,3 +1318,193 @@ end
         @test_throws LibsemigroupsError non_trivial_classes(kbq, kbp)
     end
 end
+
+@testset "KnuthBendix - checkpoint and resume" begin
+    p = Presentation()
+    set_alphabet!(p, 2)
+    add_rule!(p, [1, 1, 1], [1])
+    add_rule!(p, [2, 2, 2, 2], [2])
+    add_rule!(p, [1, 2, 1, 2], [1, 1])
+
+    kb = KnuthBendix(twosided, p)
+    expected = number_of_classes(KnuthBendix(twosided, p))
+    max_overlap!(kb, 10)
+    overlap_policy!(kb, overlap_AB_BC)
+
+    mktempdir() do dir
+        path = joinpath(dir, "kb.ckpt")
+        run_for!(kb, Nanosecond(100_000))
+        save_checkpoint(kb, path)
+
+        resumed = load_checkpoint(path)
+        @test resumed isa KnuthBendix
+        @test max_overlap(resumed) == 10
+        @test overlap_policy(resumed) == overlap_AB_BC
+        @test number_of_classes(resumed) == expected
+
+        run_with_checkpoints!(kb, path; every = Millisecond(1))
+        resumed = load_checkpoint(path)
+        @test number_of_classes(resumed) == expected
+        @test Set(active_rules(resumed)) == Set(active_rules(kb))
+    end
+end
+
+@testset "KnuthBendix - rebuild_with_rules!" begin
+    p = Presentation()
+    set_alphabet!(p, 2)
+    add_rule!(p, [1, 1, 1], [1])
+    add_rule!(p, [2, 2], [2])
+
+    kb = KnuthBendix(twosided, p)
+    max_overlap!(kb, 10)
+    @test number_of_classes(kb) == POSITIVE_INFINITY
+
+    diff = rebuild_with_rules!(kb, [[1, 2] => [2, 1]])
+    @test isempty(diff.removed)
+    @test diff.added == [([2, 1], [1, 2])]
+    @test number_of_classes(kb) == 5
+    @test max_overlap(kb) == 10
+    q = Presentation(p)
+    add_rule!(q, [1, 2], [2, 1])
+    @test presentation(kb) == q
+    fresh = KnuthBendix(twosided, q)
+    run!(fresh)
+    @test Set(active_rules(kb)) == Set(active_rules(fresh))
+
+    # a^2 = a makes a^3 = a reducible; normal forms containing aa change
+    cached = Semigroups.reduce(kb, [1, 1, 2])
+    diff = rebuild_with_rules!(kb, [([1, 1], [1])])
+    @test diff.removed == [([1, 1, 1], [1])]
+    @test diff.added == [([1, 1], [1])]
+    @test Semigroups.reduce(kb, [1, 1, 2]) != cached
+    @test number_of_classes(kb) == 3
+    @test Semigroups.contains(kb, [1, 2, 1], [2, 1])
+    add_rule!(q, [1, 1], [1])
+    @test presentation(kb) == q
+
+    # Generating pairs are kept, and not folded into the presentation
+    kb = KnuthBendix(twosided, p)
+    add_generating_pair!(kb, [1, 2], [2, 1])
+    @test !finished(kb)
+    rebuild_with_rules!(kb, [[1, 1] => [1]])
+    r = Presentation(p)
+    add_rule!(r, [1, 1], [1])
+    @test presentation(kb) == r
+    @test number_of_generating_pairs(kb) == 1
+    @test number_of_classes(kb) == 3
+
+    @test_throws LibsemigroupsError rebuild_with_rules!(kb, [[3] => [1]])
+    @test_throws LibsemigroupsError rebuild_with_rules!(KnuthBendix(onesided, p), [[1] => [2]])
+end
+
+@testset "KnuthBendix - rewriter backends" begin
+    p = Presentation()
+    set_alphabet!(p, 2)
+    add_rule!(p, [1, 1, 1], [1])
+    add_rule!(p, [2, 2], [2])
+    add_rule!(p, [1, 2], [2, 1])
+
+    @test knuth_bendix(twosided, p) isa KnuthBendix
+    kb = knuth_bendix(twosided, p; rewriter = :from_left)
+    @test kb isa KnuthBendixRewriteFromLeft
+    @test kb isa CongruenceCommon
+    max_overlap!(kb, 10)
+    @test number_of_classes(kb) == 5
+    @test confluent(kb)
+    @test Set(active_rules(kb)) == Set(active_rules(knuth_bendix(twosided, p)))
+    @test Semigroups.reduce(kb, [2, 1, 2]) == [1, 2]
+    @test copy(kb) isa KnuthBendixRewriteFromLeft
+    @test max_overlap(copy(kb)) == 10
+
+    @test_throws ArgumentError knuth_bendix(twosided, p; rewriter = :bogus)
+    @test_throws ArgumentError knuth_bendix(twosided, p; order = :recursive)
+
+    results = benchmark_knuth_bendix(twosided, p)
+    @test Set(r.rewriter for r in results) == Set([:trie, :from_left])
+    @test all(r.finished for r in results)
+    @test all(r.number_of_active_rules == number_of_active_rules(kb) for r in results)
+    @test all(r.seconds >= 0 for r in results)
+
+    # Checkpoints, compiled reducers, races, and asynchronous and batched runs
+    # accept either rewriter
+    from_left() = knuth_bendix(twosided, p; rewriter = :from_left)
+    mktempdir() do dir
+        path = save_checkpoint(from_left(), joinpath(dir, "from-left.ckpt"))
+        resumed = load_checkpoint(path)
+        @test resumed isa KnuthBendixRewriteFromLeft
+        @test number_of_classes(resumed) == 5
+    end
+    r = CompiledReducer(from_left())
+    @test Semigroups.reduce(r, [2, 1, 2]) == [1, 2]
+    x = from_left()
+    h = run_async!(x)
+    @test wait(h) === x
+    @test last(collect(progress(h))).number_of_pending_rules == 0
+    jobs = [
+        CongruenceJob(from_left()),
+        CongruenceJob(KnuthBendixRewriteFromLeft, twosided, p),
+    ]
+    @test all(r -> r.number_of_classes == 5, collect(run_batch(jobs)))
+
+    race = CongruenceRace()
+    push!(race, from_left())
+    run!(race)
+    @test runner_stats(race)[1].algorithm === :KnuthBendixRewriteFromLeft
+    @test race[1] isa KnuthBendixRewriteFromLeft
+    @test number_of_classes(race[1]) == 5
+end
+
+@testset "KnuthBendix - batched queries on several threads" begin
+    p = Presentation()
+    set_alphabet!(p, 3)
+    add_rule!(p, [1, 1, 1], [1])
+    add_rule!(p, [2, 2], [2])
+    add_rule!(p, [3, 3], Int[])
+    add_rule!(p, [1, 2], [2, 1])
+    add_rule!(p, [3, 1, 3], [2])
+
+    words = [rand(1:3, rand(0:20)) for _ = 1:1000]
+    vs = reverse(words)
+    for kb in (knuth_bendix(twosided, p), knuth_bendix(twosided, p; rewriter = :from_left))
+        expected = [Semigroups.reduce(kb, w) for w in words]
+        for nthreads in (1, 4)
+            @test collect(batch_reduce(kb, words; nthreads = nthreads)) == expected
+        end
+        @test batch_contains(kb, words, vs; nthreads = 4) ==
+              [Semigroups.contains(kb, u, v) for (u, v) in zip(words, vs)]
+        @test all(batch_contains(kb, words, expected; nthreads = 4))
+    end
+end
+
+@testset "KnuthBendix - CompiledReducer" begin
+    p = Presentation()
+    set_alphabet!(p, 3)
+    add_rule!(p, [1, 1, 1], [1])
+    add_rule!(p, [2, 2], [2])
+    add_rule!(p, [3, 3], Int[])
+    add_rule!(p, [1, 2], [2, 1])
+    add_rule!(p, [3, 1, 3], [2])
+
+    kb = KnuthBendix(twosided, p)
+    r = CompiledReducer(kb)
+    @test confluent(kb)
+    @test number_of_rules(r) == number_of_active_rules(kb)
+    @test memory_usage(r) > 0
+
+    words = [rand(1:3, rand(0:12)) for _ = 1:200]
+    expected = [Semigroups.reduce(kb, w) for w in words]
+    @test [Semigroups.reduce(r, w) for w in words] == expected
+    @test collect(batch_reduce(r, words)) == expected
+    @test collect(batch_reduce(r, words; nthreads = 4)) == expected
+    @test collect(batch_reduce(r, batch_reduce(kb, words))) == expected
+    @test isempty(batch_reduce(r, Vector{Int}[]))
+    @test Semigroups.contains(r, [3, 1, 3], [2])
+    @test !Semigroups.contains(r, [1], [2])
+    @test Semigroups.reduce(r, Int[]) == Int[]
+
+    @test_throws LibsemigroupsError Semigroups.reduce(r, [4])
+    @test_throws LibsemigroupsError batch_reduce(r, [[1], [4]])
+    @test_throws LibsemigroupsError CompiledReducer(KnuthBendix(onesided, p))
+    @test CompiledReducer(knuth_bendix(twosided, p; rewriter = :from_left)) isa
+          CompiledReducer
+end
@@ -343,6 +343,70 @@ end
             # 1-based guard: zero is not a valid node.
             @test_throws InexactError source!(Paths(g), 0)
         end
+
+        @testset "bulk enumeration" begin
+            g = _g_paths_001()
+            expected = collect(paths(g; source = 1, max = 3, order = ORDER_LEX))
+
+            p = paths(g; source = 1, max = 3, order = ORDER_LEX)
+            first3 = take!(p, 3)
+            @test first3 isa PackedWordVector
+            @test collect(first3) == expected[1:3]
+            @test collect(take!(p, 1000)) == expected[4:end]
+            @test at_end(p)
+            @test isempty(take!(p, 5))
+
+            p = paths(g; source = 1, max = 3, order = ORDER_LEX)
+            buf = PackedWordBuffer(3, 100)
+            filled = Vector{Int}[]
+            while !at_end(p)
+                append!(filled, PackedWordVector(fill!(buf, p)))
+                @test length(buf) <= 3
+            end
+            @test filled == expected
+            @test isempty(fill!(buf, p))
+
+            # A path longer than the whole letter capacity can never fit.
+            p = paths(g; source = 1, min = 2, max = 3)
+            @test_throws ArgumentError fill!(PackedWordBuffer(1, 1), p)
+            @test_throws ArgumentError take!(p, -1)
+            @test_throws ArgumentError PackedWordBuffer(-1, 0)
+            @test_throws LibsemigroupsError take!(Paths(g), 1)
+            @test_throws LibsemigroupsError fill!(buf, Paths(g))
+        end
+
+        @testset "number_of_paths and count_by_length!" begin
+            g = _g_paths_001()
+            # Counts from "Paths 001 / #1": 1, 3, 6, 8, 9, 9 paths of length
+            # at most 0, 1, ..., so 1, 2, 3, 2, 1, 0 of each length.
+            p = paths(g; source = 1)
+            out = zeros(UInt64, 6)
+            @test count_by_length!(out, p) === out
+            @test out == [1, 2, 3, 2, 1, 0]
+            @test count_by_length!(zeros(UInt64, 6), p; nthreads = 4) == out
+            min!(p, 2)
+            @test count_by_length!(zeros(UInt64, 3), p) == [3, 2, 1]
+
+            p = paths(g; source = 1, max = 3)
+            next!(p)
+            @test number_of_paths(p) == 8
+            @test number_of_paths(p; nthreads = 4) == 8
+            @test count(p) == 7
+
+            p = paths(g; source = 1, max = POSITIVE_INFINITY)
+            @test number_of_paths(p; nthreads = 4) == 9
+
+            # A cycle has infinitely many paths, but finitely many per length.
+            p = paths(_cycle(5); source = 1, target = 1)
+            @test number_of_paths(p) === POSITIVE_INFINITY
+            @test count_by_length!(zeros(UInt64, 11), p) ==
+                  [i % 5 == 0 ? 1 : 0 for i = 0:10]
+            max!(p, 10)
+            @test number_of_paths(p; nthreads = 2) == 3
+
+            @test_throws LibsemigroupsError number_of_paths(Paths(g))
+            @test_throws LibsemigroupsError count_by_length!(out, Paths(g))
+        end
     end
 
     @testset "Paths GC pin" begin
@@ -1,5 +1,6 @@
 using Test
 using Semigroups
+using Dates: Nanosecond
 
 @testset verbose = true "Presentation" begin
     @testset "scaffolding" begin
@@ -225,6 +226,37 @@ using Semigroups
         @test number_of_rules(v) == 0
     end
 
+    @testset "remove_redundant_rules" begin
+        # The commutative band on 2 generators, with [1, 1, 1] = [1] implied
+        # by [1, 1] = [1], and a trivial and a (reversed) duplicate rule.
+        p = Presentation()
+        set_alphabet!(p, 2)
+        add_rule!(p, [1, 1], [1])
+        add_rule!(p, [1, 1, 1], [1])
+        add_rule!(p, [2, 2], [2])
+        add_rule!(p, [1, 2], [2, 1])
+        add_rule!(p, [2], [2])          # trivial
+        add_rule!(p, [1], [1, 1])       # duplicate of rule 1
+
+        for method in (:knuth_bendix, :todd_coxeter), nthreads in (1, 3)
+            result = remove_redundant_rules(p; method = method, nthreads = nthreads)
+            q = result.presentation
+            @test rules(q) == [([1, 1], [1]), ([2, 2], [2]), ([1, 2], [2, 1])]
+            @test [(r.index, r.reason) for r in result.removed] ==
+                  [(5, :trivial), (6, :duplicate), (2, :redundant)]
+            @test (result.removed[3].lhs, result.removed[3].rhs) == ([1, 1, 1], [1])
+        end
+        @test number_of_rules(p) == 6
+
+        # Nothing can be tested once the budget has run out.
+        result = remove_redundant_rules(p; budget = Nanosecond(0))
+        @test number_of_rules(result.presentation) == 4
+        @test all(r.reason !== :redundant for r in result.removed)
+
+        @test_throws ArgumentError remove_redundant_rules(p; method = :kambites)
+        @test_throws ArgumentError remove_redundant_rules(p; nthreads = 0)
+    end
+
     @testset "equality + show" begin
         p = Presentation()
         set_alphabet!(p, 2)
@@ -474,9 +506,10 @@ using Semigroups
         add_rule!(p, [2, 2], [2])
         @test rules(p) == [([1, 1], [1]), ([2, 2], [2])]
 
-        # Binding-surface: rules_vector is a callable C++ method on Presentation.
+        # Binding-surface: rules_vector is a callable C++ method on Presentation,
+        # returning the rules packed and interleaved.
         flat = Semigroups.LibSemigroups.rules_vector(p)
-        @test length(flat) == 2 * number_of_rules(p)
+        @test Semigroups.LibSemigroups.number_of_words(flat) == 2 * number_of_rules(p)
     end
 
     @testset "Base.isempty + Base.hash" begin
@@ -13,7 +13,7 @@ tests are exercised via concrete derived classes (e.g. FroidurePin) once they
 are available.
 """
 
-using Dates: TimePeriod
+using Dates: TimePeriod, Nanosecond
 
 @testset "Runner type aliases" begin
     @test Runner === Semigroups.LibSemigroups.Runner
@@ -71,3 +71,107 @@ end
     @test hasmethod(report_why_we_stopped, Tuple{Runner})
     @test hasmethod(string_why_we_stopped, Tuple{Runner})
 end
+
+@testset "run_async! - non-blocking runs with progress events" begin
+    p = Presentation()
+    set_alphabet!(p, 2)
+    add_rule_no_checks!(p, [1, 1, 1], [1])
+    add_rule_no_checks!(p, [1], [2, 2])
+
+    tc = ToddCoxeter(twosided, p)
+    h = run_async!(tc; interval = Nanosecond(0))
+    @test h isa AsyncRun
+    events = collect(progress(h))
+    @test wait(h) === tc
+    @test !running(h)
+    @test finished(tc)
+    @test !isempty(events)
+    @test keys(last(events)) ==
+          (:elapsed, :cpu_time, :phase, :number_of_nodes, :number_of_edges)
+    @test issorted([ev.elapsed for ev in events])
+    @test all(ev -> ev.phase === :running, events[1:end-1])
+    @test last(events).phase === :finished
+    @test number_of_dropped_events(h) >= 0
+
+    kb = KnuthBendix(twosided, p)
+    h = run_async!(kb)
+    @test wait(h) === kb
+    ev = last(collect(progress(h)))
+    @test ev.number_of_active_rules == number_of_active_rules(kb)
+    @test ev.number_of_pending_rules == 0
+
+    S = FroidurePin(Transf([2, 3, 4, 5, 1]), Transf([2, 1, 3, 4, 5]))
+    h = run_async!(S)
+    wait(h)
+    @test last(collect(progress(h))).current_size == 120
+    @test finished(S)
+
+    # Cancelling a run that cannot finish quickly
+    tc = ToddCoxeter(twosided, full_transformation_monoid(7))
+    h = kill!(run_async!(tc))
+    wait(h)
+    @test !finished(tc)
+    @test last(collect(progress(h))).phase === :killed
+
+    # The final event is kept even when every other event is dropped
+    tc = ToddCoxeter(twosided, p)
+    h = run_async!(tc; interval = Nanosecond(0), capacity = 1)
+    wait(h)
+    @test last(collect(progress(h))).phase === :finished
+
+    # Finalising the handle of a finished run leaves the runner usable
+    tc = ToddCoxeter(twosided, p)
+    h = run_async!(tc)
+    wait(h)
+    h = nothing
+    GC.gc()
+    @test finished(tc)
+    @test number_of_classes(tc) == 5
+    @test Semigroups.contains(tc, [1, 1, 1], [1])
+    @test Semigroups.reduce(tc, [2, 2]) == Semigroups.reduce(tc, [1])
+
+    @test_throws ArgumentError run_async!(ToddCoxeter(twosided, p); capacity = 0)
+end
+
+@testset "report sinks - structured progress records" begin
+    p = Presentation()
+    set_alphabet!(p, 2)
+    add_rule_no_checks!(p, [1, 1, 1], [1])
+    add_rule_no_checks!(p, [1], [2, 2])
+
+    c = ReportCollector()
+    seen = Symbol[]
+    f = rec -> push!(seen, rec.algorithm)
+    kb = KnuthBendix(twosided, p)
+    add_report_sink!(c) do
+        add_report_sink!(f)
+        @test add_report_sink!(f) === f  # registering twice is a no-op
+        @test run_reported!(kb; interval = Nanosecond(0)) === kb
+        remove_report_sink!(f)
+    end
+    @test !isempty(c.records)
+    @test all(rec -> rec.algorithm === :KnuthBendix, c.records)
+    @test length(seen) == length(c.records)
+    rec = last(c.records)
+    @test rec isa ReportRecord
+    @test rec.phase === :finished
+    @test rec.counters.number_of_active_rules == number_of_active_rules(kb)
+    @test rec.counters.total_rules == total_rules(kb)
+    @test rec.cpu_time >= Nanosecond(0)
+
+    # Removed sinks receive nothing more
+    n = length(c.records)
+    run_reported!(ToddCoxeter(twosided, p))
+    @test length(c.records) == n
+
+    # A failing sink is logged and does not stop the others
+    c = ReportCollector()
+    bad = rec -> error("boom")
+    add_report_sink!(bad)
+    add_report_sink!(c) do
+        @test_logs (:error,) match_mode = :any run_reported!(ToddCoxeter(twosided, p))
+    end
+    remove_report_sink!(bad)
+    @test last(c.records).algorithm === :ToddCoxeter
+    @test last(c.records).phase === :finished
+end
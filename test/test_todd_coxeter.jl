@@ -239,6 +239,54 @@ end
     @test def_policy(tc) == def_policy_purge_all
 end
 
+@testset "TC sizing settings and tune_for_size!" begin
+    p = Presentation()
+    set_alphabet!(p, 2)
+    add_rule_no_checks!(p, _tc_word(0, 0, 0), _tc_word(0))
+    add_rule_no_checks!(p, _tc_word(1, 1, 1, 1), _tc_word(1))
+    add_rule_no_checks!(p, _tc_word(0, 1, 0, 1), _tc_word(0, 0))
+    tc = ToddCoxeter(twosided, p)
+
+    @test lookahead_next!(tc, 1_000) === tc
+    @test lookahead_next(tc) == 1_000
+    lookahead_min!(tc, 100)
+    @test lookahead_min(tc) == 100
+    lookahead_growth_factor!(tc, 1.5)
+    @test lookahead_growth_factor(tc) == 1.5
+    lookahead_growth_threshold!(tc, 8)
+    @test lookahead_growth_threshold(tc) == 8
+    hlt_defs!(tc, 1_000)
+    @test hlt_defs(tc) == 1_000
+    f_defs!(tc, 1_000)
+    @test f_defs(tc) == 1_000
+    def_max!(tc, 500)
+    @test def_max(tc) == 500
+    large_collapse!(tc, 10)
+    @test large_collapse(tc) == 10
+
+    @test_throws LibsemigroupsError lookahead_growth_factor!(tc, 0.5)
+    @test_throws LibsemigroupsError f_defs!(tc, 0)
+
+    @test tune_for_size!(tc, 10^8) === tc
+    @test lookahead_next(tc) == 10^8
+    @test lookahead_min(tc) == 10^8
+    @test large_collapse(tc) == 10^6
+    @test_throws ArgumentError tune_for_size!(tc, -1)
+
+    # The tuned settings survive a checkpoint
+    mktempdir() do dir
+        path = save_checkpoint(tc, joinpath(dir, "tuned.ckpt"))
+        resumed = load_checkpoint(path)
+        @test lookahead_next(resumed) == 10^8
+        @test lookahead_min(resumed) == 10^8
+        @test large_collapse(resumed) == 10^6
+        @test number_of_classes(resumed) == 27
+    end
+
+    strategy!(tc, strategy_CR)
+    @test number_of_classes(tc) == 27
+end
+
 @testset "TC - current_word_graph after run!" begin
     # After run!, current_word_graph may include inactive allocation slots,
     # so it has at least number_of_classes(tc) + 1 nodes (the +1 accounts for
@@ -311,6 +359,37 @@ end
     @test length(normal_forms(tc)) == number_of_classes(tc)
 end
 
+@testset "TC - batched reduce, contains and index_of" begin
+    p = Presentation()
+    set_alphabet!(p, 2)
+    add_rule_no_checks!(p, _tc_word(0, 0, 0), _tc_word(0))
+    add_rule_no_checks!(p, _tc_word(0), _tc_word(1, 1))
+    tc = ToddCoxeter(twosided, p)
+
+    words = [Int[], [1], [2], [1, 2, 1], [2, 2, 2, 1], [1, 1, 2, 2, 1, 2]]
+    for nthreads in (1, 3)
+        reduced = batch_reduce(tc, words; nthreads = nthreads)
+        @test reduced isa PackedWordVector
+        @test reduced == [Semigroups.reduce(tc, w) for w in words]
+        @test batch_index_of(tc, words; nthreads = nthreads) ==
+              [index_of(tc, w) for w in words]
+        vs = reverse(words)
+        @test batch_contains(tc, words, vs; nthreads = nthreads) ==
+              [Semigroups.contains(tc, u, v) for (u, v) in zip(words, vs)]
+    end
+
+    # A PackedWordVector is accepted as input as-is
+    nf = normal_forms(tc)
+    @test batch_index_of(tc, nf) == [index_of(tc, w) for w in nf]
+    @test batch_reduce(tc, nf) == nf
+
+    @test isempty(batch_reduce(tc, Vector{Int}[]))
+    @test isempty(batch_index_of(tc, Vector{Int}[]))
+    @test_throws LibsemigroupsError batch_reduce(tc, [[1], [3]])
+    @test_throws LibsemigroupsError batch_contains(tc, [[1]], [[1], [2]])
+    @test_throws InexactError batch_index_of(tc, [[0]])
+end
+
 @testset "TC - non_trivial_classes(tc1, tc2) for a quotient pair" begin
     p = Presentation()
     set_alphabet!(p, 2)
@@ -365,3 +444,72 @@ end
 # ============================================================================
 # TODO - port full test-todd-coxeter.cpp test cases
 # ============================================================================
+
+@testset "TC - checkpoint and resume" begin
+    p = full_transformation_monoid(4)
+    expected = number_of_classes(ToddCoxeter(twosided, p))
+
+    mktempdir() do dir
+        path = joinpath(dir, "tc.ckpt")
+        tc = ToddCoxeter(twosided, p)
+        strategy!(tc, strategy_felsch)
+        lower_bound!(tc, 3)
+        lookahead_growth_factor!(tc, 1.5)
+        lookahead_growth_threshold!(tc, 8)
+        hlt_defs!(tc, 1_000)
+        f_defs!(tc, 1_000)
+        def_max!(tc, 500)
+        run_for!(tc, Nanosecond(1_000_000))
+        @test save_checkpoint(tc, path) == path
+        @test isfile(path)
+        @test !isfile(path * ".tmp")
+
+        resumed = load_checkpoint(path)
+        @test resumed isa ToddCoxeter
+        @test strategy(resumed) == strategy_felsch
+        @test lower_bound(resumed) == 3
+        @test lookahead_growth_factor(resumed) == 1.5
+        @test lookahead_growth_threshold(resumed) == 8
+        @test hlt_defs(resumed) == 1_000
+        @test f_defs(resumed) == 1_000
+        @test def_max(resumed) == 500
+        @test contains_empty_word(presentation(resumed)) == contains_empty_word(p)
+        @test number_of_classes(resumed) == expected
+
+        # Periodic checkpoints of a run to completion
+        tc = ToddCoxeter(twosided, p)
+        @test run_with_checkpoints!(tc, path; every = Nanosecond(500_000)) === tc
+        @test finished(tc)
+        @test number_of_classes(load_checkpoint(path)) == expected
+
+        # Corrupt, truncated and foreign files are rejected
+        write(path, "not a checkpoint")
+        @test_throws LibsemigroupsError load_checkpoint(path)
+        @test_throws LibsemigroupsError load_checkpoint(joinpath(dir, "missing"))
+        @test_throws LibsemigroupsError save_checkpoint(ToddCoxeter(onesided, p), path)
+        @test_throws ArgumentError run_with_checkpoints!(tc, path; every = Nanosecond(0))
+    end
+
+    # Resuming from a partial run counts the classes of a semigroup and of a
+    # monoid presentation alike
+    semigroup = Presentation()
+    set_alphabet!(semigroup, 2)
+    add_rule_no_checks!(semigroup, [1, 1, 1], [1])
+    add_rule_no_checks!(semigroup, [2, 2, 2, 2], [2])
+    add_rule_no_checks!(semigroup, [1, 2, 1, 2], [1, 1])
+    for (q, n) in ((semigroup, 27), (p, expected))
+        mktempdir() do dir
+            path = joinpath(dir, "tc.ckpt")
+            tc = ToddCoxeter(twosided, q)
+            run_for!(tc, Nanosecond(100_000))
+            save_checkpoint(tc, path)
+            resumed = load_checkpoint(path)
+            @test contains_empty_word(presentation(resumed)) == contains_empty_word(q)
+            @test number_of_classes(resumed) == n
+
+            run!(tc)
+            save_checkpoint(tc, path)
+            @test number_of_classes(load_checkpoint(path)) == n
+        end
+    end
+end
@@ -555,3 +555,113 @@ end
         @test Semigroups._vec_from_cpp(T[0, 1, 2]) == Int[1, 2, 3]
     end
 end
+
+@testset "PackedElementVector and batch_multiply!" begin
+    # Degree 4 uses the byte shuffle kernel where available, degree 20 and
+    # wider scalar types the portable kernel
+    for n in (4, 20), T in (UInt8, UInt16, UInt32)
+        xs = [Transf(rand(1:n, n), T) for _ = 1:15]
+        ys = [Transf(rand(1:n, n), T) for _ = 1:15]
+        px = PackedElementVector(xs)
+        py = PackedElementVector(ys)
+        @test px isa PackedElementVector{Transf{T}}
+        @test length(px) == 15
+        @test degree(px) == n
+        @test collect(px) == xs
+
+        out = batch_multiply(px, py)
+        @test collect(out) == xs .* ys
+
+        # One operand used for every product
+        @test collect(batch_multiply(px, ys[1])) == xs .* Ref(ys[1])
+        @test collect(batch_multiply(xs[1], py)) == Ref(xs[1]) .* ys
+
+        # In place, into either operand
+        batch_multiply!(px, px, py)
+        @test collect(px) == xs .* ys
+        px = PackedElementVector(xs)
+        batch_multiply!(py, px, py)
+        @test collect(py) == xs .* ys
+    end
+
+    for n in (5, 17)
+        xs = [PPerm([isodd(i + k) ? UNDEFINED : mod1(i + k, n) for i = 1:n]) for k = 1:6]
+        ys = [PPerm([i % 3 == 0 ? UNDEFINED : mod1(k - i, n) for i = 1:n]) for k = 1:6]
+        out = batch_multiply(PackedElementVector(xs), PackedElementVector(ys))
+        @test out isa PackedElementVector{PPerm{UInt8}}
+        @test collect(out) == xs .* ys
+
+        xs = [Perm(circshift(1:n, k)) for k = 1:6]
+        ys = [Perm(reverse(circshift(1:n, k))) for k = 1:6]
+        out = batch_multiply(PackedElementVector(xs), PackedElementVector(ys))
+        @test collect(out) == xs .* ys
+    end
+
+    # Indexing and assignment
+    p = PackedElementVector{Transf{UInt8}}(undef, 3, 2)
+    p[1] = Transf([2, 1, 3])
+    p[2] = Transf([3, 3, 1])
+    @test p.images == UInt8[1 2; 0 2; 2 0]
+    @test p[2] == Transf([3, 3, 1])
+    @test_throws BoundsError p[3]
+    @test_throws ArgumentError p[1] = Transf([1, 2, 3, 4])
+
+    # Errors
+    @test_throws ArgumentError PackedElementVector(Transf{UInt8}[])
+    @test_throws ArgumentError PackedElementVector([Transf([1, 2]), Transf([1, 2, 3])])
+    @test_throws ArgumentError batch_multiply(p, Transf([1, 2, 3, 4]))
+    q = PackedElementVector([Transf([1, 2, 3]) for _ = 1:3])
+    @test_throws LibsemigroupsError batch_multiply!(similar(q), p, q)
+    @test_throws LibsemigroupsError batch_multiply!(similar(p), q, q)
+end
+
+@testset "ElementTable" begin
+    t = ElementTable{Transf{UInt8}}(3)
+    @test isempty(t)
+    @test degree(t) == 3
+    @test number_of_shards(t) == 1
+    @test add_element!(t, Transf([2, 1, 3])) == 1
+    @test add_element!(t, Transf([2, 3, 1])) == 2
+    @test add_element!(t, Transf([2, 1, 3])) == 1
+    @test length(t) == 2
+    @test t[2] == Transf([2, 3, 1])
+    @test collect(t) == [Transf([2, 1, 3]), Transf([2, 3, 1])]
+    @test Semigroups.position(t, Transf([2, 3, 1])) == 2
+    @test Semigroups.position(t, Transf([1, 1, 1])) === UNDEFINED
+    @test Transf([2, 1, 3]) in t
+    @test !(Transf([3, 2, 1]) in t)
+    @test_throws BoundsError t[3]
+    @test_throws LibsemigroupsError add_element!(t, Transf([1, 2]))
+    @test_throws LibsemigroupsError ElementTable{Transf{UInt8}}(0)
+
+    # Batches give the positions of adding one element at a time, whatever
+    # the number of shards and threads
+    xs = [Transf(rand(1:6, 6)) for _ = 1:2000]
+    px = PackedElementVector(xs)
+    expected = let u = ElementTable{Transf{UInt8}}(6)
+        [add_element!(u, x) for x in xs]
+    end
+    for (shards, nthreads) in ((1, 1), (1, 4), (16, 1), (16, 4))
+        u = ElementTable{Transf{UInt8}}(6; shards = shards)
+        @test add_elements!(u, px; nthreads = nthreads) == expected
+        @test collect(u) == unique(xs)
+        @test PackedElementVector(u) == unique(xs)
+        @test positions(u, px; nthreads = nthreads) == expected
+        @test add_elements!(u, px; nthreads = nthreads) == expected
+        @test length(u) == length(unique(xs))
+    end
+    @test positions(t, PackedElementVector([Transf([3, 2, 1]), Transf([2, 3, 1])])) ==
+          [UNDEFINED, 2]
+    @test_throws ArgumentError add_elements!(t, px)
+
+    # Partial permutations and permutations
+    p = ElementTable{PPerm{UInt8}}(3; shards = 3)
+    @test number_of_shards(p) == 4
+    @test add_element!(p, PPerm([1, 2], [2, 3], 3)) == 1
+    @test add_element!(p, one(PPerm([1, 2], [2, 3], 3))) == 2
+    @test p[1] == PPerm([1, 2], [2, 3], 3)
+    q = ElementTable{Perm{UInt16}}(300)
+    x = Perm(vcat(2:300, 1), UInt16)
+    @test add_elements!(q, PackedElementVector([x, x * x, x])) == [1, 2, 1]
+    @test q[2] == x * x
+end
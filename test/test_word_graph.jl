@@ -15,6 +15,10 @@ using Semigroups
         @test hasmethod(target!, Tuple{WordGraph,Integer,Integer,Integer})
         @test hasmethod(target!, Tuple{WordGraph,Integer,Integer,Semigroups.UndefinedType})
         @test hasmethod(add_nodes!, Tuple{WordGraph,Integer})
+        @test hasmethod(target_table, Tuple{WordGraph})
+        @test hasmethod(unsafe_target_table, Tuple{WordGraph})
+        @test hasmethod(target_table!, Tuple{WordGraph,Matrix{UInt32}})
+        @test hasmethod(WordGraph, Tuple{Matrix{UInt32}})
     end
 
     @testset "construction" begin
@@ -102,4 +106,105 @@ using Semigroups
         @test is_undefined(target(g5, 5, 1))
     end
 
+    @testset "bulk target tables" begin
+        g = WordGraph(3, 2)
+        target!(g, 1, 1, 2)
+        target!(g, 2, 2, 3)
+        target!(g, 3, 1, 1)
+
+        # --- Copy: raw 0-based entries, typemax for missing edges ---
+        t = target_table(g)
+        @test size(t) == (3, 2)
+        @test t == UInt32[1 typemax(UInt32); typemax(UInt32) 2; 0 typemax(UInt32)]
+
+        # --- Borrowed view agrees with the copy and sees later edits ---
+        v = unsafe_target_table(g)
+        @test v isa TargetTable
+        @test size(v) == (3, 2)
+        @test v == t
+        target!(g, 1, 2, 1)
+        @test v[1, 2] == 0
+        @test_throws BoundsError v[4, 1]
+
+        # --- Round trip through the bulk constructor ---
+        h = WordGraph(target_table(g))
+        @test number_of_nodes(h) == 3
+        @test out_degree(h) == 2
+        for s = 1:3, a = 1:2
+            @test target(h, s, a) == target(g, s, a)
+        end
+
+        # --- Bulk setter validates before writing ---
+        bad = copy(t)
+        bad[2, 1] = 7
+        @test_throws LibsemigroupsError target_table!(h, bad)
+        @test target_table(h) == target_table(g)
+        @test_throws DimensionMismatch target_table!(h, zeros(UInt32, 2, 2))
+        @test_throws InexactError target_table!(h, fill(-1, 3, 2))
+
+        # --- Padded rows after add_nodes! are not exposed ---
+        add_nodes!(g, 2)
+        v = unsafe_target_table(g)
+        @test size(v) == (5, 2)
+        @test v == target_table(g)
+        @test all(==(typemax(UInt32)), v[4:5, :])
+
+        # --- Empty graphs: views never reach C++, copies go through it ---
+        @test size(unsafe_target_table(WordGraph(0, 2))) == (0, 2)
+        @test size(unsafe_target_table(WordGraph(2, 0))) == (2, 0)
+        @test size(target_table(WordGraph(0, 2))) == (0, 2)
+        @test size(target_table(WordGraph(2, 0))) == (2, 0)
+        e = WordGraph(0, 2)
+        @test target_table!(e, zeros(UInt32, 0, 2)) === e
+        @test number_of_nodes(WordGraph(zeros(UInt32, 0, 2))) == 0
+    end
+
+    @testset "algorithms" begin
+        # 1 <-> 2 -> 3 -> 4 -> 3, 5 isolated; label 2 of 4 undefined
+        g = WordGraph(5, 2)
+        target!(g, 1, 1, 2)
+        target!(g, 2, 1, 1)
+        target!(g, 2, 2, 3)
+        target!(g, 3, 1, 4)
+        target!(g, 4, 1, 3)
+        @test number_of_edges(g) == 5
+
+        ids = scc_ids(g)
+        @test ids[1] == ids[2]
+        @test ids[3] == ids[4]
+        @test length(unique(ids)) == 3
+        @test sort(unique(ids)) == 1:3
+        for s = 1:5, a = 1:2
+            t = target(g, s, a)
+            is_undefined(t) || @test ids[t] <= ids[s]
+        end
+
+        @test bfs_order(g, 1) == [1, 2, 3, 4]
+        @test dfs_order(g, 2) == [2, 1, 3, 4]
+        @test bfs_order(g, 5) == [5]
+        @test reachable(g, 3) == BitVector([0, 0, 1, 1, 0])
+        @test_throws LibsemigroupsError bfs_order(g, 6)
+        @test_throws InexactError dfs_order(g, 0)
+
+        q = quotient(g, [1, 1, 2, 2, 3])
+        @test number_of_nodes(q) == 3
+        @test out_degree(q) == 2
+        @test target(q, 1, 1) == 1
+        @test target(q, 1, 2) == 2
+        @test target(q, 2, 1) == 2
+        @test is_undefined(target(q, 3, 1))
+        @test_throws LibsemigroupsError quotient(g, [1, 1, 1, 2, 3])
+        @test_throws LibsemigroupsError quotient(g, [1, 1, 2])
+
+        for nthreads in (1, 3)
+            c = csr(g; nthreads = nthreads)
+            @test c.offsets == [1, 2, 4, 5, 6, 6]
+            @test c.targets == [2, 1, 3, 4, 3]
+            @test c.labels == [1, 1, 2, 1, 1]
+        end
+        c = csr(WordGraph(0, 2))
+        @test c.offsets == [1]
+        @test isempty(c.targets)
+    end
+
 end
@@ -64,6 +64,34 @@ using Semigroups
         @test first(collected) == [1]
     end
 
+    @testset "bulk enumeration" begin
+        r = WordRange()
+        set_alphabet_size!(r, 2)
+        set_max!(r, 4)
+        expected = collect(r)
+        init!(r)
+        set_alphabet_size!(r, 2)
+        set_max!(r, 4)
+        @test collect(take!(r, 5)) == expected[1:5]
+        @test collect(take!(r, 100)) == expected[6:end]
+        @test at_end(r)
+
+        init!(r)
+        set_alphabet_size!(r, 2)
+        set_max!(r, 4)
+        # Room for 4 words of 8 letters in total: later fills stop early
+        # once the words are long enough to exhaust the letters.
+        buf = PackedWordBuffer(4, 8)
+        @test length(fill!(buf, r)) == 4
+        @test collect(PackedWordVector(buf)) == expected[1:4]
+        filled = collect(PackedWordVector(buf))
+        while !at_end(r)
+            append!(filled, PackedWordVector(fill!(buf, r)))
+        end
+        @test filled == expected
+        @test_throws ArgumentError take!(r, -1)
+    end
+
     @testset "number_of_words free function" begin
         @test number_of_words(3, 1, 4) == 39
         @test number_of_words(2, 5, 6) == 32